@@ -0,0 +1,291 @@
+/*	Affine_Transform
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Affine_Transform.hh"
+using namespace PIRL;
+
+#include	<cmath>
+#include	<limits>
+using std::numeric_limits;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Affine_Transform::ID =
+		"PIRL::Affine_Transform ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+namespace
+{
+//	The smallest and largest doubles that convert to a Coordinate_Type.
+const double
+	LOWEST_COORDINATE
+		= static_cast<double>(numeric_limits<Coordinate_Type>::lowest ()),
+	HIGHEST_COORDINATE
+		= (numeric_limits<Coordinate_Type>::digits
+			> numeric_limits<double>::digits) ?
+		std::nextafter
+			(static_cast<double>(numeric_limits<Coordinate_Type>::max ()), 0.0) :
+		static_cast<double>(numeric_limits<Coordinate_Type>::max ());
+
+/*	Rounds a number, half away from zero, to a saturated Coordinate_Type.
+
+	The selections are free of branches so loops of this function can be
+	vectorized. A value that is not a number fails every comparison and
+	is replaced with zero.
+*/
+inline Coordinate_Type
+rounded
+	(
+	double	number
+	)
+{
+double
+	value = number + std::copysign (0.5, number);
+value = (value < LOWEST_COORDINATE)  ? LOWEST_COORDINATE  : value;
+value = (value > HIGHEST_COORDINATE) ? HIGHEST_COORDINATE : value;
+value = (value == value) ? value : 0.0;
+return static_cast<Coordinate_Type>(value);
+}
+
+}	//	local namespace
+
+/*==============================================================================
+	Constructors
+*/
+Affine_Transform::Affine_Transform ()
+	:	Scale_X_X (1.0),
+		Scale_X_Y (0.0),
+		Offset_X (0.0),
+		Scale_Y_X (0.0),
+		Scale_Y_Y (1.0),
+		Offset_Y (0.0)
+{}
+
+
+Affine_Transform::Affine_Transform
+	(
+	double	scale_x_x,
+	double	scale_x_y,
+	double	offset_x,
+	double	scale_y_x,
+	double	scale_y_y,
+	double	offset_y
+	)
+	:	Scale_X_X (scale_x_x),
+		Scale_X_Y (scale_x_y),
+		Offset_X (offset_x),
+		Scale_Y_X (scale_y_x),
+		Scale_Y_Y (scale_y_y),
+		Offset_Y (offset_y)
+{}
+
+/*==============================================================================
+	Accessors
+*/
+bool
+Affine_Transform::operator==
+	(
+	const Affine_Transform&	transform
+	) const
+{
+return
+	Scale_X_X == transform.Scale_X_X &&
+	Scale_X_Y == transform.Scale_X_Y &&
+	Offset_X  == transform.Offset_X &&
+	Scale_Y_X == transform.Scale_Y_X &&
+	Scale_Y_Y == transform.Scale_Y_Y &&
+	Offset_Y  == transform.Offset_Y;
+}
+
+/*==============================================================================
+	Manipulators
+*/
+Affine_Transform&
+Affine_Transform::then
+	(
+	const Affine_Transform&	transform
+	)
+{
+Affine_Transform
+	product
+		(
+		transform.Scale_X_X * Scale_X_X + transform.Scale_X_Y * Scale_Y_X,
+		transform.Scale_X_X * Scale_X_Y + transform.Scale_X_Y * Scale_Y_Y,
+		transform.Scale_X_X * Offset_X  + transform.Scale_X_Y * Offset_Y
+			+ transform.Offset_X,
+		transform.Scale_Y_X * Scale_X_X + transform.Scale_Y_Y * Scale_Y_X,
+		transform.Scale_Y_X * Scale_X_Y + transform.Scale_Y_Y * Scale_Y_Y,
+		transform.Scale_Y_X * Offset_X  + transform.Scale_Y_Y * Offset_Y
+			+ transform.Offset_Y
+		);
+return *this = product;
+}
+
+
+Affine_Transform&
+Affine_Transform::scale
+	(
+	double	factor_x,
+	double	factor_y
+	)
+{
+return then (Affine_Transform
+	(factor_x, 0.0, 0.0,
+	 0.0, factor_y, 0.0));
+}
+
+
+Affine_Transform&
+Affine_Transform::rotate
+	(
+	double	angle
+	)
+{
+double
+	cosine = std::cos (angle),
+	sine = std::sin (angle);
+return then (Affine_Transform
+	(cosine, -sine, 0.0,
+	 sine, cosine, 0.0));
+}
+
+
+Affine_Transform&
+Affine_Transform::translate
+	(
+	double	offset_x,
+	double	offset_y
+	)
+{
+return then (Affine_Transform
+	(1.0, 0.0, offset_x,
+	 0.0, 1.0, offset_y));
+}
+
+/*==============================================================================
+	Transforms
+*/
+Point_2D
+Affine_Transform::operator()
+	(
+	const Point_2D&	point
+	) const
+{
+const double
+	x = point.X,
+	y = point.Y;
+return Point_2D
+	(rounded (Scale_X_X * x + Scale_X_Y * y + Offset_X),
+	 rounded (Scale_Y_X * x + Scale_Y_Y * y + Offset_Y));
+}
+
+
+const Affine_Transform&
+Affine_Transform::transform
+	(
+	const Point_2D*	source,
+	Point_2D*		target,
+	std::size_t		count
+	) const
+{
+const double
+	scale_x_x = Scale_X_X,
+	scale_x_y = Scale_X_Y,
+	offset_x  = Offset_X,
+	scale_y_x = Scale_Y_X,
+	scale_y_y = Scale_Y_Y,
+	offset_y  = Offset_Y;
+if (source == target)
+	{
+	//	A single pointer lets the compiler see each point is read first.
+	for (std::size_t
+			index = 0;
+			index < count;
+		  ++index)
+		{
+		const double
+			x = target[index].X,
+			y = target[index].Y;
+		target[index].X = rounded (scale_x_x * x + scale_x_y * y + offset_x);
+		target[index].Y = rounded (scale_y_x * x + scale_y_y * y + offset_y);
+		}
+	}
+else
+	{
+	for (std::size_t
+			index = 0;
+			index < count;
+		  ++index)
+		{
+		const double
+			x = source[index].X,
+			y = source[index].Y;
+		target[index].X = rounded (scale_x_x * x + scale_x_y * y + offset_x);
+		target[index].Y = rounded (scale_y_x * x + scale_y_y * y + offset_y);
+		}
+	}
+return *this;
+}
+
+
+const Affine_Transform&
+Affine_Transform::transform
+	(
+	Coordinate_Type*	x,
+	Coordinate_Type*	y,
+	std::size_t			count
+	) const
+{
+const double
+	scale_x_x = Scale_X_X,
+	scale_x_y = Scale_X_Y,
+	offset_x  = Offset_X,
+	scale_y_x = Scale_Y_X,
+	scale_y_y = Scale_Y_Y,
+	offset_y  = Offset_Y;
+for (std::size_t
+		index = 0;
+		index < count;
+	  ++index)
+	{
+	const double
+		x_value = x[index],
+		y_value = y[index];
+	x[index] = rounded (scale_x_x * x_value + scale_x_y * y_value + offset_x);
+	y[index] = rounded (scale_y_x * x_value + scale_y_y * y_value + offset_y);
+	}
+return *this;
+}
+
+
+void
+Affine_Transform::round
+	(
+	const double*		numbers,
+	Coordinate_Type*	values,
+	std::size_t			count
+	)
+{
+for (std::size_t
+		index = 0;
+		index < count;
+	  ++index)
+	values[index] = rounded (numbers[index]);
+}
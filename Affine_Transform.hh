@@ -0,0 +1,256 @@
+/*	Affine_Transform
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Affine_Transform_
+#define _Affine_Transform_
+
+#include	"Dimensions.hh"
+
+#include	<cstddef>
+#include	<vector>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Affine_Transform
+*/
+/**	An <i>Affine_Transform</i> scales, rotates and translates arrays of
+	points.
+
+	A transform maps the point x,y to the point
+
+	<code>
+	x' = Scale_X_X * x + Scale_X_Y * y + Offset_X<br>
+	y' = Scale_Y_X * x + Scale_Y_Y * y + Offset_Y
+	</code>
+
+	with the results {@link round(const double*, Coordinate_Type*,
+	std::size_t) rounded} to Coordinate_Type values. Transforms are built
+	from the identity by appending {@link scale(double, double) scaling},
+	{@link rotate(double) rotation} and {@link translate(double, double)
+	translation} steps, or by appending other transforms.
+
+	The points may be an array of Point_2D or separate columns of X and
+	Y coordinates, such as the columns of a Rectangle_Set. Each array is
+	transformed in a single loop, free of branches, that the compiler can
+	vectorize.
+
+	Rounding is to the nearest integer with halfway values rounded away
+	from zero, the same as the Round function, so a transform that only
+	scales produces the same points as the Point_2D multiplication
+	operator. Values beyond the range of Coordinate_Type are saturated to
+	the largest or smallest value, as the Point_2D division operator does
+	for division by zero, and values that are not a number become zero.
+
+	<code>
+	Affine_Transform to_display;<br>
+	to_display.scale (zoom).translate (-origin.X, -origin.Y);<br>
+	to_display.transform (control_points);
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Point_2D
+*/
+class Affine_Transform
+{
+public:
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+//!	Constructs an identity transform.
+Affine_Transform ();
+
+/**	Constructs a transform from its coefficients.
+
+	@param	scale_x_x	The factor of x in x'.
+	@param	scale_x_y	The factor of y in x'.
+	@param	offset_x	The offset added to x'.
+	@param	scale_y_x	The factor of x in y'.
+	@param	scale_y_y	The factor of y in y'.
+	@param	offset_y	The offset added to y'.
+*/
+Affine_Transform
+	(
+	double	scale_x_x,
+	double	scale_x_y,
+	double	offset_x,
+	double	scale_y_x,
+	double	scale_y_y,
+	double	offset_y
+	);
+
+/*==============================================================================
+	Accessors
+*/
+//!	The factor of x in x'.
+double scale_x_x () const
+	{return Scale_X_X;}
+//!	The factor of y in x'.
+double scale_x_y () const
+	{return Scale_X_Y;}
+//!	The offset added to x'.
+double offset_x () const
+	{return Offset_X;}
+//!	The factor of x in y'.
+double scale_y_x () const
+	{return Scale_Y_X;}
+//!	The factor of y in y'.
+double scale_y_y () const
+	{return Scale_Y_Y;}
+//!	The offset added to y'.
+double offset_y () const
+	{return Offset_Y;}
+
+/**	Tests if two transforms are equal.
+
+	@param	transform	The Affine_Transform to compare with this one.
+	@return	true if all the coefficients are equal; false otherwise.
+*/
+bool operator== (const Affine_Transform& transform) const;
+
+/**	Tests if two transforms are not equal.
+
+	@param	transform	The Affine_Transform to compare with this one.
+	@return	true if any coefficients differ; false otherwise.
+*/
+bool operator!= (const Affine_Transform& transform) const
+	{return ! (*this == transform);}
+
+/*==============================================================================
+	Manipulators
+*/
+/**	Appends another transform.
+
+	@param	transform	The Affine_Transform to be applied after this
+		transform.
+	@return	This Affine_Transform.
+*/
+Affine_Transform& then (const Affine_Transform& transform);
+
+/**	Appends a scaling.
+
+	@param	factor_x	The factor applied to x.
+	@param	factor_y	The factor applied to y.
+	@return	This Affine_Transform.
+*/
+Affine_Transform& scale (double factor_x, double factor_y);
+
+/**	Appends a uniform scaling.
+
+	@param	factor	The factor applied to x and y.
+	@return	This Affine_Transform.
+*/
+Affine_Transform& scale (double factor)
+	{return scale (factor, factor);}
+
+/**	Appends a rotation about the origin.
+
+	@param	angle	The angle, in radians, from the X axis towards the
+		Y axis.
+	@return	This Affine_Transform.
+*/
+Affine_Transform& rotate (double angle);
+
+/**	Appends a translation.
+
+	@param	offset_x	The offset added to x.
+	@param	offset_y	The offset added to y.
+	@return	This Affine_Transform.
+*/
+Affine_Transform& translate (double offset_x, double offset_y);
+
+/*==============================================================================
+	Transforms
+*/
+/**	Transforms a point.
+
+	@param	point	The Point_2D to be transformed.
+	@return	The transformed Point_2D.
+*/
+Point_2D operator() (const Point_2D& point) const;
+
+/**	Transforms an array of points into another array.
+
+	@param	source	A pointer to the points to be transformed.
+	@param	target	A pointer to storage for the transformed points. This
+		may be the same as the source.
+	@param	count	The number of points.
+	@return	This Affine_Transform.
+*/
+const Affine_Transform& transform (const Point_2D* source, Point_2D* target,
+	std::size_t count) const;
+
+/**	Transforms a vector of points in place.
+
+	@param	points	The vector of Point_2D to be transformed.
+	@return	This Affine_Transform.
+*/
+const Affine_Transform& transform (std::vector<Point_2D>& points) const
+	{return transform (points.data (), points.data (), points.size ());}
+
+/**	Transforms columns of point coordinates in place.
+
+	@param	x	A pointer to the X coordinates.
+	@param	y	A pointer to the Y coordinates. This must not be the same
+		as the X coordinates.
+	@param	count	The number of points.
+	@return	This Affine_Transform.
+*/
+const Affine_Transform& transform (Coordinate_Type* x, Coordinate_Type* y,
+	std::size_t count) const;
+
+/**	Rounds an array of numbers to Coordinate_Type values.
+
+	Each number is rounded to the nearest integer, with halfway values
+	rounded away from zero, as by the Round function. Numbers beyond the
+	range of Coordinate_Type are saturated to its largest or smallest
+	value, and numbers that are not a number become zero.
+
+	@param	numbers	A pointer to the numbers to be rounded.
+	@param	values	A pointer to storage for the rounded values.
+	@param	count	The number of numbers.
+*/
+static void round (const double* numbers, Coordinate_Type* values,
+	std::size_t count);
+
+/*==============================================================================
+	Data
+*/
+private:
+
+double
+	Scale_X_X,
+	Scale_X_Y,
+	Offset_X,
+	Scale_Y_X,
+	Scale_Y_Y,
+	Offset_Y;
+
+};	//	class Affine_Transform
+
+}	//	namespace PIRL
+#endif
@@ -0,0 +1,110 @@
+/*	Bit_Field
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Bit_Field.hh"
+using namespace PIRL;
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+using std::out_of_range;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Bit_Field::ID =
+		"PIRL::Bit_Field ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+#ifndef DOXYGEN_PROCESSING
+const unsigned int
+	Bit_Field::BLOCK_RECORDS;
+#endif	//	DOXYGEN_PROCESSING
+
+/*==============================================================================
+	Constructors
+*/
+Bit_Field::Bit_Field
+	(
+	Index			element,
+	unsigned int	offset,
+	unsigned int	width,
+	bool			is_signed
+	)
+	:	Element (element),
+		Offset (offset),
+		Width (width),
+		Signed (is_signed),
+		Mask (0)
+{
+if (! Width ||
+	Width > 64 ||
+	Offset > 64 - Width)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't have a bit field of width " << Width
+				<< " at bit offset " << Offset << '.';
+	throw invalid_argument (message.str ());
+	}
+Mask = ~std::uint64_t (0) >> (64 - Width);
+}
+
+/*==============================================================================
+	Helpers
+*/
+unsigned int
+Bit_Field::check
+	(
+	const Data_Block&	block,
+	Index				index
+	) const
+{
+if (Element >= block.elements () ||
+	index >= block.count_of (Element))
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't use value " << index << " of element " << Element
+				<< " of a Data_Block with " << block.elements ()
+				<< " elements.";
+	throw out_of_range (message.str ());
+	}
+unsigned int
+	size = block.value_size_of (Element);
+if (! size ||
+	size > sizeof (std::uint64_t) ||
+	Offset + Width > size * 8)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't have a bit field of width " << Width
+				<< " at bit offset " << Offset << endl
+			<< "in the " << size << " byte value of element "
+				<< Element << '.';
+	throw out_of_range (message.str ());
+	}
+return size;
+}
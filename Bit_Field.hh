@@ -0,0 +1,324 @@
+/*	Bit_Field
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Bit_Field_
+#define _Bit_Field_
+
+#include	"Data_Block.hh"
+#include	"Value_Conversion.hh"
+
+#include	<cstddef>
+#include	<cstdint>
+#include	<algorithm>
+#include	<type_traits>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Bit_Field
+*/
+/**	A <i>Bit_Field</i> is a range of bits in the integer value of a
+	Data_Block element.
+
+	The element value is an unsigned integer of 1 to 8 bytes in the data
+	order of the Data_Block; any value format of the element is not
+	used. The bits of the field are numbered from the least significant
+	bit of the value: a field with an offset of 4 and a width of 3 is
+	bits 4, 5 and 6 of the value, whatever the byte order of the data.
+	A signed field is a two's complement value whose most significant
+	bit is the sign.
+
+	A field value may be obtained with {@link get(const Data_Block&,
+	Data_Block::Index)const get} or set with {@link put(Data_Block&, T,
+	Data_Block::Index)const put} - which changes only the bits of the
+	field - for the data of a Data_Block. The field values of a sequence
+	of records may be {@link gather(T*, const Data_Block&, const void*,
+	std::size_t, std::size_t, Data_Block::Index)const gathered} into an
+	array: the element values of a block of records are gathered as
+	integers, and the shift and mask of the field is then applied to all
+	of them in a loop that the compiler can vectorize.
+
+	<code>
+	Bit_Field mode (STATUS, 4, 3);<br>
+	unsigned int current_mode = mode.get<unsigned int> (housekeeping);
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Data_Block
+*/
+class Bit_Field
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Data_Block element index.
+typedef Data_Block::Index		Index;
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The number of records gathered at a time.
+static const unsigned int
+	BLOCK_RECORDS	= 256;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Bit_Field.
+
+	@param	element	The index of the Data_Block element that contains the
+		field.
+	@param	offset	The number of the least significant bit of the
+		field, counting from the least significant bit of the element
+		value.
+	@param	width	The number of bits in the field.
+	@param	is_signed	true if the field is a signed value; false if it
+		is unsigned.
+	@throws	std::invalid_argument	If the width is zero or the field
+		extends beyond 64 bits.
+*/
+Bit_Field
+	(
+	Index			element,
+	unsigned int	offset,
+	unsigned int	width,
+	bool			is_signed = false
+	);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the element index.
+
+	@return	The index of the Data_Block element that contains the field.
+*/
+Index element () const
+	{return Element;}
+
+/**	Gets the bit offset.
+
+	@return	The number of the least significant bit of the field.
+*/
+unsigned int offset () const
+	{return Offset;}
+
+/**	Gets the bit width.
+
+	@return	The number of bits in the field.
+*/
+unsigned int width () const
+	{return Width;}
+
+/**	Tests if the field is signed.
+
+	@return	true if the field is a signed value; false otherwise.
+*/
+bool is_signed () const
+	{return Signed;}
+
+/**	Gets the field mask.
+
+	@return	A value with the bits of the field set.
+*/
+std::uint64_t mask () const
+	{return Mask << Offset;}
+
+/*==============================================================================
+	Values
+*/
+/**	Gets the field value from the data of a Data_Block.
+
+	@param	T	The integer type of the value.
+	@param	block	The Data_Block with the element.
+	@param	index	The element array value index.
+	@return	The field value. This is zero if the Data_Block has no
+		data.
+	@throws	std::out_of_range	If the element or array value is not in
+		the Data_Block, its value is larger than 8 bytes, or the field
+		does not fit in the value.
+*/
+template<typename T>
+T get
+	(
+	const Data_Block&	block,
+	Index				index = 0
+	) const
+	{
+	static_assert (std::is_integral<T>::value,
+		"Bit_Field values must be integers");
+	unsigned int
+		size = check (block, index);
+	if (! block.data ())
+		return 0;
+	std::uint64_t
+		bits;
+	integers_to_values (block.data () + block.offset_of (Element)
+		+ index * size, size, false, ! block.native (), &bits, 1);
+	return static_cast<T>(field (bits));
+	}
+
+/**	Puts the field value into the data of a Data_Block.
+
+	Only the bits of the field in the element value are changed. The
+	value is truncated to the width of the field. Nothing is done if the
+	Data_Block has no data.
+
+	@param	T	The integer type of the value.
+	@param	block	The Data_Block with the element.
+	@param	value	The field value.
+	@param	index	The element array value index.
+	@return	This Bit_Field.
+	@throws	std::out_of_range	If the element or array value is not in
+		the Data_Block, its value is larger than 8 bytes, or the field
+		does not fit in the value.
+*/
+template<typename T>
+const Bit_Field& put
+	(
+	Data_Block&		block,
+	T				value,
+	Index			index = 0
+	) const
+	{
+	static_assert (std::is_integral<T>::value,
+		"Bit_Field values must be integers");
+	unsigned int
+		size = check (block, index);
+	if (! block.data ())
+		return *this;
+	unsigned char
+		*data = block.data () + block.offset_of (Element) + index * size;
+	std::uint64_t
+		bits;
+	integers_to_values (data, size, false, ! block.native (), &bits, 1);
+	bits = (bits & ~mask ())
+		| ((static_cast<std::uint64_t>(value) & Mask) << Offset);
+	values_to_integers (&bits, data, size, false, ! block.native (), 1);
+	return *this;
+	}
+
+/**	Gathers the field values of a sequence of records.
+
+	The Data_Block describes the structure of each record of a sequence
+	of fixed length records; its data address is not used. The field of
+	each record is obtained as {@link get(const Data_Block&, Index)const
+	get} would obtain it from the Data_Block with the record as its data.
+
+	@param	T	The integer type of the values.
+	@param	values	A pointer to an array of at least count values.
+	@param	layout	The Data_Block that describes the record structure.
+	@param	records	A pointer to the first byte of the first record.
+	@param	count	The number of records.
+	@param	record_size	The number of bytes from the start of one record
+		to the start of the next.
+	@param	index	The element array value index.
+	@return	This Bit_Field.
+	@throws	std::out_of_range	If the element or array value is not in
+		the layout, its value is larger than 8 bytes, or the field does
+		not fit in the value.
+*/
+template<typename T>
+const Bit_Field& gather
+	(
+	T*					values,
+	const Data_Block&	layout,
+	const void*			records,
+	std::size_t			count,
+	std::size_t			record_size,
+	Index				index = 0
+	) const
+	{
+	static_assert (std::is_integral<T>::value,
+		"Bit_Field values must be integers");
+	unsigned int
+		size = check (layout, index);
+	const unsigned char
+		*data = static_cast<const unsigned char*>(records)
+			+ layout.offset_of (Element) + index * size;
+	std::uint64_t
+		bits[BLOCK_RECORDS];
+	const unsigned int
+		offset = Offset;
+	const std::uint64_t
+		mask = Mask,
+		sign = Signed ? (std::uint64_t (1) << (Width - 1)) : 0;
+	while (count)
+		{
+		std::size_t
+			amount = std::min (count, std::size_t (BLOCK_RECORDS));
+		integers_to_values (data, size, false, ! layout.native (),
+			bits, amount, false, record_size);
+		for (std::size_t
+				record = 0;
+				record < amount;
+			  ++record)
+			values[record] = static_cast<T>
+				((((bits[record] >> offset) & mask) ^ sign) - sign);
+		values += amount;
+		data += amount * record_size;
+		count -= amount;
+		}
+	return *this;
+	}
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+/*	Checks that the field fits in a value of an element of a Data_Block
+	and returns the value size.
+*/
+unsigned int check (const Data_Block& block, Index index) const;
+
+//	Extracts the field from an element value, extending its sign.
+std::uint64_t field (std::uint64_t bits) const
+	{
+	std::uint64_t
+		sign = Signed ? (std::uint64_t (1) << (Width - 1)) : 0;
+	return (((bits >> Offset) & Mask) ^ sign) - sign;
+	}
+
+/*==============================================================================
+	Data
+*/
+Index
+	Element;
+
+unsigned int
+	Offset,
+	Width;
+
+bool
+	Signed;
+
+//	The field mask at bit offset zero.
+std::uint64_t
+	Mask;
+
+};	//	class Bit_Field
+
+}	//	namespace PIRL
+#endif
@@ -215,7 +215,7 @@ if (Next > Start &&
 		 << "       to " << setw (2 * sizeof (void*))
 			<< (void*)Start << endl;
 	#endif
-	memcpy (Start, next, Last - next);
+	memmove (Start, next, Last - next);
 
 	//	Shift the data pointers.
 	Next = Start + ((next == Next) ? 0 : (Next - next));
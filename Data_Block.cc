@@ -20,6 +20,7 @@ along with this library; if not, write to the Free Software Foundation,
 Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
 */
 #include	"Data_Block.hh"
+#include	"Value_Conversion.hh"
 using namespace PIRL;
 
 #include	<cstring>
@@ -30,6 +31,9 @@ using std::string;
 
 #include	<algorithm>
 using std::sort;
+using std::rotate;
+using std::lower_bound;
+using std::upper_bound;
 
 #include	<istream>
 using std::istream;
@@ -91,6 +95,15 @@ namespace
 #endif
 const unsigned int
 	INITIAL_CAPACITY						= DATA_BLOCK_INITIAL_CAPACITY;
+
+/*	The largest data block, in bytes, for which an element lookup table
+	is used.
+*/
+#ifndef DATA_BLOCK_LOOKUP_LIMIT
+#define DATA_BLOCK_LOOKUP_LIMIT				4096
+#endif
+const unsigned int
+	LOOKUP_LIMIT							= DATA_BLOCK_LOOKUP_LIMIT;
 }
 #endif	//	DOXYGEN_PROCESSING
 
@@ -98,7 +111,9 @@ const unsigned int
 	Constructors
 */
 Data_Block::Data_Block ()
-	:	Block (NULL)
+	:	Block (NULL),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">-< Data_Block::constructor: (default)" << endl;
@@ -115,16 +130,15 @@ Data_Block::Data_Block
 	const Index*	counts,
 	bool			native_order
 	)
-	:	Block (reinterpret_cast<unsigned char*>(data))
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">>> Data_Block::constructor: "
 	 << (native_order ? "" : "non-") << "native order" << endl
 	 << "    data @ " << data << endl;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
-
 element_offsets (offsets, total_elements);
 array_counts (counts);
 native (native_order);
@@ -141,16 +155,15 @@ Data_Block::Data_Block
 	const Value_List&	counts,
 	bool				native_order
 	)
-	:	Block (reinterpret_cast<unsigned char*>(data))
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">>> Data_Block::constructor: "
 	 << (native_order ? "" : "non-") << "native order" << endl
 	 << "    data @ " << data << endl;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
-
 element_offsets (offsets);
 array_counts (counts);
 native (native_order);
@@ -166,16 +179,15 @@ Data_Block::Data_Block
 	const Value_List&	offsets,
 	bool				native_order
 	)
-	:	Block (reinterpret_cast<unsigned char*>(data))
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">>> Data_Block::constructor: "
 	 << (native_order ? "" : "non-") << "native order" << endl
 	 << "    data @ " << data << endl;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
-
 element_offsets (offsets);
 native (native_order);
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
@@ -192,16 +204,15 @@ Data_Block::Data_Block
 	const Index*	counts,
 	Data_Order		order
 	)
-	:	Block (reinterpret_cast<unsigned char*>(data))
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">>> Data_Block::constructor: "
 	 << (order == MSB ? "MSB" : "LSB") << " order (" << order << ')' << endl
 	 << "    data @ " << data << endl;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
-
 element_offsets (offsets, total_elements);
 array_counts (counts);
 data_order (order);
@@ -218,16 +229,15 @@ Data_Block::Data_Block
 	const Value_List&	counts,
 	Data_Order			order
 	)
-	:	Block (reinterpret_cast<unsigned char*>(data))
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">>> Data_Block::constructor: "
 	 << (order == MSB ? "MSB" : "LSB") << " order (" << order << ')' << endl
 	 << "    data @ " << data << endl;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
-
 element_offsets (offsets);
 array_counts (counts);
 data_order (order);
@@ -244,16 +254,15 @@ Data_Block::Data_Block
 	Index			total_elements,
 	Data_Order		order
 	)
-	:	Block (reinterpret_cast<unsigned char*>(data))
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">> Data_Block::constructor: "
 	 << (order == MSB ? "MSB" : "LSB") << " order (" << order << ')' << endl
 	 << "    data @ " << data << endl;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
-
 element_offsets (offsets, total_elements);
 data_order (order);
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
@@ -268,16 +277,15 @@ Data_Block::Data_Block
 	const Index*	offsets,
 	Data_Order		order
 	)
-	:	Block (reinterpret_cast<unsigned char*>(data))
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">>> Data_Block::constructor: "
 	 << (order == MSB ? "MSB" : "LSB") << " order (" << order << ')' << endl
 	 << "    data @ " << data << endl;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
-
 element_offsets (offsets);
 data_order (order);
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
@@ -292,16 +300,15 @@ Data_Block::Data_Block
 	const Value_List&	offsets,
 	Data_Order			order
 	)
-	:	Block (reinterpret_cast<unsigned char*>(data))
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">>> Data_Block::constructor: "
 	 << (order == MSB ? "MSB" : "LSB") << " order (" << order << ')' << endl
 	 << "    data @ " << data << endl;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
-
 element_offsets (offsets);
 data_order (order);
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
@@ -317,16 +324,15 @@ Data_Block::Data_Block
 	const Index		indexed_counts[][2],
 	Data_Order		order
 	)
-	:	Block (reinterpret_cast<unsigned char*>(data))
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Structure (new Layout),
+		Saturate (false)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">>> Data_Block::constructor: "
 	 << (order == MSB ? "MSB" : "LSB") << " order (" << order << ')' << endl
 	 << "    data @ " << data << endl;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
-
 element_offsets (offsets);
 array_indexed_counts (indexed_counts);
 data_order (order);
@@ -344,17 +350,15 @@ Data_Block::Data_Block
 	)
 	:	Get		(data_block.Get),
 		Put		(data_block.Put),
-		Block	(data_block.Block),
-		Offsets	(data_block.Offsets),
-		Counts	(data_block.Counts),
-		Native	(data_block.Native)
+		Block		(data_block.Block),
+		Structure	(data_block.Structure),
+		Native		(data_block.Native),
+		Saturate	(data_block.Saturate)
 {
 #if ((DEBUG) & DEBUG_CONSTRUCTORS)
 clog << ">-< Data_Block::constructor: copy -" << endl
 	 << data_block;
 #endif
-Offsets.reserve (INITIAL_CAPACITY);
-Counts.reserve  (INITIAL_CAPACITY);
 }
 
 Data_Block&
@@ -369,12 +373,12 @@ if (&data_block != this)
 	clog << ">-< Data_Block::constructor: copy -" << endl
 		 << data_block;
 	#endif
-	Block	= data_block.Block;
-	Offsets	= data_block.Offsets;
-	Counts	= data_block.Counts;
-	Native	= data_block.Native;
-	Get		= data_block.Get;
-	Put		= data_block.Put;
+	Block		= data_block.Block;
+	Structure	= data_block.Structure;
+	Native		= data_block.Native;
+	Saturate	= data_block.Saturate;
+	Get			= data_block.Get;
+	Put			= data_block.Put;
 	}
 return *this;
 }
@@ -385,47 +389,96 @@ return *this;
 Data_Block::~Data_Block ()
 {}
 
-/*==============================================================================
-	Accessors
+/*..............................................................................
+	Shared structure
 */
-namespace
+Data_Block::Layout::Layout ()
+	:	Lookup (NULL)
 {
-void
-bubble_sort
+Offsets.reserve (INITIAL_CAPACITY);
+Counts.reserve  (INITIAL_CAPACITY);
+}
+
+
+Data_Block::Layout::Layout
 	(
-	Data_Block::Index*	offsets,
-	Data_Block::Index	count
+	const Layout&	layout
 	)
+	:	Offsets (layout.Offsets),
+		Counts (layout.Counts),
+		Formats (layout.Formats),
+		Lookup (NULL)
+{}
+
+
+Data_Block::Layout::~Layout ()
+{
+delete [] Lookup.load ();
+}
+
+
+const Data_Block::Index*
+Data_Block::Layout::lookup () const
 {
-if (count > 1)
+const Index
+	*table = Lookup.load (std::memory_order_acquire);
+if (table ||
+	Counts.empty () ||
+	Offsets[Counts.size ()] > LOOKUP_LIMIT)
+	return table;
+
+Index
+	end = Offsets[Counts.size ()],
+	*entries = new Index[end ? end : 1],
+	offset = 0,
+	element;
+while (offset < Offsets[0])
+	entries[offset++] = NO_INDEX;
+for (element = 0;
+	 element < Counts.size ();
+	 element++)
+	while (offset < Offsets[element + 1])
+		entries[offset++] = element;
+
+//	Another thread may have built the same table.
+if (! Lookup.compare_exchange_strong (table, entries,
+		std::memory_order_acq_rel, std::memory_order_acquire))
 	{
-	Data_Block::Index
-		*first = offsets,
-		*last  = offsets + count,
-		*bubble,
-		*element;
-	for (--last;
-		 first != last;
-		 --last)
-		{
-		bubble = first;
-		do
-			{
-			element = bubble++;
-			if (*bubble < *element)
-				{
-				Data_Block::Index
-					value = *bubble;
-				*bubble = *element;
-				*element = value;
-				}
-			}
-			while (bubble != last);
-		}
+	delete [] entries;
+	return table;
 	}
+return entries;
+}
+
+
+void
+Data_Block::Layout::invalidate ()
+{
+delete [] Lookup.exchange (NULL);
 }
 
 
+void
+Data_Block::unshare ()
+{
+if (Structure.reference_count () > 1)
+	{
+	#if ((DEBUG) & DEBUG_ACCESSORS)
+	clog << ">-< Data_Block::unshare: "
+			<< Structure.reference_count () << " references" << endl;
+	#endif
+	Structure = new Layout (*Structure);
+	}
+else
+	//	The structure is about to change.
+	Structure->invalidate ();
+}
+
+/*==============================================================================
+	Accessors
+*/
+namespace
+{
 bool
 multiple_of
 	(
@@ -519,6 +572,7 @@ Data_Block::element_offsets
 #if ((DEBUG) & DEBUG_OFFSETS)
 clog << ">>> Data_Block::element_offsets: " << (int)total_elements << endl;
 #endif
+unshare ();
 if (total_elements == NO_INDEX)
 	{
 	//	Count the offsets.
@@ -560,8 +614,9 @@ if (! total_elements ||
 	! offsets)
 	{
 	//	Empty the data block of elements.
-	Offsets.clear ();
-	Counts.clear ();
+	Structure->Offsets.clear ();
+	Structure->Counts.clear ();
+	Structure->Formats.clear ();
 	#if ((DEBUG) & DEBUG_OFFSETS)
 	clog << "    Empty." << endl
 		 << "<<< Data_Block::element_offseets:" << endl;
@@ -570,25 +625,28 @@ if (! total_elements ||
 	}
 
 //	Possible change to the number of elements.
-Offsets.resize (total_elements + 1);
-Counts.resize (total_elements, (Index)1);
+Structure->Offsets.resize (total_elements + 1);
+Structure->Counts.resize (total_elements, (Index)1);
+if (Structure->Formats.size () > total_elements)
+	Structure->Formats.resize (total_elements);
 
-if (offsets != &Offsets[0])
+if (offsets != &Structure->Offsets[0])
 	//	Copy in the new offset values.
-	memcpy (&Offsets[0], offsets, (total_elements + 1) * sizeof (Index));
+	memcpy (&Structure->Offsets[0], offsets,
+		(total_elements + 1) * sizeof (Index));
 
 //	Sort them into increasing order.
-sort (Offsets.begin (), Offsets.end ());
+sort (Structure->Offsets.begin (), Structure->Offsets.end ());
 
 //	Reset the array counts that are no longer valid.
 bool
 	counts_reset = reset_counts (false);
 
 #if ((DEBUG) & DEBUG_OFFSETS)
-clog << "    Offsets of " << Counts.size () << " elements:";
+clog << "    Offsets of " << Structure->Counts.size () << " elements:";
 for (unsigned int
 		count = 0;
-		count < Counts.size ();
+		count < Structure->Counts.size ();
 		count++)
 	{
 	if (count % 10)
@@ -600,11 +658,11 @@ for (unsigned int
 		clog << endl
 			 << "    ";
 		}
-	clog << setw (4) << Offsets[count];
+	clog << setw (4) << Structure->Offsets[count];
 	}
 clog << endl;
-if (Counts.size ())
-	clog << "    < " << Offsets[Counts.size ()] << endl;
+if (Structure->Counts.size ())
+	clog << "    < " << Structure->Offsets[Structure->Counts.size ()] << endl;
 clog << "<<< Data_Block::element_offsets: counts reset - "
 		<< boolalpha << counts_reset << endl;
 #endif
@@ -623,7 +681,10 @@ if (offsets.size () == 1)
 		(
 		string (ID) + '\n' +
 		"Unable to set element offsets with a vector of only one value.");
-return element_offsets (&offsets[0], offsets.size ());
+if (offsets.empty ())
+	return element_offsets (NULL, 0);
+//	The last offset is the end-of-elements offset.
+return element_offsets (&offsets[0], offsets.size () - 1);
 }
 
 
@@ -637,6 +698,7 @@ Data_Block::element_sizes
 #if ((DEBUG) & DEBUG_OFFSETS)
 clog << ">>> Data_Block::element_sizes: " << (int)total_elements << endl;
 #endif
+unshare ();
 if (total_elements == NO_INDEX)
 	{
 	//	Count the sizes.
@@ -649,8 +711,9 @@ if (! total_elements ||
 	! sizes)
 	{
 	//	Empty the data block of elements.
-	Offsets.clear ();
-	Counts.clear ();
+	Structure->Offsets.clear ();
+	Structure->Counts.clear ();
+	Structure->Formats.clear ();
 	#if ((DEBUG) & DEBUG_OFFSETS)
 	clog << "    Empty." << endl
 		 << "<<< Data_Block::element_sizes:" << endl;
@@ -701,7 +764,7 @@ Data_Block::element_sizes
 	(
 	const Value_List&	sizes
 	)
-{return element_offsets (&sizes[0], sizes.size ());}
+{return element_sizes (sizes.empty () ? NULL : &sizes[0], sizes.size ());}
 
 
 bool
@@ -712,31 +775,33 @@ Data_Block::insert_element
 	Index	array_count
 	)
 {
+unshare ();
 if (array_count == 0)
 	array_count = 1;
 
 bool
 	count_reset = false;
 Value_List::iterator
-	element = lower_bound (Offsets.begin (), Offsets.end (), offset);
+	element = lower_bound
+		(Structure->Offsets.begin (), Structure->Offsets.end (), offset);
 Index
-	index = element - Offsets.begin ();
+	index = element - Structure->Offsets.begin ();
 if (index)
 	{
 	//	There is a preceeding element.
-	if (index >= Counts.size ())
+	if (index >= Structure->Counts.size ())
 		{
 		//	Append the new element.
-		Offsets.push_back (offset + size);	//	New end-of_elements offset.
-		Counts.push_back (array_count);
-		if (index > Counts.size () ||	//	After end-of-elements (lengthen).
+		Structure->Offsets.push_back (offset + size);	//	New end-of_elements offset.
+		Structure->Counts.push_back (array_count);
+		if (index > Structure->Counts.size () ||	//	After end-of-elements (lengthen).
 			*element != offset)			//	Not continguous append (shorten).
 			{
 			//	Reset former end-of-elements offset.
-			if (index > Counts.size ())
+			if (index > Structure->Counts.size ())
 				--index;
-			Offsets[index] = offset;	//	New element offset.
-			Counts[--index] = 1;	//	Reset the previous element array count.
+			Structure->Offsets[index] = offset;	//	New element offset.
+			Structure->Counts[--index] = 1;	//	Reset the previous element array count.
 			count_reset = true;
 			}
 		return count_reset;
@@ -744,20 +809,23 @@ if (index)
 	if (*element != offset)
 		{
 		//	Not at an existing element offset.
-		Counts[index - 1] = 1;	//	Reset the previous element array count.
+		Structure->Counts[index - 1] = 1;	//	Reset the previous element array count.
 		count_reset = true;
 		}
 	}
 
 //	Insert the new element.
-element = Offsets.insert (element, offset);
+element = Structure->Offsets.insert (element, offset);
 
 //	Shift the following elements up.
-while (++element != Offsets.end ())
+while (++element != Structure->Offsets.end ())
 	*element += size;
 
 //	Insert the new array count.
-Counts.insert (Counts.begin () + index, array_count);
+Structure->Counts.insert (Structure->Counts.begin () + index, array_count);
+if (index < Structure->Formats.size ())
+	Structure->Formats.insert
+		(Structure->Formats.begin () + index, UNSPECIFIED_FORMAT);
 
 return count_reset;
 }
@@ -769,30 +837,33 @@ Data_Block::delete_element
 	Index	element
 	)
 {
-if (element >= Counts.size ())
+unshare ();
+if (element >= Structure->Counts.size ())
 	{
 	ostringstream
 		message;
 	message << ID << endl
 			<< "Can't delete element " << element << " -" << endl
-			<< "Invalid element (of " << Counts.size () << ").";
+			<< "Invalid element (of " << Structure->Counts.size () << ").";
 	throw out_of_range (message.str ());
 	}
 
 //	Delete the array count.
-Counts.erase (Counts.begin () + element);
+Structure->Counts.erase (Structure->Counts.begin () + element);
+if (element < Structure->Formats.size ())
+	Structure->Formats.erase (Structure->Formats.begin () + element);
 
 //	Size of the deleted element.
 Index
-	size = Offsets[element + 1] - Offsets[element];
+	size = Structure->size_of (element);
 
 //	Delete the element offset.
-Offsets.erase (Offsets.begin () + element);
+Structure->Offsets.erase (Structure->Offsets.begin () + element);
 
 if (size)
 	//	Shift the following elements down.
-	while (element < Offsets.size ())
-		Offsets[element++] -= size;
+	while (element < Structure->Offsets.size ())
+		Structure->Offsets[element++] -= size;
 
 return *this;
 }
@@ -806,13 +877,13 @@ Data_Block::offset_of
 	)
 	const
 {
-if (element < Counts.size ())
-	return Offsets[element];
+if (element < Structure->Counts.size ())
+	return Structure->Offsets[element];
 ostringstream
 	message;
 message << ID << endl
 		<< "Can't get the offset of element " << element << " -" << endl
-		<< "Invalid element (of " << Counts.size () << ").";
+		<< "Invalid element (of " << Structure->Counts.size () << ").";
 throw out_of_range (message.str ());
 }
 
@@ -824,29 +895,64 @@ Data_Block::offset_of
 	Index	offset
 	)
 {
-if (element >= Counts.size ())
+unshare ();
+if (element >= Structure->Counts.size ())
 	{
 	ostringstream
 		message;
 	message << ID << endl
 			<< "Can't set the offset of element " << element
 			<< " to " << offset << " -" << endl
-			<< "Invalid element (of " << Counts.size () << ").";
+			<< "Invalid element (of " << Structure->Counts.size () << ").";
 	throw out_of_range (message.str ());
 	}
-if (offset > Offsets[Counts.size ()])
+if (offset > size ())
 	{
 	ostringstream
 		message;
 	message << ID << endl
 			<< "Can't set offset of element " << element
 			<< " to " << offset << " -" << endl
-			<< "Invalid offset (max " << Offsets[Counts.size ()] << ").";
+			<< "Invalid offset (max " << size () << ").";
 	throw length_error (message.str ());
 	}
 
-Offsets[element] = offset;
-sort (Offsets.begin (), Offsets.end ());
+/*	Relocate the element offset entry to its ordered position.
+
+	The other offsets are already in order so only the entries between
+	the old and new positions need to be moved.
+*/
+Value_List::iterator
+	begin = Structure->Offsets.begin (),
+	entry = begin + element,
+	first = entry,
+	middle = entry,
+	last = entry;
+*entry = offset;
+if (entry != begin &&
+	offset < *(entry - 1))
+	{
+	first = upper_bound (begin, entry, offset);
+	last = entry + 1;
+	}
+else if (offset > *(entry + 1))
+	{
+	middle = entry + 1;
+	last = lower_bound (entry + 1, Structure->Offsets.end (), offset);
+	}
+if (first != last)
+	{
+	rotate (first, middle, last);
+	//	The element value formats move with their offsets.
+	if (! Structure->Formats.empty ())
+		{
+		Structure->Formats.resize
+			(Structure->Counts.size (), UNSPECIFIED_FORMAT);
+		rotate (Structure->Formats.begin () + (first - begin),
+			Structure->Formats.begin () + (middle - begin),
+			Structure->Formats.begin () + (last - begin));
+		}
+	}
 return reset_counts (true);
 }
 
@@ -857,22 +963,23 @@ Data_Block::shift_offsets
 	int		amount
 	)
 {
+unshare ();
 if (amount &&
-	Counts.size ())
+	Structure->Counts.size ())
 	{
 	if (amount < 0 &&
-		(Index)-amount > Offsets[0])
+		(Index)-amount > Structure->Offsets[0])
 		{
 		ostringstream
 			message;
 		message << ID << endl
 				<< "Attempt to shift offsets by " << amount << endl
-				<< "when the first offset is " << Offsets[0] << '.';
+				<< "when the first offset is " << Structure->Offsets[0] << '.';
 		throw invalid_argument (message.str ());
 		}
 	for (Value_List::iterator
-			value = Offsets.begin ();
-			value < Offsets.end ();
+			value = Structure->Offsets.begin ();
+			value < Structure->Offsets.end ();
 		  ++value)
 		*value += amount;
 	}
@@ -889,13 +996,13 @@ Data_Block::size_of
 	)
 	const
 {
-if (element < Counts.size ())
-	return Offsets[element + 1] - Offsets[element];
+if (element < Structure->Counts.size ())
+	return Structure->size_of (element);
 ostringstream
 	message;
 message << ID << endl
 		<< "Can't get the size of element " << element << " -" << endl
-		<< "Invalid element (of " << Counts.size () << ").";
+		<< "Invalid element (of " << Structure->Counts.size () << ").";
 throw out_of_range (message.str ());
 }
 
@@ -907,32 +1014,33 @@ Data_Block::size_of
 	Index	size
 	)
 {
-if (element >= Counts.size ())
+unshare ();
+if (element >= Structure->Counts.size ())
 	{
 	ostringstream
 		message;
 	message << ID << endl
 			<< "Can't set the size of element " << element
 			<< " to " << size << " -" << endl
-			<< "Invalid element (of " << Counts.size () << ").";
+			<< "Invalid element (of " << Structure->Counts.size () << ").";
 	throw out_of_range (message.str ());
 	}
 bool
 	counts_reset = false;
 int
-	difference = size - (Offsets[element + 1] - Offsets[element]);
+	difference = size - Structure->size_of (element);
 if (difference)
 	{
 	if (! size ||
-		! multiple_of (size, Counts[element]))
+		! multiple_of (size, Structure->Counts[element]))
 		{
 		//	The array value count became invalid; reset it.
-		Counts[element] = 1;
+		Structure->Counts[element] = 1;
 		counts_reset = true;
 		}
 	//	Shift offsets of elements beyond the current element.
-	while (++element <= Counts.size ())
-		Offsets[element] += difference;
+	while (++element <= Structure->Counts.size ())
+		Structure->Offsets[element] += difference;
 	}
 return counts_reset;
 }
@@ -945,13 +1053,13 @@ Data_Block::value_size_of
 	)
 	const
 {
-if (element < Counts.size ())
-	return (Offsets[element + 1] - Offsets[element]) / Counts[element];
+if (element < Structure->Counts.size ())
+	return Structure->value_size_of (element);
 ostringstream
 	message;
 message << ID << endl
 		<< "Can't get value size of element " << element << " -" << endl
-		<< "Invalid element (of " << Counts.size () << ").";
+		<< "Invalid element (of " << Structure->Counts.size () << ").";
 throw out_of_range (message.str ());
 }
 
@@ -975,19 +1083,32 @@ Data_Block::index_of
 	)
 	const
 {
+const Index
+	*table = Structure->lookup ();
+if (table)
+	{
+	Index
+		element;
+	if (offset < Structure->Offsets[Structure->Counts.size ()] &&
+		(element = table[offset]) != NO_INDEX &&
+		Structure->Offsets[element] == offset)
+		return element;
+	return NO_INDEX;
+	}
+
 //	Search using a binary tree algorithm.
 Index
 	low_index = 0,
 	middle_index,
 	half_length,
-	length = Counts.size ();
+	length = Structure->Counts.size ();
 while (length)
 	{
 	half_length = length >> 1;
 	middle_index = low_index + half_length;
-	if (Offsets[middle_index] == offset)
+	if (Structure->Offsets[middle_index] == offset)
 		return middle_index;
-	else if (Offsets[middle_index] < offset)
+	else if (Structure->Offsets[middle_index] < offset)
 		{
 		low_index = ++middle_index;
 		length -= ++half_length;
@@ -998,6 +1119,31 @@ while (length)
 return NO_INDEX;
 }
 
+
+Data_Block::Index
+Data_Block::element_containing
+	(
+	Index	offset
+	)
+	const
+{
+Index
+	elements = Structure->Counts.size ();
+if (! elements ||
+	offset < Structure->Offsets[0] ||
+	offset >= Structure->Offsets[elements])
+	return NO_INDEX;
+const Index
+	*table = Structure->lookup ();
+if (table)
+	return table[offset];
+
+//	The last element that starts at or before the offset.
+return (Index)(upper_bound (Structure->Offsets.begin (),
+	Structure->Offsets.begin () + elements, offset)
+	- Structure->Offsets.begin ()) - 1;
+}
+
 /*------------------------------------------------------------------------------
 	Array value counts
 */
@@ -1008,17 +1154,17 @@ Data_Block::count_of
 	)
 	const
 {
-if (element < Counts.size ())
+if (element < Structure->Counts.size ())
 	{
-	if (Offsets[element + 1] - Offsets[element])
-		return Counts[element];
+	if (Structure->size_of (element))
+		return Structure->Counts[element];
 	return 0;
 	}
 ostringstream
 	message;
 message << ID << endl
 		<< "Can't get the count of element " << element << " -" << endl
-		<< "Invalid element (of " << Counts.size () << ").";
+		<< "Invalid element (of " << Structure->Counts.size () << ").";
 throw out_of_range (message.str ());
 }
 
@@ -1030,17 +1176,18 @@ Data_Block::count_of
 	Index	count
 	)
 {
-if (element >= Counts.size ())
+unshare ();
+if (element >= Structure->Counts.size ())
 	{
 	ostringstream
 		message;
 	message << ID << endl
 			<< "Can't set the array count of element " << element
 				<< " to " << count << '.' << endl
-			<< "Invalid element (of " << Counts.size () << ").";
+			<< "Invalid element (of " << Structure->Counts.size () << ").";
 	throw out_of_range (message.str ());
 	}
-if (! multiple_of (Offsets[element + 1] - Offsets[element], count))
+if (! multiple_of (Structure->size_of (element), count))
 	{
 	//	The count doesn't fit the element size.
 	ostringstream
@@ -1048,12 +1195,12 @@ if (! multiple_of (Offsets[element + 1] - Offsets[element], count))
 	message << ID << endl
 			<< "Can't set the array count of element " << element << endl
 			<< "because the element size of "
-				<< (Offsets[element + 1] - Offsets[element]) << endl
+				<< Structure->size_of (element) << endl
 			<< "is not a multiple of value count " << count << '.';
 	throw length_error (message.str ());
 	}
-if (! (Counts[element] = count))
-	   Counts[element] = 1;
+if (! (Structure->Counts[element] = count))
+	   Structure->Counts[element] = 1;
 return *this;
 }
 
@@ -1066,8 +1213,9 @@ Data_Block::reset_counts
 	Index	end
 	)
 {
-if (end > Counts.size ())
-	end = Counts.size ();
+unshare ();
+if (end > Structure->Counts.size ())
+	end = Structure->Counts.size ();
 if (begin > end)
 	{
 	ostringstream
@@ -1084,17 +1232,19 @@ if (unconditional)
 			index = begin;
 			index < end;
 		  ++index)
-		if (Counts[index] != 1)
-			counts_reset = (Counts[index] = 1);
+		{
+		if (Structure->Counts[index] != 1)
+			counts_reset = (Structure->Counts[index] = 1);
+		}
 else
 	for (Index
 			index = begin;
 			index < end;
 		  ++index)
-		if (! Counts[index] ||
+		if (! Structure->Counts[index] ||
 			! multiple_of
-				(Offsets[index + 1] - Offsets[index], Counts[index]))
-			counts_reset = (Counts[index] = 1);
+				(Structure->size_of (index), Structure->Counts[index]))
+			counts_reset = (Structure->Counts[index] = 1);
 return counts_reset;
 }
 
@@ -1110,8 +1260,9 @@ Data_Block::array_counts
 #if ((DEBUG) & DEBUG_COUNTS)
 clog << ">>> Data_Block::array_counts: [" << begin << ',' << end << ')' << endl;
 #endif
-if (end > Counts.size ())
-	end = Counts.size ();
+unshare ();
+if (end > Structure->Counts.size ())
+	end = Structure->Counts.size ();
 if (begin > end)
 	{
 	ostringstream
@@ -1145,11 +1296,11 @@ for (element = begin;
 	#if ((DEBUG) & DEBUG_COUNTS)
 	clog << "    element " << element
 			<< ", size = "
-				<< setw (4) << (Offsets[element + 1] - Offsets[element])
+				<< setw (4) << Structure->size_of (element)
 			<< ", count = "
 				<< setw (4) << *array << endl;
 	#endif
-	if (! multiple_of (Offsets[element + 1] - Offsets[element], *array++))
+	if (! multiple_of (Structure->size_of (element), *array++))
 		{
 		//	The count doesn't fit the element size.
 		ostringstream
@@ -1157,7 +1308,7 @@ for (element = begin;
 		message << ID << endl
 				<< "Can't set array counts at element " << element << endl
 				<< "because the element size of "
-					<< (Offsets[element + 1] - Offsets[element]) << endl
+					<< Structure->size_of (element) << endl
 				<< "is not a multiple of value count " << *(--array) << '.';
 		throw length_error (message.str ());
 		}
@@ -1168,8 +1319,8 @@ array = counts;
 for (element = begin;
 	 element < end;
    ++element)
-	if (! (Counts[element] = *array++))
-		   Counts[element] = 1;
+	if (! (Structure->Counts[element] = *array++))
+		   Structure->Counts[element] = 1;
 	
 #if ((DEBUG) & DEBUG_COUNTS)
 clog << "<<< Data_Block::array_counts" << endl;
@@ -1197,6 +1348,7 @@ Data_Block::array_offset_counts
 #if ((DEBUG) & DEBUG_COUNTS)
 clog << ">>> Data_Block::array_offset_counts: " << (int)total_counts << endl;
 #endif
+unshare ();
 if (! offset_counts)
 	{
 	reset_counts (true);
@@ -1238,7 +1390,7 @@ for (count = 0;
 		throw invalid_argument (message.str ());
 		}
 
-	if (! multiple_of (Offsets[index[count] + 1] - Offsets[index[count]],
+	if (! multiple_of (Structure->size_of (index[count]),
 			offset_counts[count][OFFSET_COUNT]))
 		{
 		//	The count doesn't fit the element size.
@@ -1250,7 +1402,7 @@ for (count = 0;
 					<< " at offset "
 					<< offset_counts[count][ELEMENT_OFFSET] << endl
 				<< "because the element size of "
-					<< (Offsets[index[count] + 1] - Offsets[index[count]]) << endl
+					<< Structure->size_of (index[count]) << endl
 				<< "is not a multiple of value count "
 					<< offset_counts[count][OFFSET_COUNT] << '.';
 		throw length_error (message.str ());
@@ -1261,8 +1413,8 @@ for (count = 0;
 for (count = 0;
 	 count < total_counts;
    ++count)
-	if (! (Counts[index[count]] = offset_counts[count][OFFSET_COUNT]))
-		   Counts[index[count]] = 1;
+	if (! (Structure->Counts[index[count]] = offset_counts[count][OFFSET_COUNT]))
+		   Structure->Counts[index[count]] = 1;
 
 delete[] index;
 #if ((DEBUG) & DEBUG_COUNTS)
@@ -1282,6 +1434,7 @@ Data_Block::array_indexed_counts
 #if ((DEBUG) & DEBUG_COUNTS)
 clog << ">>> Data_Block::array_indexed_counts: " << (int)total_counts << endl;
 #endif
+unshare ();
 if (! indexed_counts)
 	{
 	reset_counts (true);
@@ -1306,18 +1459,19 @@ for (count = 0;
 	 count < total_counts;
    ++count)
 	{
-	if ((index = indexed_counts[count][ELEMENT_INDEX]) >= Counts.size ())
+	if ((index = indexed_counts[count][ELEMENT_INDEX])
+			>= Structure->Counts.size ())
 		{
 		ostringstream
 			message;
 		message << ID << endl
 				<< "Can't set the array count for element "
 					<< index << " -"  << endl
-				<< "Invalid element (of " << Counts.size () << ").";
+				<< "Invalid element (of " << Structure->Counts.size () << ").";
 		throw out_of_range (message.str ());
 		}
 
-	if (! multiple_of (Offsets[index + 1] - Offsets[index],
+	if (! multiple_of (Structure->size_of (index),
 			indexed_counts[count][INDEX_COUNT]))
 		{
 		//	The count doesn't fit the element size.
@@ -1326,7 +1480,7 @@ for (count = 0;
 		message << ID << endl
 				<< "Can't set the array count for element " << index << endl
 				<< "because the element size of "
-					<< (Offsets[index + 1] - Offsets[index]) << endl
+					<< Structure->size_of (index) << endl
 				<< "is not a multiple of value count "
 					<< indexed_counts[count][INDEX_COUNT] << '.';
 		throw length_error (message.str ());
@@ -1337,15 +1491,110 @@ for (count = 0;
 for (count = 0;
 	 count < total_counts;
    ++count)
-	if (! (Counts[indexed_counts[count][ELEMENT_INDEX]]
+	if (! (Structure->Counts[indexed_counts[count][ELEMENT_INDEX]]
 			= indexed_counts[count][INDEX_COUNT]))
-		   Counts[indexed_counts[count][ELEMENT_INDEX]] = 1;
+		   Structure->Counts[indexed_counts[count][ELEMENT_INDEX]] = 1;
 #if ((DEBUG) & DEBUG_COUNTS)
 clog << "<<< Data_Block::array_indexed_counts" << endl;
 #endif
 return *this;
 }
 
+/*------------------------------------------------------------------------------
+	Value formats
+*/
+Data_Block::Value_Format
+Data_Block::value_format
+	(
+	Index	element
+	)
+	const
+{
+if (element < Structure->Counts.size ())
+	return (element < Structure->Formats.size ()) ?
+		Structure->Formats[element] : UNSPECIFIED_FORMAT;
+ostringstream
+	message;
+message << ID << endl
+		<< "Can't get the value format of element " << element << " -" << endl
+		<< "Invalid element (of " << Structure->Counts.size () << ").";
+throw out_of_range (message.str ());
+}
+
+
+Data_Block&
+Data_Block::value_format
+	(
+	Index			element,
+	Value_Format	format
+	)
+{
+unshare ();
+if (element >= Structure->Counts.size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't set the value format of element " << element << " -" << endl
+			<< "Invalid element (of " << Structure->Counts.size () << ").";
+	throw out_of_range (message.str ());
+	}
+if (! value_format_fits (format, Structure->value_size_of (element)))
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't set the value format of element " << element << endl
+			<< "because the element value size of "
+				<< Structure->value_size_of (element) << endl
+			<< "does not fit the format.";
+	throw length_error (message.str ());
+	}
+if (element >= Structure->Formats.size ())
+	{
+	if (format == UNSPECIFIED_FORMAT)
+		return *this;
+	Structure->Formats.resize (element + 1, UNSPECIFIED_FORMAT);
+	}
+Structure->Formats[element] = format;
+return *this;
+}
+
+
+Data_Block::Index
+Data_Block::value_format_size
+	(
+	Value_Format	format
+	)
+{
+switch (format)
+	{
+	case VAX_REAL:
+	case IBM_REAL:
+		return REAL_VALUE_SIZE;
+	case VAX_DOUBLE:
+	case IBM_DOUBLE:
+		return DOUBLE_VALUE_SIZE;
+	default:
+		return 0;
+	}
+}
+
+
+bool
+Data_Block::value_format_fits
+	(
+	Value_Format	format,
+	Index			size
+	)
+{
+if (format == UNSPECIFIED_FORMAT)
+	return true;
+if (integer_format (format))
+	return size >= 1 && size <= 8;
+return size == value_format_size (format);
+}
+
 /*==============================================================================
 	I/O
 */
@@ -1673,6 +1922,151 @@ clog << "<<< Data_Block::put_backwards" << endl;
 #endif
 }
 
+/*..............................................................................
+	Formatted data movers.
+*/
+double
+Data_Block::get_formatted
+	(
+	Value_Format			format,
+	const unsigned char*	data
+	)
+{
+switch (format)
+	{
+	case VAX_REAL:		return VAX_real_to_IEEE (data);
+	case VAX_DOUBLE:	return VAX_double_to_IEEE (data);
+	case IBM_REAL:		return IBM_real_to_IEEE (data);
+	case IBM_DOUBLE:	return IBM_double_to_IEEE (data);
+	default:			return 0.0;
+	}
+}
+
+
+void
+Data_Block::get_formatted
+	(
+	Value_Format			format,
+	const unsigned char*	data,
+	float*					values,
+	Index					count,
+	Index					stride
+	)
+{
+if (! stride)
+	stride = value_format_size (format);
+switch (format)
+	{
+	case VAX_REAL:	VAX_real_to_IEEE (data, values, count, stride);	break;
+	case IBM_REAL:	IBM_real_to_IEEE (data, values, count, stride);	break;
+	default:
+		while (count--)
+			{
+			*values++ = (float)get_formatted (format, data);
+			data += stride;
+			}
+	}
+}
+
+
+void
+Data_Block::get_formatted
+	(
+	Value_Format			format,
+	const unsigned char*	data,
+	double*					values,
+	Index					count,
+	Index					stride
+	)
+{
+if (! stride)
+	stride = value_format_size (format);
+switch (format)
+	{
+	case VAX_DOUBLE:	VAX_double_to_IEEE (data, values, count, stride);	break;
+	case IBM_DOUBLE:	IBM_double_to_IEEE (data, values, count, stride);	break;
+	default:
+		while (count--)
+			{
+			*values++ = get_formatted (format, data);
+			data += stride;
+			}
+	}
+}
+
+
+void
+Data_Block::put_formatted
+	(
+	Value_Format			format,
+	unsigned char*			data,
+	double					value
+	)
+{
+switch (format)
+	{
+	case VAX_REAL:		IEEE_to_VAX_real ((float)value, data);		break;
+	case VAX_DOUBLE:	IEEE_to_VAX_double (value, data);			break;
+	case IBM_REAL:		IEEE_to_IBM_real ((float)value, data);		break;
+	case IBM_DOUBLE:	IEEE_to_IBM_double (value, data);			break;
+	default:			break;
+	}
+}
+
+
+void
+Data_Block::put_formatted
+	(
+	Value_Format			format,
+	unsigned char*			data,
+	const float*			values,
+	Index					count
+	)
+{
+switch (format)
+	{
+	case VAX_REAL:	IEEE_to_VAX_real (values, data, count);	break;
+	case IBM_REAL:	IEEE_to_IBM_real (values, data, count);	break;
+	default:
+		{
+		Index
+			amount = value_format_size (format);
+		while (count--)
+			{
+			put_formatted (format, data, *values++);
+			data += amount;
+			}
+		}
+	}
+}
+
+
+void
+Data_Block::put_formatted
+	(
+	Value_Format			format,
+	unsigned char*			data,
+	const double*			values,
+	Index					count
+	)
+{
+switch (format)
+	{
+	case VAX_DOUBLE:	IEEE_to_VAX_double (values, data, count);	break;
+	case IBM_DOUBLE:	IEEE_to_IBM_double (values, data, count);	break;
+	default:
+		{
+		Index
+			amount = value_format_size (format);
+		while (count--)
+			{
+			put_formatted (format, data, *values++);
+			data += amount;
+			}
+		}
+	}
+}
+
 /*..............................................................................
 	Stream data movers.
 */
@@ -1731,7 +2125,7 @@ Data_Block::print
 	const
 {
 unsigned int
-	elements = Counts.size ();
+	elements = Structure->Counts.size ();
 stream
 	<< "Data_Block @" << (void*)Block
 		<< ", " << (data_order () == MSB ? "MSB" : "LSB")
@@ -1748,10 +2142,10 @@ if (elements)
 		  ++element)
 		stream
 			<< setw (7)  << element
-			<< setw (11) << Offsets[element]
-			<< setw (11) << Counts[element] << endl;
+			<< setw (11) << Structure->Offsets[element]
+			<< setw (11) << Structure->Counts[element] << endl;
 	stream
-		<< setw (7) << "Size" << setw (11) << Offsets[Counts.size ()] << endl;
+		<< setw (7) << "Size" << setw (11) << size () << endl;
 	}
 return stream;
 }
@@ -1881,7 +2275,7 @@ if (! total_elements)
 	}
 
 //	Sort the offset values; include the end-of-elements offset.
-bubble_sort (offsets, total_elements + 1);
+sort (offsets, offsets + total_elements + 1);
 
 #if ((DEBUG) & DEBUG_OFFSETS)
 clog << "    " << total_elements << " offsets:" << endl;
@@ -1953,7 +2347,7 @@ if (! Block)
 			<< " attempted without any data storage available.";
 	throw logic_error (message.str ());
 	}
-if (element >= Counts.size ())
+if (element >= Structure->Counts.size ())
 	{
 	ostringstream
 		message;
@@ -1961,10 +2355,10 @@ if (element >= Counts.size ())
 			<< (getter ? "Get" : "Put")
 			<< (array ? " array" : " ")
 			<< " element " << element << " exceeds the limit of "
-			<< Counts.size () << " elements.";
+			<< Structure->Counts.size () << " elements.";
 	throw out_of_range (message.str ());
 	}
-if (entry >= Counts[element])
+if (entry >= Structure->Counts[element])
 	{
 	ostringstream
 		message;
@@ -1972,7 +2366,7 @@ if (entry >= Counts[element])
 			<< (getter ? "Get" : "Put") 
 			<< " array " << (array ? "count" : "index")
 			<< ' ' << entry << " exceeds the limit of "
-			<< Counts[element] << " entries for element " << element << '.';
+			<< Structure->Counts[element] << " entries for element " << element << '.';
 	throw out_of_range (message.str ());
 	}
 }
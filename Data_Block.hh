@@ -23,9 +23,13 @@ Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
 #define _Data_Block_
 
 #include	"endian.hh"
+#include	"Reference_Counted_Pointer.hh"
+#include	"Value_Conversion.hh"
 
 #include	<iostream>
 #include	<vector>
+#include	<atomic>
+#include	<type_traits>
 
 /**	The Planetary Image Research Laboratory.
 
@@ -71,6 +75,15 @@ namespace PIRL
 	native host order, in which case data transfers between the data
 	block and application variables will reverse the byte order.
 
+	Elements holding floating point values in the VAX or IBM formats
+	found in archival data may be given a {@link value_format(Index,
+	Value_Format) value format}; their values are converted to and from
+	the host IEEE format when transferred to or from application
+	arithmetic variables. Likewise, elements may be identified as
+	holding signed or unsigned integers so their values are sign
+	extended, or {@link saturate(bool) saturated}, as appropriate when
+	transferred.
+
 	Typically a binary data block is managed by a struct definition.
 	The Data_Block is not a substitute for a struct. The Data_Block
 	offers special capabilities:
@@ -130,6 +143,13 @@ namespace PIRL
 	data structure description owned by the Data_Block.
 </dl>
 
+	The structure description - the element offsets, array counts and
+	value formats - is shared by copies of a Data_Block. Copying or
+	assigning a Data_Block only copies a reference to the structure; the
+	structure itself is copied when a Data_Block that shares it is
+	modified. Thus creating many views of a data block with the same
+	structure is inexpensive.
+
 @author		Bradford Castalia, UA/PIRL, 12/03
 
 $Revision: 1.37 $ 
@@ -212,6 +232,47 @@ enum Array_Offset_Counts
 //!	For backwards compatibility (deprecated).
 #define OFFSET_COUNTS OFFSET_COUNT
 
+/**	Element value formats.
+
+	By default the format of element values is unspecified: the value
+	bytes are transferred without conversion in the data order of the
+	Data_Block. When the data element value is larger than a host
+	variable its high order bytes are dropped, and when it is smaller
+	the variable's high order bytes are zero filled.
+
+	An element may be given an integer value format of any size from 1
+	to 8 bytes. Its values, in the data order of the Data_Block, are
+	converted to or from host arithmetic variables: signed values are
+	sign extended when widened, narrowed values are {@link
+	saturate(bool) optionally saturated}, and floating point variables
+	receive or provide the numeric value.
+
+	An element may also be given a floating point value format that is
+	not the host IEEE format; its values are converted when they are
+	transferred to or from host arithmetic variables. The byte order of
+	each of these formats is part of the format; the data order of the
+	Data_Block does not apply to them.
+
+	@see	value_format(Index, Value_Format)
+	@see	Value_Conversion.hh
+*/
+enum Value_Format
+	{
+	UNSPECIFIED_FORMAT,
+	//!	VAX F-floating, 4 bytes.
+	VAX_REAL,
+	//!	VAX D-floating, 8 bytes.
+	VAX_DOUBLE,
+	//!	IBM System/360 single precision, 4 bytes.
+	IBM_REAL,
+	//!	IBM System/360 double precision, 8 bytes.
+	IBM_DOUBLE,
+	//!	Two's complement signed integer, 1 to 8 bytes.
+	SIGNED_INTEGER,
+	//!	Unsigned integer, 1 to 8 bytes.
+	UNSIGNED_INTEGER
+	};
+
 /**	Element access limits checking.
 
 	Define the DATA_BLOCK_LIMITS_CHECK macro to be true if Element
@@ -518,6 +579,9 @@ Data_Block
 	itself. This allows a single storage area to be managed with
 	different structure definitions.
 
+	The structure definition is shared with the copied Data_Block until
+	either is modified.
+
 	@param	data_block	A reference to the Data_Block to be copied.
 */
 Data_Block (const Data_Block& data_block);
@@ -621,7 +685,8 @@ virtual Data_Block& data (void* const block);
 		beginning of the data block.
 */
 Index size () const
-	{return (Counts.size () ? Offsets[Counts.size ()] : 0);}
+	{return (Structure->Counts.size () ?
+		Structure->Offsets[Structure->Counts.size ()] : 0);}
 
 /*------------------------------------------------------------------------------
 	Element offsets
@@ -632,7 +697,7 @@ Index size () const
 		the final end-of-elements offset.
 */
 Value_List element_offsets_list () const
-	{return Offsets;}
+	{return Structure->Offsets;}
 
 /**	Gets the element offsets list of the data block structure.
 
@@ -642,13 +707,14 @@ Value_List element_offsets_list () const
 	structure inconsistencies such that subsequent operations may not
 	work correctly. The list will become invalid when the object with
 	which it is associated is deleted. Use of the structure modification
-	methods is the recommended approach.
+	methods is the recommended approach. If the structure is shared
+	with another Data_Block this Data_Block is given its own copy.
 
 	@return	A pointer to the current data block offsets list.
 	@see	element_offsets_list()
 */
 Index* element_offsets ()
-	{return &Offsets[0];}
+	{unshare (); return &Structure->Offsets[0];}
 
 /**	Sets the element offsets of the data block structure.
 
@@ -848,7 +914,7 @@ Data_Block& shift_offsets (int amount);
 		block array counts).
 */
 Index elements () const
-	{return Counts.size ();}
+	{return Structure->Counts.size ();}
 
 /**	Gets the size of a data block element.
 
@@ -907,12 +973,34 @@ Data_Block& value_size_of (Index element, Index size);
 
 /**	Gets the element index for a data block offset.
 
+	For a data block no larger than the DATA_BLOCK_LOOKUP_LIMIT (4096
+	bytes by default) the element is found with a table, built when
+	first needed, of the element containing each byte offset; the table
+	is discarded when the structure is changed. Larger data blocks are
+	searched.
+
+	<b>N.B.</b>: Direct modification of the {@link element_offsets()
+	element offsets} after an element lookup may leave the table out of
+	date.
+
 	@param	offset	The data block offset to find.
 	@return	The index of the corresponding element; or #NO_INDEX if the
 		offset value can not be found in the offsets list.
+	@see	element_containing(Index)const
 */
 Index index_of (Index offset) const;
 
+/**	Gets the index of the element that contains a data block offset.
+
+	The element is found in the same way as the #index_of element.
+
+	@param	offset	A byte offset in the data block.
+	@return	The index of the element with the offset within its extent;
+		or #NO_INDEX if the offset is before the first element or at or
+		beyond the end of the elements.
+*/
+Index element_containing (Index offset) const;
+
 /*------------------------------------------------------------------------------
 	Array value counts
 */
@@ -921,7 +1009,7 @@ Index index_of (Index offset) const;
 	@return	A vector of the current element array value counts.
 */
 Value_List array_counts_list () const
-	{return Counts;}
+	{return Structure->Counts;}
 
 /**	Gets the list of array element value counts.
 
@@ -931,12 +1019,13 @@ Value_List array_counts_list () const
 	structure inconsistencies such that subsequent operations may not
 	work correctly. The list will become invalid when the object with
 	which it is associated is deleted. Use of the structure modification
-	methods is the recommended approach.
+	methods is the recommended approach. If the structure is shared
+	with another Data_Block this Data_Block is given its own copy.
 
 	@return	A pointer to the current element counts list.
 */
 Index* array_counts ()
-	{return &Counts[0];}
+	{unshare (); return &Structure->Counts[0];}
 
 /**	Sets the count of array values for elements of the data block.
 
@@ -1072,6 +1161,89 @@ Data_Block& count_of (Index element, Index count);
 bool reset_counts (bool unconditional = true,
 	Index begin = 0, Index end = NO_INDEX);
 
+/*------------------------------------------------------------------------------
+	Value formats
+*/
+/**	Gets the value format of an element.
+
+	@param	element	The data block element to examine.
+	@return	The Value_Format of the element values.
+	@throws std::out_of_range	If an invalid element is specified.
+*/
+Value_Format value_format (Index element) const;
+
+/**	Sets the value format of an element.
+
+	The size of each element value must {@link
+	value_format_fits(Value_Format, Index) fit} the format. If the
+	element is later resized, or its array count changed, so that its
+	value size no longer matches its format, the format is ignored.
+
+	@param	element	The element for which to set the value format.
+	@param	format	The Value_Format of the element values.
+	@return	This Data_Block.
+	@throws std::out_of_range	If an invalid element is specified.
+	@throws std::length_error	If the element value size does not fit
+		the format.
+*/
+Data_Block& value_format (Index element, Value_Format format);
+
+/**	Gets the size of the values of a format.
+
+	@param	format	A Value_Format.
+	@return	The size, in bytes, of a value of the format. This will be
+		0 for the UNSPECIFIED_FORMAT and the integer formats, which may
+		have any size from 1 to 8 bytes.
+*/
+static Index value_format_size (Value_Format format);
+
+/**	Tests if a value size fits a format.
+
+	@param	format	A Value_Format.
+	@param	size	A value size in bytes.
+	@return	true if values of the format may have the size; false
+		otherwise. Any size fits the UNSPECIFIED_FORMAT.
+*/
+static bool value_format_fits (Value_Format format, Index size);
+
+/**	Tests if a format is an integer format.
+
+	@param	format	A Value_Format.
+	@return	true if the format is SIGNED_INTEGER or UNSIGNED_INTEGER.
+*/
+static bool integer_format (Value_Format format)
+	{return format == SIGNED_INTEGER || format == UNSIGNED_INTEGER;}
+
+/**	Tests if narrowed integer values are saturated.
+
+	@return	true if integer values transferred to or from elements with
+		an integer value format are saturated; false if they are
+		truncated.
+	@see	saturate(bool)
+*/
+bool saturate () const
+	{return Saturate;}
+
+/**	Sets whether narrowed integer values are saturated.
+
+	When an integer value is transferred to or from an element with an
+	integer value format and the destination is narrower than the value,
+	the value is either truncated to its low order bytes (the default)
+	or saturated: clamped to the nearest limit of the destination range.
+	A negative value saturated to an unsigned destination is zero.
+	Floating point values transferred to integer elements are always
+	saturated.
+
+	Like the data order, this setting belongs to this Data_Block and is
+	not shared with other Data_Blocks that have the same structure.
+
+	@param	enabled	true if values are to be saturated; false if they
+		are to be truncated.
+	@return	This Data_Block.
+*/
+Data_Block& saturate (bool enabled)
+	{Saturate = enabled; return *this;}
+
 /*==============================================================================
 	I/O
 */
@@ -1101,8 +1273,11 @@ Copier
 	are transferred into the least significant bytes of the variable.
 
 	<b>N.B.</b>: No type conversion is done (the data types of data
-	block elements are unknown). Transferring data between mismatched
-	type values or sizes may produced unexpected results.
+	block elements are unknown) unless the element has a {@link
+	value_format(Index, Value_Format) value format} and the type is
+	arithmetic; then the value is converted to or from the format.
+	Transferring data between mismatched type values or sizes may
+	produced unexpected results.
 
 	@param	T		The data type of the value to be assigned.
 	@param	limits_check	True if limit checking for the element and
@@ -1125,12 +1300,28 @@ if (Block)
 	if (limits_check)
 		limits_checker (element, index, true, false);
 	unsigned int
-		amount = (Offsets[element + 1] - Offsets[element]) / Counts[element];
+		amount = Structure->value_size_of (element);
+	if constexpr (std::is_arithmetic<T>::value)
+		{
+		Value_Format
+			format = Structure->format_of (element);
+		if (format != UNSPECIFIED_FORMAT)
+			{
+			const unsigned char*
+				data = Block + Structure->Offsets[element] + (amount * index);
+			if (integer_format (format))
+				integers_to_values (data, amount, format == SIGNED_INTEGER,
+					! Native, &value, 1, Saturate);
+			else
+				value = converted_value<T> (get_formatted (format, data));
+			return *this;
+			}
+		}
 	Get
 		(
 		reinterpret_cast<unsigned char*>(&value),	//	Destination: User Value
 		sizeof (T),
-		Block + Offsets[element] + (amount * index),//	Source: Data Block
+		Block + Structure->Offsets[element] + (amount * index),//	Source: Data Block
 		amount
 		);
 	}
@@ -1206,8 +1397,11 @@ T get (const Index element, const Index index = 0) const
 	corresponds to an integer downcast).
 
 	<b>N.B.</b>: No type conversion is done (the data types of data
-	block elements are unknown). Transferring data between mismatched
-	type values or sizes may produced unexpected results.
+	block elements are unknown) unless the element has a {@link
+	value_format(Index, Value_Format) value format} and the type is
+	arithmetic; then the value is converted to or from the format.
+	Transferring data between mismatched type values or sizes may
+	produced unexpected results.
 
 	@param	T	The data type of the value to be transferred.
 	@param	limits_check	True if limit checking for the element and
@@ -1229,10 +1423,26 @@ if (Block)
 	if (limits_check)
 		limits_checker (element, index, false, false);
 	unsigned int
-		amount = (Offsets[element + 1] - Offsets[element]) / Counts[element];
+		amount = Structure->value_size_of (element);
+	if constexpr (std::is_arithmetic<T>::value)
+		{
+		Value_Format
+			format = Structure->format_of (element);
+		if (format != UNSPECIFIED_FORMAT)
+			{
+			unsigned char*
+				data = Block + Structure->Offsets[element] + (amount * index);
+			if (integer_format (format))
+				values_to_integers<T> (&value, data, amount,
+					format == SIGNED_INTEGER, ! Native, 1, Saturate);
+			else
+				put_formatted (format, data, static_cast<double>(value));
+			return *this;
+			}
+		}
 	Put
 		(
-		Block + Offsets[element] + (amount * index),//	Destination: Data Block
+		Block + Structure->Offsets[element] + (amount * index),//	Destination: Data Block
 		amount,
 		reinterpret_cast<const unsigned char*>(&value),	//	Source: User Value
 		sizeof (T)
@@ -1264,6 +1474,12 @@ Data_Block& put (T& value, const Index element, const Index index = 0)
 	A data block element with a single value (non-array element) is the
 	same as an array element with only one value.
 
+	When the element values are the same size as the array values they
+	are transferred as a single block of bytes, with the byte order of
+	each value reversed in place if the data is not in native order.
+	Integer element values of a different size are widened, with zero
+	fill, or narrowed by truncation, in a single pass.
+
 	@param	T		The data type of the array values.
 	@param	limits_check	True if limit checking for the element and
 		index arguments is to be applied; otherwise no limit checking
@@ -1287,11 +1503,53 @@ if (Block)
 	if (limits_check)
 		limits_checker (element, count, true, true);
 	unsigned int
-		amount = (Offsets[element + 1] - Offsets[element]) / Counts[element];
-	if (! count || count > Counts[element])
-		count = Counts[element];
+		amount = Structure->value_size_of (element);
+	if (! count || count > Structure->Counts[element])
+		count = Structure->Counts[element];
 	unsigned char*
-		data = Block + Offsets[element];
+		data = Block + Structure->Offsets[element];
+
+	if constexpr (std::is_arithmetic<T>::value)
+		{
+		Value_Format
+			format = Structure->format_of (element);
+		if (format != UNSPECIFIED_FORMAT)
+			{
+			if (integer_format (format))
+				integers_to_values (data, amount, format == SIGNED_INTEGER,
+					! Native, array, count, Saturate);
+			else if constexpr (std::is_same<T, float>::value ||
+							   std::is_same<T, double>::value)
+				get_formatted (format, data, array, count);
+			else
+				while (count--)
+					{
+					*array++ = converted_value<T> (get_formatted (format, data));
+					data += amount;
+					}
+			return *this;
+			}
+		}
+
+	if (amount == sizeof (T))
+		{
+		//	Same size values are copied as a block and reordered in place.
+		std::memcpy (array, data, count * sizeof (T));
+		if (! Native)
+			swap_bytes (reinterpret_cast<unsigned char*>(array), count, amount);
+		return *this;
+		}
+	if constexpr (std::is_integral<T>::value &&
+				! std::is_same<T, bool>::value)
+		{
+		if (amount &&
+			amount <= 8)
+			{
+			//	Zero filled widening or truncating narrowing.
+			integers_to_values (data, amount, false, ! Native, array, count);
+			return *this;
+			}
+		}
 
 	//	Get each array element
 	while (count--)
@@ -1331,6 +1589,12 @@ const Data_Block& get (T* array, const Index element, Index count = 0) const
 	A data block element with a single value (non-array element) is the
 	same as an array element with only one value.
 
+	When the element values are the same size as the array values they
+	are transferred as a single block of bytes, with the byte order of
+	each value reversed in place if the data is not in native order.
+	Integer element values of a different size are widened, with zero
+	fill, or narrowed by truncation, in a single pass.
+
 	@param	T		The data type of the array values.
 	@param	limits_check	True if limit checking for the element and
 		index arguments is to be applied; otherwise no limit checking
@@ -1354,13 +1618,60 @@ if (Block)
 	if (limits_check)
 		limits_checker (element, count, false, true);
 	unsigned int
-		amount = (Offsets[element + 1] - Offsets[element]) / Counts[element];
-	if (! count || count > Counts[element])
-		count = Counts[element];
+		amount = Structure->value_size_of (element);
+	if (! count || count > Structure->Counts[element])
+		count = Structure->Counts[element];
 	unsigned char*
-		data = Block + Offsets[element];
+		data = Block + Structure->Offsets[element];
 
-	//	Get each array element
+	if constexpr (std::is_arithmetic<T>::value)
+		{
+		Value_Format
+			format = Structure->format_of (element);
+		if (format != UNSPECIFIED_FORMAT)
+			{
+			if (integer_format (format))
+				values_to_integers<T> (array, data, amount,
+					format == SIGNED_INTEGER, ! Native, count, Saturate);
+			else if constexpr (std::is_same<T, float>::value ||
+							   std::is_same<T, double>::value)
+				put_formatted (format, data, array, count);
+			else
+				while (count--)
+					{
+					put_formatted (format, data,
+						static_cast<double>(*array++));
+					data += amount;
+					}
+			return *this;
+			}
+		}
+
+	if (amount == sizeof (T))
+		{
+		//	Same size values are copied as a block and reordered in place.
+		std::memcpy (data, array, count * sizeof (T));
+		if (! Native)
+			swap_bytes (data, count, amount);
+		return *this;
+		}
+	if constexpr (std::is_integral<T>::value &&
+				! std::is_same<T, bool>::value)
+		{
+		if (amount &&
+			amount <= 8)
+			{
+			//	Zero filled widening or truncating narrowing.
+			typedef typename std::make_unsigned<T>::type
+				Unsigned;
+			values_to_integers<Unsigned>
+				(reinterpret_cast<const Unsigned*>(array), data, amount,
+				false, ! Native, count);
+			return *this;
+			}
+		}
+
+	//	Put each array element
 	while (count--)
 		{
 		Put (data, amount,
@@ -1393,6 +1704,105 @@ template<typename T>
 Data_Block& put (T* array, const Index element, Index count = 0)
 	{return put<T, DATA_BLOCK_LIMITS_CHECK> (array, element, count);}
 
+/**	Gather the values of an element from a sequence of records.
+
+	The Data_Block describes the structure of each record of a sequence
+	of fixed length records. The first value of the element is obtained
+	from each record, in the same way that a {@link get(T&, const Index,
+	const Index)const get} would obtain it from a Data_Block with the
+	record as its data, into successive values of an array. The Data_Block
+	data address is not used.
+
+	Values with an integer or floating point value format, and integer
+	values, are converted by a single strided batch conversion pass.
+
+	<b>N.B.</b>: The element is not checked. The Data_Block is not
+	modified, so any number of threads may gather from the same
+	Data_Block at the same time.
+
+	@param	T		The data type of the array values.
+	@param	values	A pointer to an array of at least count values of
+		type T.
+	@param	element	A data block element offset entry Index.
+	@param	records	A pointer to the first byte of the first record.
+	@param	count	The number of records.
+	@param	record_size	The number of bytes from the start of one record
+		to the start of the next.
+	@return	This Data_Block.
+*/
+template<typename T>
+const Data_Block&
+gather
+	(
+	T*					values,
+	const Index			element,
+	const void*			records,
+	std::size_t			count,
+	std::size_t			record_size
+	) const
+{
+unsigned int
+	amount = Structure->value_size_of (element);
+const unsigned char*
+	data = static_cast<const unsigned char*>(records)
+		+ Structure->Offsets[element];
+
+if constexpr (std::is_arithmetic<T>::value)
+	{
+	Value_Format
+		format = Structure->format_of (element);
+	if (format != UNSPECIFIED_FORMAT)
+		{
+		if (integer_format (format))
+			integers_to_values (data, amount, format == SIGNED_INTEGER,
+				! Native, values, count, Saturate, record_size);
+		else if constexpr (std::is_same<T, float>::value ||
+						   std::is_same<T, double>::value)
+			get_formatted (format, data, values, (Index)count,
+				(Index)record_size);
+		else
+			while (count--)
+				{
+				*values++ = converted_value<T> (get_formatted (format, data));
+				data += record_size;
+				}
+		return *this;
+		}
+	}
+if constexpr (std::is_integral<T>::value &&
+			! std::is_same<T, bool>::value)
+	{
+	if (amount &&
+		amount <= 8)
+		{
+		//	Zero filled widening or truncating narrowing.
+		integers_to_values (data, amount, false, ! Native,
+			values, count, false, record_size);
+		return *this;
+		}
+	}
+if (amount == sizeof (T))
+	{
+	while (count--)
+		{
+		std::memcpy (values, data, sizeof (T));
+		if (! Native)
+			*values = reversed (*values);
+		++values;
+		data += record_size;
+		}
+	return *this;
+	}
+
+//	Get each record value.
+while (count--)
+	{
+	Get (reinterpret_cast<unsigned char*>(values++), sizeof (T), data, amount);
+	data += record_size;
+	}
+return *this;
+}
+
 /**	Input data bytes from a stream into the data block.
 
 	@param	stream	The istream from which to read the data.
@@ -1550,36 +1960,167 @@ void limits_checker
 	bool			array
 	) const;
 
+//!	Gets a value from the block that has a non-native format.
+static double get_formatted
+	(
+	Value_Format			format,
+	const unsigned char*	data
+	);
+
+//!	Gets an array of values from the block that have a non-native format.
+static void get_formatted
+	(
+	Value_Format			format,
+	const unsigned char*	data,
+	float*					values,
+	Index					count,
+	Index					stride = 0
+	);
+
+//!	Gets an array of values from the block that have a non-native format.
+static void get_formatted
+	(
+	Value_Format			format,
+	const unsigned char*	data,
+	double*					values,
+	Index					count,
+	Index					stride = 0
+	);
+
+//!	Puts a value into the block in a non-native format.
+static void put_formatted
+	(
+	Value_Format			format,
+	unsigned char*			data,
+	double					value
+	);
+
+//!	Puts an array of values into the block in a non-native format.
+static void put_formatted
+	(
+	Value_Format			format,
+	unsigned char*			data,
+	const float*			values,
+	Index					count
+	);
+
+//!	Puts an array of values into the block in a non-native format.
+static void put_formatted
+	(
+	Value_Format			format,
+	unsigned char*			data,
+	const double*			values,
+	Index					count
+	);
+
 //..............................................................................
 private:
 
-//!	Pointer to the data block storage area (may be NULL).
-unsigned char*
-	Block;
-
-/**	Offsets of the data elements.
+/**	The data block structure description.
 
-	The values are maintained in increasing order. Each value is the
-	offset into the Block where the element starts. There is one more
-	value than the number of elements: the last value is the offset of
-	the end (exclusive) of elements.
+	A Layout may be shared by any number of Data_Blocks. It is treated
+	as immutable while shared: a Data_Block that is about to modify its
+	structure first {@link unshare() obtains its own copy}.
 */
-Value_List
-	Offsets;
+struct Layout
+	{
+	Layout ();
+	Layout (const Layout& layout);
+	~Layout ();
+
+	/**	Offsets of the data elements.
+
+		The values are maintained in increasing order. Each value is the
+		offset into the Block where the element starts. There is one more
+		value than the number of elements: the last value is the offset
+		of the end (exclusive) of elements.
+	*/
+	Value_List
+		Offsets;
+
+	/**	Counts of the number of array values in each element.
+
+		The values are maintained so that each evenly divides the element
+		into equal sized units. A value that is unable to equally divide
+		its element is reset to 1.
+	*/
+	Value_List
+		Counts;
+
+	/**	Value formats of the elements.
+
+		The list is only as long as needed to hold the last element with
+		a specified format; elements beyond the end of the list have
+		an unspecified format.
+	*/
+	std::vector<Value_Format>
+		Formats;
+
+	//!	Gets the size of an element; no limits checking.
+	Index size_of (Index element) const
+		{return Offsets[element + 1] - Offsets[element];}
+
+	//!	Gets the size of an element value; no limits checking.
+	Index value_size_of (Index element) const
+		{return size_of (element) / Counts[element];}
+
+	/**	Gets the effective value format of an element; no limits checking.
+
+		A format that does not fit the element value size is
+		unspecified.
+	*/
+	Value_Format format_of (Index element) const
+		{return (element < Formats.size () &&
+				 Formats[element] != UNSPECIFIED_FORMAT &&
+				 value_format_fits (Formats[element], value_size_of (element))) ?
+			Formats[element] : UNSPECIFIED_FORMAT;}
+
+	/**	Gets the element lookup table, building it if necessary.
+
+		The table has an entry for each byte offset from zero to the end
+		of the elements that is the index of the element containing the
+		offset, or NO_INDEX for an offset before the first element.
+
+		@return	A pointer to the table, or NULL if the elements extend
+			beyond the lookup limit.
+	*/
+	const Index* lookup () const;
+
+	//!	Discards the element lookup table.
+	void invalidate ();
+
+	private:
+	//	The element lookup table; built by any thread that first needs it.
+	mutable std::atomic<const Index*>
+		Lookup;
+
+	Layout& operator= (const Layout&);
+	};
 
-/**	Counts of the number of array values in each element.
+/**	Ensures that the structure description is not shared.
 
-	The values are maintained so that each evenly divides the element
-	into equal sized units. A value that is unable to equally divide its
-	element is reset to 1.
+	If the Layout is referenced by any other Data_Block a private copy
+	is made for this Data_Block. This must be done before any
+	modification of the structure description.
 */
-Value_List
-	Counts;
+void unshare ();
+
+//!	Pointer to the data block storage area (may be NULL).
+unsigned char*
+	Block;
+
+//!	Shared structure description.
+Reference_Counted_Pointer<Layout>
+	Structure;
 
 //!	Data value bytes are in native host order flag.
 bool
 	Native;
 
+//!	Narrowed integer values are saturated flag.
+bool
+	Saturate;
+
 };	//	class Data_Block
 
 /*==============================================================================
@@ -0,0 +1,604 @@
+/*	Data_Block_Editor
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Data_Block_Editor.hh"
+using namespace PIRL;
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::out_of_range;
+using std::length_error;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Data_Block_Editor::ID =
+		"PIRL::Data_Block_Editor ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+const Data_Block_Editor::Index
+	Data_Block_Editor::NO_NODE = Data_Block::NO_INDEX;
+
+/*==============================================================================
+	Constructors
+*/
+Data_Block_Editor::Data_Block_Editor ()
+	:	Root (NO_NODE),
+		Base (0),
+		Seed (2463534242U)
+{}
+
+
+Data_Block_Editor::Data_Block_Editor
+	(
+	const Data_Block&	data_block
+	)
+	:	Root (NO_NODE),
+		Base (0),
+		Seed (2463534242U)
+{
+Index
+	elements = data_block.elements ();
+if (elements)
+	{
+	Value_List
+		offsets (data_block.element_offsets_list ()),
+		counts  (data_block.array_counts_list ());
+	Base = offsets[0];
+	Nodes.reserve (elements);
+	for (Index
+			element = 0;
+			element < elements;
+		  ++element)
+		{
+		Index
+			node = new_node
+				(offsets[element + 1] - offsets[element], counts[element]);
+		Nodes[node].Format = data_block.value_format (element);
+		Root = merge (Root, node);
+		}
+	}
+}
+
+/*==============================================================================
+	Accessors
+*/
+Data_Block_Editor::Index
+Data_Block_Editor::offset_of
+	(
+	Index	element
+	)
+	const
+{
+check_element (element, "get the offset of");
+Index
+	offset = Base,
+	node = Root;
+while (true)
+	{
+	Index
+		left = count (Nodes[node].Left);
+	if (element < left)
+		node = Nodes[node].Left;
+	else
+		{
+		offset += total (Nodes[node].Left);
+		if (element == left)
+			break;
+		offset += Nodes[node].Size;
+		element -= left + 1;
+		node = Nodes[node].Right;
+		}
+	}
+return offset;
+}
+
+
+Data_Block_Editor::Index
+Data_Block_Editor::index_of
+	(
+	Index	offset
+	)
+	const
+{
+if (offset < Base)
+	return Data_Block::NO_INDEX;
+offset -= Base;
+
+//	Find the first element that starts at or after the offset.
+Index
+	node = Root,
+	start = 0,
+	index = 0,
+	found = Data_Block::NO_INDEX,
+	found_start = 0;
+while (node != NO_NODE)
+	{
+	Index
+		element_start = start + total (Nodes[node].Left),
+		element_index = index + count (Nodes[node].Left);
+	if (element_start >= offset)
+		{
+		found = element_index;
+		found_start = element_start;
+		node = Nodes[node].Left;
+		}
+	else
+		{
+		start = element_start + Nodes[node].Size;
+		index = element_index + 1;
+		node = Nodes[node].Right;
+		}
+	}
+if (found != Data_Block::NO_INDEX &&
+	found_start != offset)
+	found = Data_Block::NO_INDEX;
+return found;
+}
+
+
+Data_Block_Editor::Index
+Data_Block_Editor::size_of
+	(
+	Index	element
+	)
+	const
+{
+check_element (element, "get the size of");
+return Nodes[node_at (element)].Size;
+}
+
+
+bool
+Data_Block_Editor::size_of
+	(
+	Index	element,
+	Index	size
+	)
+{
+check_element (element, "set the size of");
+
+//	Isolate the element so the subtree totals above it can be updated.
+Index
+	left,
+	middle,
+	right;
+split (Root, element, left, right);
+split (right, 1, middle, right);
+
+Node&
+	target = Nodes[middle];
+bool
+	count_reset = false;
+if (target.Size != size)
+	{
+	target.Size = size;
+	if (! size ||
+		(target.Count > 1 && size % target.Count))
+		{
+		count_reset = (target.Count != 1);
+		target.Count = 1;
+		}
+	update (middle);
+	}
+Root = merge (merge (left, middle), right);
+return count_reset;
+}
+
+
+Data_Block_Editor::Index
+Data_Block_Editor::count_of
+	(
+	Index	element
+	)
+	const
+{
+check_element (element, "get the count of");
+const Node&
+	target = Nodes[node_at (element)];
+return target.Size ? target.Count : 0;
+}
+
+
+Data_Block_Editor&
+Data_Block_Editor::count_of
+	(
+	Index	element,
+	Index	count
+	)
+{
+check_element (element, "set the array count of");
+Node&
+	target = Nodes[node_at (element)];
+if (count > 1 &&
+	target.Size % count)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't set the array count of element " << element << endl
+			<< "because the element size of " << target.Size << endl
+			<< "is not a multiple of value count " << count << '.';
+	throw length_error (message.str ());
+	}
+target.Count = count ? count : 1;
+return *this;
+}
+
+
+Data_Block::Value_Format
+Data_Block_Editor::value_format
+	(
+	Index	element
+	)
+	const
+{
+check_element (element, "get the value format of");
+return Nodes[node_at (element)].Format;
+}
+
+
+Data_Block_Editor&
+Data_Block_Editor::value_format
+	(
+	Index						element,
+	Data_Block::Value_Format	format
+	)
+{
+check_element (element, "set the value format of");
+Node&
+	target = Nodes[node_at (element)];
+if (! Data_Block::value_format_fits (format, target.Size / target.Count))
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't set the value format of element " << element << endl
+			<< "because the element value size of "
+				<< target.Size / target.Count << endl
+			<< "does not fit the format.";
+	throw length_error (message.str ());
+	}
+target.Format = format;
+return *this;
+}
+
+/*==============================================================================
+	Editing
+*/
+Data_Block_Editor&
+Data_Block_Editor::insert_element
+	(
+	Index	element,
+	Index	size,
+	Index	array_count
+	)
+{
+if (element > elements ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't insert element " << element << " -" << endl
+			<< "Invalid element (of " << elements () << ").";
+	throw out_of_range (message.str ());
+	}
+if (array_count == 0)
+	array_count = 1;
+if (size % array_count)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't insert element " << element << endl
+			<< "because the element size of " << size << endl
+			<< "is not a multiple of value count " << array_count << '.';
+	throw length_error (message.str ());
+	}
+
+Index
+	node = new_node (size, array_count);
+if (element == elements ())
+	Root = merge (Root, node);
+else
+	{
+	Index
+		left,
+		right;
+	split (Root, element, left, right);
+	Root = merge (merge (left, node), right);
+	}
+return *this;
+}
+
+
+Data_Block_Editor&
+Data_Block_Editor::delete_element
+	(
+	Index	element
+	)
+{
+check_element (element, "delete");
+Index
+	left,
+	middle,
+	right;
+split (Root, element, left, right);
+split (right, 1, middle, right);
+Free_Nodes.push_back (middle);
+Root = merge (left, right);
+return *this;
+}
+
+
+Data_Block_Editor&
+Data_Block_Editor::clear ()
+{
+Nodes.clear ();
+Free_Nodes.clear ();
+Root = NO_NODE;
+return *this;
+}
+
+/*==============================================================================
+	Conversion
+*/
+Data_Block_Editor::Value_List
+Data_Block_Editor::element_offsets_list () const
+{
+Value_List
+	offsets;
+if (Root == NO_NODE)
+	return offsets;
+offsets.reserve (elements () + 1);
+
+//	In-order traversal.
+Value_List
+	path;
+Index
+	node = Root,
+	offset = Base;
+while (node != NO_NODE || ! path.empty ())
+	{
+	while (node != NO_NODE)
+		{
+		path.push_back (node);
+		node = Nodes[node].Left;
+		}
+	node = path.back ();
+	path.pop_back ();
+	offsets.push_back (offset);
+	offset += Nodes[node].Size;
+	node = Nodes[node].Right;
+	}
+offsets.push_back (offset);
+return offsets;
+}
+
+
+Data_Block_Editor::Value_List
+Data_Block_Editor::array_counts_list () const
+{
+Value_List
+	counts;
+counts.reserve (elements ());
+
+Value_List
+	path;
+Index
+	node = Root;
+while (node != NO_NODE || ! path.empty ())
+	{
+	while (node != NO_NODE)
+		{
+		path.push_back (node);
+		node = Nodes[node].Left;
+		}
+	node = path.back ();
+	path.pop_back ();
+	counts.push_back (Nodes[node].Count);
+	node = Nodes[node].Right;
+	}
+return counts;
+}
+
+
+Data_Block&
+Data_Block_Editor::structure
+	(
+	Data_Block&	data_block
+	)
+	const
+{
+data_block.element_offsets (element_offsets_list ());
+if (Root != NO_NODE)
+	data_block.array_counts (array_counts_list ());
+
+//	Data_Block formats are by index; every element's format is replaced.
+Index
+	elements = this->elements ();
+for (Index
+		element = 0;
+		element < elements;
+	  ++element)
+	{
+	const Node&
+		target = Nodes[node_at (element)];
+	data_block.value_format (element,
+		Data_Block::value_format_fits (target.Format, target.Size / target.Count) ?
+			target.Format : Data_Block::UNSPECIFIED_FORMAT);
+	}
+return data_block;
+}
+
+/*==============================================================================
+	Helpers
+*/
+void
+Data_Block_Editor::update
+	(
+	Index	node
+	)
+{
+Node&
+	target = Nodes[node];
+target.Total = total (target.Left) + target.Size + total (target.Right);
+target.Elements = count (target.Left) + 1 + count (target.Right);
+}
+
+
+void
+Data_Block_Editor::split
+	(
+	Index	node,
+	Index	elements,
+	Index&	left,
+	Index&	right
+	)
+{
+if (node == NO_NODE)
+	{
+	left = right = NO_NODE;
+	return;
+	}
+if (count (Nodes[node].Left) >= elements)
+	{
+	split (Nodes[node].Left, elements, left, Nodes[node].Left);
+	right = node;
+	}
+else
+	{
+	split (Nodes[node].Right, elements - count (Nodes[node].Left) - 1,
+		Nodes[node].Right, right);
+	left = node;
+	}
+update (node);
+}
+
+
+Data_Block_Editor::Index
+Data_Block_Editor::merge
+	(
+	Index	left,
+	Index	right
+	)
+{
+if (left == NO_NODE)
+	return right;
+if (right == NO_NODE)
+	return left;
+if (Nodes[left].Priority > Nodes[right].Priority)
+	{
+	Nodes[left].Right = merge (Nodes[left].Right, right);
+	update (left);
+	return left;
+	}
+Nodes[right].Left = merge (left, Nodes[right].Left);
+update (right);
+return right;
+}
+
+
+Data_Block_Editor::Index
+Data_Block_Editor::node_at
+	(
+	Index	element
+	)
+	const
+{
+Index
+	node = Root;
+while (true)
+	{
+	Index
+		left = count (Nodes[node].Left);
+	if (element < left)
+		node = Nodes[node].Left;
+	else if (element == left)
+		return node;
+	else
+		{
+		element -= left + 1;
+		node = Nodes[node].Right;
+		}
+	}
+}
+
+
+Data_Block_Editor::Index
+Data_Block_Editor::new_node
+	(
+	Index	size,
+	Index	array_count
+	)
+{
+//	Xorshift pseudo-random priority.
+Seed ^= Seed << 13;
+Seed ^= Seed >> 17;
+Seed ^= Seed << 5;
+
+Node
+	node;
+node.Size		= size;
+node.Count		= array_count ? array_count : 1;
+node.Format		= Data_Block::UNSPECIFIED_FORMAT;
+node.Total		= size;
+node.Elements	= 1;
+node.Priority	= Seed;
+node.Left		= NO_NODE;
+node.Right		= NO_NODE;
+
+Index
+	index;
+if (Free_Nodes.empty ())
+	{
+	index = Nodes.size ();
+	Nodes.push_back (node);
+	}
+else
+	{
+	index = Free_Nodes.back ();
+	Free_Nodes.pop_back ();
+	Nodes[index] = node;
+	}
+return index;
+}
+
+
+void
+Data_Block_Editor::check_element
+	(
+	Index		element,
+	const char*	action
+	)
+	const
+{
+if (element >= elements ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't " << action << " element " << element << " -" << endl
+			<< "Invalid element (of " << elements () << ").";
+	throw out_of_range (message.str ());
+	}
+}
@@ -0,0 +1,351 @@
+/*	Data_Block_Editor
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Data_Block_Editor_
+#define _Data_Block_Editor_
+
+#include	"Data_Block.hh"
+
+#include	<vector>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Data_Block_Editor
+*/
+/**	A <i>Data_Block_Editor</i> builds and edits the structure of a
+	Data_Block with a large number of elements.
+
+	A Data_Block holds its structure as a flat list of element offsets.
+	Lookups are fast, but inserting, deleting or resizing an element
+	must shift all of the following offsets, so building a structure
+	of n elements one element at a time takes time proportional to n
+	squared. The Data_Block_Editor instead holds the element sizes and
+	array value counts in a balanced binary tree (a randomized treap)
+	where each node also records the total size of its subtree. This
+	allows an element to be inserted, deleted or resized, and an
+	element offset or the element at an offset to be found, in time
+	proportional to log n.
+
+	The flat element offsets and array counts lists are produced on
+	demand, and may be applied to a Data_Block in one step when editing
+	is complete:
+
+	<code>
+	Data_Block_Editor editor;<br>
+	for (int element = 0; element < 50000; ++element)<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;editor.insert_element (editor.elements (), 4);<br>
+	editor.insert_element (10, 12, 3);<br>
+	editor.structure (data_block);
+	</code>
+
+	As with a Data_Block all elements are contiguous, starting at the
+	{@link base_offset() base offset}.
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Data_Block
+*/
+class Data_Block_Editor
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Element index, offset and array count values.
+typedef Data_Block::Index		Index;
+
+//!	Value list.
+typedef Data_Block::Value_List	Value_List;
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+//!	Constructs an empty Data_Block_Editor.
+Data_Block_Editor ();
+
+/**	Constructs a Data_Block_Editor from the structure of a Data_Block.
+
+	@param	data_block	The Data_Block with the element offsets, array
+		counts and value formats to be edited.
+*/
+explicit Data_Block_Editor (const Data_Block& data_block);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of elements.
+
+	@return	The number of structure elements.
+*/
+Index elements () const
+	{return count (Root);}
+
+/**	Gets the end-of-elements offset.
+
+	@return	The offset of the byte following the last element.
+*/
+Index size () const
+	{return Base + total (Root);}
+
+/**	Gets the offset of the first element.
+
+	@return	The base offset.
+*/
+Index base_offset () const
+	{return Base;}
+
+/**	Sets the offset of the first element.
+
+	All elements are relocated by the same amount.
+
+	@param	offset	The new offset of the first element.
+	@return	This Data_Block_Editor.
+*/
+Data_Block_Editor& base_offset (Index offset)
+	{Base = offset; return *this;}
+
+/**	Gets the offset of an element.
+
+	@param	element	The element index.
+	@return	The offset of the element.
+	@throws	std::out_of_range	If an invalid element is specified.
+*/
+Index offset_of (Index element) const;
+
+/**	Gets the index of the element at an offset.
+
+	@param	offset	The offset of the element to find.
+	@return	The index of the first element that starts at the offset;
+		or Data_Block::NO_INDEX if no element starts at the offset.
+*/
+Index index_of (Index offset) const;
+
+/**	Gets the size of an element.
+
+	@param	element	The element index.
+	@return	The size of the entire element.
+	@throws	std::out_of_range	If an invalid element is specified.
+*/
+Index size_of (Index element) const;
+
+/**	Sets the size of an element.
+
+	The offsets of all following elements are effectively shifted.
+
+	<b>CAUTION</b>: If the array value count of the resized element does
+	not accommodate the new size, the count is reset to 1.
+
+	@param	element	The element index.
+	@param	size	The size of the entire element.
+	@return	true if the array count of the element was reset; false
+		otherwise.
+	@throws	std::out_of_range	If an invalid element is specified.
+*/
+bool size_of (Index element, Index size);
+
+/**	Gets the number of array values in an element.
+
+	@param	element	The element index.
+	@return	The element array value count; 0 if the element is empty.
+	@throws	std::out_of_range	If an invalid element is specified.
+*/
+Index count_of (Index element) const;
+
+/**	Sets the number of array values in an element.
+
+	@param	element	The element index.
+	@param	count	The number of array values. A count of 0 is taken
+		to be 1.
+	@return	This Data_Block_Editor.
+	@throws	std::out_of_range	If an invalid element is specified.
+	@throws	std::length_error	If the element size is not a multiple of
+		the count.
+*/
+Data_Block_Editor& count_of (Index element, Index count);
+
+/**	Gets the value format of an element.
+
+	@param	element	The element index.
+	@return	The Data_Block::Value_Format of the element values.
+	@throws	std::out_of_range	If an invalid element is specified.
+*/
+Data_Block::Value_Format value_format (Index element) const;
+
+/**	Sets the value format of an element.
+
+	The format stays with the element as other elements are inserted or
+	deleted.
+
+	@param	element	The element index.
+	@param	format	The Data_Block::Value_Format of the element values.
+	@return	This Data_Block_Editor.
+	@throws	std::out_of_range	If an invalid element is specified.
+	@throws	std::length_error	If the element value size does not fit
+		the format.
+*/
+Data_Block_Editor& value_format (Index element,
+	Data_Block::Value_Format format);
+
+/*==============================================================================
+	Editing
+*/
+/**	Inserts a new element.
+
+	The new element is inserted before the element currently at the
+	specified index; all following elements are effectively shifted up
+	by the size of the new element. The new element has an unspecified
+	value format.
+
+	@param	element	The index of the new element. If this is the
+		number of {@link elements() elements} the new element is
+		appended.
+	@param	size	The size of the new element.
+	@param	array_count	The count of array values for the element.
+	@return	This Data_Block_Editor.
+	@throws	std::out_of_range	If the element index is beyond the
+		number of elements.
+	@throws	std::length_error	If the size is not an integer multiple
+		of the array_count.
+*/
+Data_Block_Editor& insert_element
+	(Index element, Index size, Index array_count = 1);
+
+/**	Deletes an element.
+
+	All following elements are effectively shifted down by the size of
+	the deleted element.
+
+	@param	element	The index of the element to be deleted.
+	@return	This Data_Block_Editor.
+	@throws	std::out_of_range	If an invalid element is specified.
+*/
+Data_Block_Editor& delete_element (Index element);
+
+//!	Removes all elements.
+Data_Block_Editor& clear ();
+
+/*==============================================================================
+	Conversion
+*/
+/**	Gets the element offsets list.
+
+	@return	A vector of element offsets, including the final
+		end-of-elements offset.
+*/
+Value_List element_offsets_list () const;
+
+/**	Gets the element array value counts list.
+
+	@return	A vector of element array value counts.
+*/
+Value_List array_counts_list () const;
+
+/**	Applies the edited structure to a Data_Block.
+
+	The Data_Block element offsets, array counts and value formats are
+	replaced. The value format of an element that was resized so its
+	value size no longer fits the format is unspecified.
+
+	@param	data_block	The Data_Block to receive the structure.
+	@return	The data_block.
+*/
+Data_Block& structure (Data_Block& data_block) const;
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+//!	A treap node for one element.
+struct Node
+	{
+	//!	Element size.
+	Index
+		Size;
+	//!	Element array value count.
+	Index
+		Count;
+	//!	Element value format.
+	Data_Block::Value_Format
+		Format;
+	//!	Total size of the elements in this subtree.
+	Index
+		Total;
+	//!	Number of elements in this subtree.
+	Index
+		Elements;
+	//!	Heap priority.
+	unsigned int
+		Priority;
+	//!	Subtree node indices; NO_NODE if none.
+	Index
+		Left,
+		Right;
+	};
+
+static const Index
+	NO_NODE;
+
+Index count (Index node) const
+	{return (node == NO_NODE) ? 0 : Nodes[node].Elements;}
+Index total (Index node) const
+	{return (node == NO_NODE) ? 0 : Nodes[node].Total;}
+
+void update (Index node);
+void split (Index node, Index elements, Index& left, Index& right);
+Index merge (Index left, Index right);
+Index node_at (Index element) const;
+Index new_node (Index size, Index array_count);
+void check_element (Index element, const char* action) const;
+
+/*==============================================================================
+	Data
+*/
+//!	Node storage; nodes are referenced by their index.
+std::vector<Node>
+	Nodes;
+
+//!	Indices of deleted nodes available for reuse.
+std::vector<Index>
+	Free_Nodes;
+
+//!	The root node of the tree.
+Index
+	Root;
+
+//!	The offset of the first element.
+Index
+	Base;
+
+//!	Pseudo-random priority generator state.
+unsigned int
+	Seed;
+
+};	//	class Data_Block_Editor
+
+}	//	namespace PIRL
+#endif
@@ -24,6 +24,10 @@ Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
 #define _Dimensions_
 
 #include	<iosfwd>
+#include	<limits>
+#include	<type_traits>
+#include	<functional>
+#include	<cstddef>
 
 
 namespace PIRL
@@ -42,6 +46,15 @@ typedef COORDINATE_TYPE	Coordinate_Type;
 //!	The integer data type of a dimension value.
 typedef DIMENSIONS_TYPE	Dimensions_Type;
 
+/*	The functions marked DIMENSIONS_EXPORT were defined out of line by
+	earlier versions of this library. Dimensions.cc defines this to have
+	them emitted, so their symbols remain available to code compiled
+	against the earlier declarations.
+*/
+#ifndef DIMENSIONS_EXPORT
+#define DIMENSIONS_EXPORT
+#endif
+
 
 /**	Rounds a floating point number to the nearest integer value.
 
@@ -54,12 +67,92 @@ typedef DIMENSIONS_TYPE	Dimensions_Type;
 	@param	number	The floating point (double) number to be rounded.
 	@return	The integer value of the rounded number.
 */
-inline Coordinate_Type Round (double number)
+constexpr Coordinate_Type Round (double number) noexcept
 	{return (Coordinate_Type)(number > 0 ? (number + 0.5) : (number - 0.5));}
 
+/**	Divides an integer value by a factor.
+
+	The result is {@link Round(double) rounded} to the nearest integer
+	value.
+
+	<b>N.B.</b>: Divide by zero is handled as a special case. If the
+	value was zero it will remain zero. If the Type has an infinity value
+	(determined by numeric_types) that is used, or its negative if the
+	value is negative. Otherwise, if the Type is signed the type's max
+	value is used, or the min value if the value is negative; for an
+	unsigned value the max value is used.
+
+	@param	value	The integer value to be divided.
+	@param	factor	The factor by which to divide the value.
+	@return	The divided value.
+*/
+template<typename Type>
+constexpr Type Divide (Type value, double factor) noexcept
+	{
+	if (factor != 0)
+		return Round (value / factor);
+	if (value == 0)
+		return value;
+	if (std::numeric_limits<Type>::has_infinity)
+		return (value > 0) ?
+			 std::numeric_limits<Type>::infinity () :
+			-std::numeric_limits<Type>::infinity ();
+	if (std::numeric_limits<Type>::is_signed)
+		return (value > 0) ?
+			std::numeric_limits<Type>::max () :
+			std::numeric_limits<Type>::min ();
+	return std::numeric_limits<Type>::max ();
+	}
+
+/**	Mixes the bits of a value for use as a hash.
+
+	This is the 64-bit finalizer of the MurmurHash3 function: every bit
+	of the value affects every bit of the result, so hash tables may use
+	any of the result bits - e.g. the low bits as a table index and the
+	high bits as a tag.
+
+	@param	value	The value to be mixed.
+	@return	The mixed value.
+*/
+constexpr unsigned long long Hash_Mix (unsigned long long value) noexcept
+	{
+	value ^= value >> 33;
+	value *= 0xFF51AFD7ED558CCDULL;
+	value ^= value >> 33;
+	value *= 0xC4CEB9FE1A85EC53ULL;
+	value ^= value >> 33;
+	return value;
+	}
+
+/**	Packs two integer values into the bits of one value for hashing.
+
+	The values are packed exactly when they have 32 bits or less, as the
+	default Coordinate_Type and Dimensions_Type do.
+
+	@param	high	The value for the high bits.
+	@param	low		The value for the low bits.
+	@return	The packed value.
+*/
+template<typename Type>
+constexpr unsigned long long Hash_Pack (Type high, Type low) noexcept
+	{
+	typedef typename std::make_unsigned<Type>::type
+		Bits;
+	return (static_cast<unsigned long long>(static_cast<Bits>(high)) << 32)
+		^ static_cast<Bits>(low);
+	}
+
+//!	An odd multiplier, from the golden ratio, that spreads packed values.
+const unsigned long long
+	HASH_SPREAD		= 0x9E3779B97F4A7C15ULL;
+
 //******************************************************************************
 /**	A <i>Point_2D</i> holds 2-dimensional position information.
 
+	A Point_2D is trivially copyable and its constructors, accessors and
+	operators are constexpr, so constant points may be computed at compile
+	time and the operators are inlined in every translation unit.
+
 	@author		Bradford Castalia, UA/PIRL
 	@version	$Revision: 1.27 $
 */
@@ -81,20 +174,27 @@ Coordinate_Type
 	Constructors:
 */
 //!	Constructs a Point_2D at position 0,0.
-Point_2D ();
+DIMENSIONS_EXPORT constexpr Point_2D () noexcept
+	:	X (0),
+		Y (0)
+	{}
 
 /**	Constructs a Point_2D at position x,y.
 
 	@param	x	The horizontal (x-axis) position of the Point_2D.
 	@param	y	The vertical (y-axis) position of the Point_2D.
 */
-Point_2D (const Coordinate_Type& x,const Coordinate_Type& y);
+DIMENSIONS_EXPORT constexpr Point_2D
+	(const Coordinate_Type& x,const Coordinate_Type& y) noexcept
+	:	X (x),
+		Y (y)
+	{}
 
 /**	Constructs a Point_2D from another Point_2D.
 
 	@param	point	A Point_2D to be copied.
 */
-Point_2D (const Point_2D& point);
+Point_2D (const Point_2D& point) = default;
 
 /*==============================================================================
 	Accessors:
@@ -105,7 +205,8 @@ Point_2D (const Point_2D& point);
 	@param	y	The vertical (y-axis) position of the Point_2D.
 	@return	This Point_2D.
 */
-inline Point_2D& position (const Coordinate_Type& x,const Coordinate_Type& y)
+constexpr Point_2D& position
+	(const Coordinate_Type& x,const Coordinate_Type& y) noexcept
 	{
 	X = x;
 	Y = y;
@@ -118,7 +219,7 @@ inline Point_2D& position (const Coordinate_Type& x,const Coordinate_Type& y)
 		this Point_2D.
 	@return	This Point_2D.
 */
-inline Point_2D& position (const Point_2D& point)
+constexpr Point_2D& position (const Point_2D& point) noexcept
 	{
 	X = point.X;
 	Y = point.Y;
@@ -130,29 +231,21 @@ inline Point_2D& position (const Point_2D& point)
 	@param	point	A Point_2D whose coordinates are to be assigned to
 		this Point_2D.
 */
-inline Point_2D& operator= (const Point_2D& point)
-	{
-	if (this != &point)
-		{
-		X = point.X;
-		Y = point.Y;
-		}
-	return *this;
-	}
+Point_2D& operator= (const Point_2D& point) = default;
 
 /**	Set the horizontal (x-axis) position.
 
 	@param	x_position	The horizontal (x-axis) position of the Point_2D.
 	@return	This Point_2D.
 */
-inline Point_2D& x (const Coordinate_Type& x_position)
+constexpr Point_2D& x (const Coordinate_Type& x_position) noexcept
 	{X = x_position; return *this;}
 
 /**	Get the horizontal (x-axis) position.
 
 	@return	The horizontal (x-axis) position of the Point_2D.
 */
-inline Coordinate_Type x () const
+constexpr Coordinate_Type x () const noexcept
 	{return X;}
 
 /**	Set the vertical (y-axis) position.
@@ -160,14 +253,14 @@ inline Coordinate_Type x () const
 	@param	y_position	The vertical (y-axis) position of the Point_2D.
 	@return	This Point_2D.
 */
-inline Point_2D& y (const Coordinate_Type& y_position)
+constexpr Point_2D& y (const Coordinate_Type& y_position) noexcept
 	{Y = y_position; return *this;}
 
 /**	Get the vertical (y-axis) position.
 
 	@return	The vertical (y-axis) position of the Point_2D.
 */
-inline Coordinate_Type y () const
+constexpr Coordinate_Type y () const noexcept
 	{return Y;}
 
 /**	Test if this Point_2D is equal to another Point_2D.
@@ -177,7 +270,7 @@ inline Coordinate_Type y () const
 	@param	point	The Point_2D to which this Point_2D is to be compared.
 	@return	true if the two Point_2Ds are equal; false otherwise.
 */
-inline bool operator== (const Point_2D& point) const
+constexpr bool operator== (const Point_2D& point) const noexcept
 	{return X == point.X && Y == point.Y;}
 
 /**	Test if this Point_2D is not equal to another Point_2D.
@@ -188,15 +281,54 @@ inline bool operator== (const Point_2D& point) const
 	@param	point	The Point_2D to which this Point_2D is to be compared.
 	@return	true if the two Point_2Ds are not equal; false otherwise.
 */
-inline bool operator!= (const Point_2D& point) const
+constexpr bool operator!= (const Point_2D& point) const noexcept
 	{return X != point.X || Y != point.Y;}
 
+/**	Test if this Point_2D precedes another Point_2D in Morton order.
+
+	Points are ordered along a Z-order (Morton) curve: the interleaved
+	bits of the coordinates, with each Y bit above the X bit of the same
+	significance, are compared. Points that are near each other tend to
+	be near each other in this order. Negative coordinates precede
+	positive coordinates. The interleaved values are not formed; the
+	coordinate with the most significant differing bit decides.
+
+	@param	point	The Point_2D to which this Point_2D is to be compared.
+	@return	true if this Point_2D precedes the other Point_2D; false
+		otherwise.
+*/
+constexpr bool operator< (const Point_2D& point) const noexcept
+	{
+	typedef std::make_unsigned<Coordinate_Type>::type
+		Bits;
+	//	Flipping the sign bit orders signed values as unsigned values.
+	const Bits
+		sign = static_cast<Bits>(std::numeric_limits<Coordinate_Type>::min ()),
+		this_x = static_cast<Bits>(X) ^ sign,
+		that_x = static_cast<Bits>(point.X) ^ sign,
+		this_y = static_cast<Bits>(Y) ^ sign,
+		that_y = static_cast<Bits>(point.Y) ^ sign,
+		x_bits = this_x ^ that_x,
+		y_bits = this_y ^ that_y;
+	//	Y decides unless the highest differing X bit is above any Y bit.
+	return (y_bits < x_bits && y_bits < (y_bits ^ x_bits)) ?
+		this_x < that_x : this_y < that_y;
+	}
+
+/**	Get a hash of this Point_2D.
+
+	@return	A hash of the coordinates with all bits well mixed.
+	@see	Hash_Mix(unsigned long long)
+*/
+constexpr std::size_t hash () const noexcept
+	{return static_cast<std::size_t>(Hash_Mix (Hash_Pack (X, Y)));}
+
 /**	Test for all zero coordinate values.
 
 	@return	true if any coordinate value is non-zero; false otherwise.
 	@see	is_null()
 */
-inline operator bool ()
+constexpr operator bool () const noexcept
 	{return X != 0 || Y != 0;}
 
 /**	Test for all zero coordinate values.
@@ -204,7 +336,7 @@ inline operator bool ()
 	@return true if both coordinates are zero; false otherwise.
 	@see	operator bool()
 */
-inline bool is_null ()
+constexpr bool is_null () const noexcept
 	{return X == 0 && Y == 0;}
 
 /*==============================================================================
@@ -215,7 +347,7 @@ inline bool is_null ()
 	@param	offset	A Point_2D that provides the offset values.
 	@return	This Point_2D with its values offset.
 */
-inline Point_2D& operator+= (const Point_2D& offset)
+constexpr Point_2D& operator+= (const Point_2D& offset) noexcept
 	{X += offset.X; Y += offset.Y; return *this;}
 
 /**	Subtract an offset.
@@ -223,7 +355,7 @@ inline Point_2D& operator+= (const Point_2D& offset)
 	@param	offset	A Point_2D that provides the offset values.
 	@return	This Point_2D with its values offset.
 */
-inline Point_2D& operator-= (const Point_2D& offset)
+constexpr Point_2D& operator-= (const Point_2D& offset) noexcept
 	{X -= offset.X; Y -= offset.Y; return *this;}
 
 /**	Multiply by a factor.
@@ -234,7 +366,7 @@ inline Point_2D& operator-= (const Point_2D& offset)
 	@param	factor	A factor by which to multiply the Point_2D coordinates.
 	@return	This Point_2D with its values changed.
 */
-inline Point_2D& operator*= (double factor)
+constexpr Point_2D& operator*= (double factor) noexcept
 	{X = Round (X * factor); Y = Round (Y * factor); return *this;}
 
 /**	Divide by a factor.
@@ -252,8 +384,10 @@ inline Point_2D& operator*= (double factor)
 
 	@param	factor	A factor by which to divide the Point_2D dimensions.
 	@return	This Point_2D with its values changed.
+	@see	Divide(Type, double)
 */
-Point_2D& operator/= (double factor);
+DIMENSIONS_EXPORT constexpr Point_2D& operator/= (double factor) noexcept
+	{X = Divide (X, factor); Y = Divide (Y, factor); return *this;}
 
 };	//	End of Point_2D class.
 
@@ -264,7 +398,8 @@ Point_2D& operator/= (double factor);
 	@return	A Point_2D in which the dimensions are the sum of the
 		dimensions of the specified points.
 */
-inline Point_2D operator+ (const Point_2D& point_1, const Point_2D& point_2)
+constexpr Point_2D operator+
+	(const Point_2D& point_1, const Point_2D& point_2) noexcept
 	{return Point_2D (point_1) += point_2;}
 
 /**	Subtract one point from another.
@@ -274,7 +409,8 @@ inline Point_2D operator+ (const Point_2D& point_1, const Point_2D& point_2)
 	@return	A Point_2D in which the dimensions are the difference of the
 		dimensions of the specified points.
 */
-inline Point_2D operator- (const Point_2D& point_1, const Point_2D& point_2)
+constexpr Point_2D operator-
+	(const Point_2D& point_1, const Point_2D& point_2) noexcept
 	{return Point_2D (point_1) -= point_2;}
 
 /**	Get the negation of a point.
@@ -283,7 +419,7 @@ inline Point_2D operator- (const Point_2D& point_1, const Point_2D& point_2)
 	@return	A Point_2D in which the dimensions are the negation of the
 		dimensions of the specified points.
 */
-inline Point_2D operator- (const Point_2D& point)
+constexpr Point_2D operator- (const Point_2D& point) noexcept
 	{return Point_2D (-point.X, -point.Y);}
 
 /**	Multiply a point by a factor.
@@ -294,7 +430,7 @@ inline Point_2D operator- (const Point_2D& point)
 		specified point multiplied by the factor and {@link Round(double)
 		rounded}.
 */
-inline Point_2D operator* (const Point_2D& point, double factor)
+constexpr Point_2D operator* (const Point_2D& point, double factor) noexcept
 	{return Point_2D (point) *= factor;}
 
 /**	Multiply a point by a factor.
@@ -305,7 +441,7 @@ inline Point_2D operator* (const Point_2D& point, double factor)
 		specified point multiplied by the factor and {@link Round(double)
 		rounded}.
 */
-inline Point_2D operator* (double factor, const Point_2D& point)
+constexpr Point_2D operator* (double factor, const Point_2D& point) noexcept
 	{return Point_2D (point) *= factor;}
 
 /**	Divide a point by a factor.
@@ -316,7 +452,7 @@ inline Point_2D operator* (double factor, const Point_2D& point)
 		specified point divided by the factor and {@link Round(double)
 		rounded}.
 */
-inline Point_2D operator/ (const Point_2D& point, double factor)
+constexpr Point_2D operator/ (const Point_2D& point, double factor) noexcept
 	{return Point_2D (point) /= factor;}
 
 /**	Print a Point_2D description to an output stream.
@@ -349,27 +485,37 @@ Dimensions_Type
 
 	Both Width and Height are zero.
 */
-Size_2D ();
+DIMENSIONS_EXPORT constexpr Size_2D () noexcept
+	:	Width (0),
+		Height (0)
+	{}
 
 /**	Constructs a Size_2D with width,height size.
 
 	@param	width	The Width of the Size_2D.
 	@param	height	The Height of the Size_2D.
 */
-Size_2D (const Dimensions_Type& width, const Dimensions_Type& height);
+DIMENSIONS_EXPORT constexpr Size_2D
+	(const Dimensions_Type& width, const Dimensions_Type& height) noexcept
+	:	Width (width),
+		Height (height)
+	{}
 
 /**	Constructs a Size_2D of equal Width and Height.
 
 	@param	side	The length of each side. Both Width and Height will
 		be set to this value.
 */
-Size_2D (const Dimensions_Type& side);
+DIMENSIONS_EXPORT constexpr Size_2D (const Dimensions_Type& side) noexcept
+	:	Width (side),
+		Height (side)
+	{}
 
 /**	Constructs a Size_2D from another Size_2D.
 
 	@param	size	A Size_2D to be copied.
 */
-Size_2D (const Size_2D& size);
+Size_2D (const Size_2D& size) = default;
 
 /*==============================================================================
 	Accessors:
@@ -380,8 +526,8 @@ Size_2D (const Size_2D& size);
 	@param	height	The Height of the Size_2D.
 	@return	This Size_2D.
 */
-inline Size_2D& size
-	(const Dimensions_Type& width, const Dimensions_Type& height)
+constexpr Size_2D& size
+	(const Dimensions_Type& width, const Dimensions_Type& height) noexcept
 	{
 	Width  = width;
 	Height = height;
@@ -394,7 +540,7 @@ inline Size_2D& size
 		Size_2D.
 	@return	This Size_2D.
 */
-inline Size_2D& size (const Size_2D& size)
+constexpr Size_2D& size (const Size_2D& size) noexcept
 	{
 	Width  = size.Width;
 	Height = size.Height;
@@ -406,29 +552,21 @@ inline Size_2D& size (const Size_2D& size)
 	@param	size	A Size_2D to have its dimensions assigned to this
 		Size_2D.
 */
-inline Size_2D& operator= (const Size_2D& size)
-	{
-	if (this != &size)
-		{
-		Width  = size.Width;
-		Height = size.Height;
-		}
-	return *this;
-	}
+Size_2D& operator= (const Size_2D& size) = default;
 
 /**	Set the Width of the Size_2D.
 
 	@param	width	The Width of the Size_2D.
 	@return	This Size_2D.
 */
-inline Size_2D& width (const Dimensions_Type& width)
+constexpr Size_2D& width (const Dimensions_Type& width) noexcept
 	{Width = width; return *this;}
 
 /**	Get the Width of the Size_2D.
 
 	@return	The Width of the Size_2D.
 */
-inline Dimensions_Type width () const
+constexpr Dimensions_Type width () const noexcept
 	{return Width;}
 
 /**	Set the Height of the Size_2D.
@@ -436,21 +574,21 @@ inline Dimensions_Type width () const
 	@param	height	The Height of the Size_2D.
 	@return	This Size_2D.
 */
-inline Size_2D& height (const Dimensions_Type& height)
+constexpr Size_2D& height (const Dimensions_Type& height) noexcept
 	{Height = height; return *this;}
 
 /**	Get the Height of the Size_2D.
 
 	@return	The Height of the Size_2D.
 */
-inline Dimensions_Type height () const
+constexpr Dimensions_Type height () const noexcept
 	{return Height;}
 
 /**	Get the area of this Size_2D.
 
 	@return	The area (Width * Height) of the Size_2D.
 */
-inline unsigned long long area () const
+constexpr unsigned long long area () const noexcept
 	{return (long long)Width * Height;}
 
 /**	Test if this Size_2D is equal to another Size_2D.
@@ -461,7 +599,7 @@ inline unsigned long long area () const
 	@param	size	The Size_2D to which this Size_2D is to be compared.
 	@return	true if the two Size_2Ds are equal; false otherwise.
 */
-inline bool operator== (const Size_2D& size) const
+constexpr bool operator== (const Size_2D& size) const noexcept
 	{return Width == size.Width && Height == size.Height;}
 
 /**	Test if this Size_2D is not equal to another Size_2D.
@@ -472,21 +610,41 @@ inline bool operator== (const Size_2D& size) const
 	@param	size	The Size_2D to which this Size_2D is to be compared.
 	@return	true if the two Size_2Ds are not equal; false otherwise.
 */
-inline bool operator!= (const Size_2D& size) const
+constexpr bool operator!= (const Size_2D& size) const noexcept
 	{return Width != size.Width || Height != size.Height;}
 
+/**	Test if this Size_2D precedes another Size_2D.
+
+	Sizes are ordered by Width and then by Height.
+
+	@param	size	The Size_2D to which this Size_2D is to be compared.
+	@return	true if this Size_2D precedes the other Size_2D; false
+		otherwise.
+*/
+constexpr bool operator< (const Size_2D& size) const noexcept
+	{return Width < size.Width ||
+		(Width == size.Width && Height < size.Height);}
+
+/**	Get a hash of this Size_2D.
+
+	@return	A hash of the dimensions with all bits well mixed.
+	@see	Hash_Mix(unsigned long long)
+*/
+constexpr std::size_t hash () const noexcept
+	{return static_cast<std::size_t>(Hash_Mix (Hash_Pack (Width, Height)));}
+
 /**	Test for all zero dimension values.
 
 	@return	true if any dimension value is non-zero; false otherwise.
 */
-inline operator bool ()
+constexpr operator bool () const noexcept
 	{return Width != 0 || Height != 0;}
 
 /**	Test for any zero dimension values.
 
 	@return true if any dimension is zero; false otherwise.
 */
-inline bool is_empty ()
+constexpr bool is_empty () const noexcept
 	{return Width == 0 || Height == 0;}
 
 /*==============================================================================
@@ -497,7 +655,7 @@ inline bool is_empty ()
 	@param	size	A Size_2D that provides the amount values.
 	@return	This Size_2D with the amount added to its values.
 */
-inline Size_2D& operator+= (const Size_2D& size)
+constexpr Size_2D& operator+= (const Size_2D& size) noexcept
 	{Width += size.Width; Height += size.Height; return *this;}
 
 /**	Subtract a size amount.
@@ -509,7 +667,14 @@ inline Size_2D& operator+= (const Size_2D& size)
 	@param	size	A Size_2D that provides the amount values.
 	@return	This Size_2D with the amount subtracted to its values.
 */
-Size_2D& operator-= (const Size_2D& size);
+DIMENSIONS_EXPORT constexpr Size_2D& operator-= (const Size_2D& size) noexcept
+	{
+	Width = (std::numeric_limits<Dimensions_Type>::is_signed ||
+			 Width >= size.Width) ? Width - size.Width : 0;
+	Height = (std::numeric_limits<Dimensions_Type>::is_signed ||
+			  Height >= size.Height) ? Height - size.Height : 0;
+	return *this;
+	}
 
 /**	Multiply by a factor.
 
@@ -520,7 +685,15 @@ Size_2D& operator-= (const Size_2D& size);
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-Size_2D& operator*= (double factor);
+DIMENSIONS_EXPORT constexpr Size_2D& operator*= (double factor)
+	{
+	if (factor < 0 &&
+		! std::numeric_limits<Dimensions_Type>::is_signed)
+		negative_factor ("multiply", factor);
+	Width = Round (Width * factor);
+	Height = Round (Height * factor);
+	return *this;
+	}
 
 /**	Divide by a factor.
 
@@ -541,7 +714,20 @@ Size_2D& operator*= (double factor);
 		values Dimensions_Type are an unsigned type (as they are by
 		default).
 */
-Size_2D& operator/= (double factor);
+DIMENSIONS_EXPORT constexpr Size_2D& operator/= (double factor)
+	{
+	if (factor < 0 &&
+		! std::numeric_limits<Dimensions_Type>::is_signed)
+		negative_factor ("divide", factor);
+	Width = Divide (Width, factor);
+	Height = Divide (Height, factor);
+	return *this;
+	}
+
+private:
+
+//	Throws the invalid_argument for a negative factor.
+[[noreturn]] static void negative_factor (const char* operation, double factor);
 
 };	//	End of Size_2D class.
 
@@ -552,7 +738,8 @@ Size_2D& operator/= (double factor);
 	@return	A Size_2D in which the dimensions are the sum of the
 		dimensions of the specified sizes.
 */
-inline Size_2D operator+ (const Size_2D& size_1, const Size_2D& size_2)
+constexpr Size_2D operator+
+	(const Size_2D& size_1, const Size_2D& size_2) noexcept
 	{return Size_2D (size_1) += size_2;}
 
 /**	Subtract one size from another.
@@ -566,7 +753,8 @@ inline Size_2D operator+ (const Size_2D& size_1, const Size_2D& size_2)
 	@return	A Size_2D in which the dimensions are the difference of the
 		dimensions of the specified sizes.
 */
-inline Size_2D operator- (const Size_2D& size_1, const Size_2D& size_2)
+constexpr Size_2D operator-
+	(const Size_2D& size_1, const Size_2D& size_2) noexcept
 	{return Size_2D (size_1) -= size_2;}
 
 /**	Multiply a size by a factor.
@@ -579,7 +767,7 @@ inline Size_2D operator- (const Size_2D& size_1, const Size_2D& size_2)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Size_2D operator* (const Size_2D& size, double factor)
+constexpr Size_2D operator* (const Size_2D& size, double factor)
 	{return Size_2D (size) *= factor;}
 
 /**	Multiply a size by a factor.
@@ -592,7 +780,7 @@ inline Size_2D operator* (const Size_2D& size, double factor)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Size_2D operator* (double factor, const Size_2D& size)
+constexpr Size_2D operator* (double factor, const Size_2D& size)
 	{return Size_2D (size) *= factor;}
 
 /**	Divide a size by a factor.
@@ -605,7 +793,7 @@ inline Size_2D operator* (double factor, const Size_2D& size)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Size_2D operator/ (const Size_2D& size, double factor)
+constexpr Size_2D operator/ (const Size_2D& size, double factor)
 	{return Size_2D (size) /= factor;}
 
 /**	Print a Size_2D description to an output stream.
@@ -640,7 +828,10 @@ struct Rectangle
 
 	The position is 0,0 and the size is 0,0.
 */
-Rectangle ();
+DIMENSIONS_EXPORT constexpr Rectangle () noexcept
+	:	Point_2D (),
+		Size_2D ()
+	{}
 
 /**	Constructs a Rectangle from an x,y position and width,height size.
 
@@ -649,32 +840,42 @@ Rectangle ();
 	@param	width	The Width of the Rectangle.
 	@param	height	The Height of the Rectangle.
 */
-Rectangle
+DIMENSIONS_EXPORT constexpr Rectangle
 	(
 	const Coordinate_Type	x,
 	const Coordinate_Type	y,
 	const Dimensions_Type	width = 0,
 	const Dimensions_Type	height = 0
-	);
+	) noexcept
+	:	Point_2D (x, y),
+		Size_2D (width, height)
+	{}
 
 /**	Constructs a Rectangle from a position and a size.
 
 	@param	position	A Point_2D.
 	@param	size		A Size_2D.
 */
-Rectangle (const Point_2D& position, const Size_2D& size);
+DIMENSIONS_EXPORT constexpr Rectangle
+	(const Point_2D& position, const Size_2D& size) noexcept
+	:	Point_2D (position),
+		Size_2D (size)
+	{}
 
 /**	Constructs a Rectangle from a size at position 0,0.
 
 	@param	size		A Size_2D.
 */
-Rectangle (const Size_2D& size);
+DIMENSIONS_EXPORT constexpr Rectangle (const Size_2D& size) noexcept
+	:	Point_2D (),
+		Size_2D (size)
+	{}
 
 /**	Constructs a Rectangle as a copy of another Rectangle.
 
 	@param	rectangle	A Rectangle to be copied.
 */
-Rectangle (const Rectangle& rectangle);
+Rectangle (const Rectangle& rectangle) = default;
 
 /*==============================================================================
 	Accessors:
@@ -685,7 +886,8 @@ Rectangle (const Rectangle& rectangle);
 	@param	y	The vertical (y-axis) position of the Rectangle.
 	@return	This Rectangle.
 */
-inline Rectangle& position (const Coordinate_Type& x,const Coordinate_Type& y)
+constexpr Rectangle& position
+	(const Coordinate_Type& x,const Coordinate_Type& y) noexcept
 	{Point_2D::position (x, y); return *this;}
 
 /**	Set the position of this Rectangle.
@@ -694,7 +896,7 @@ inline Rectangle& position (const Coordinate_Type& x,const Coordinate_Type& y)
 		this Rectangle.
 	@return	This Rectangle.
 */
-inline Rectangle& position (const Point_2D& point)
+constexpr Rectangle& position (const Point_2D& point) noexcept
 	{Point_2D::position (point); return *this;}
 
 /**	Assign the position of the Rectangle from a Point_2D.
@@ -702,7 +904,7 @@ inline Rectangle& position (const Point_2D& point)
 	@param	point	A Point_2D for the position of the Rectangle.
 	@return	This Rectangle.
 */
-inline Rectangle& operator= (const Point_2D& point)
+constexpr Rectangle& operator= (const Point_2D& point) noexcept
 	{Point_2D::operator= (point); return *this;}
 
 /**	Get the Rectangle position.
@@ -710,14 +912,14 @@ inline Rectangle& operator= (const Point_2D& point)
 	@return	A Point_2D with the Rectangle position. <b>N.B.</b>: Changing
 		this Point_2D will not change the position of the Rectangle.
 */
-inline Point_2D position () const
+constexpr Point_2D position () const noexcept
 	{return Point_2D (X, Y);}
 
 /**	Convert the Rectangle to its corresponding Point_2D.
 
 	@return	A Point_2D with the Rectangle position. 
 */
-inline operator Point_2D () const
+constexpr operator Point_2D () const noexcept
 	{return position ();}
 
 /**	Set the size of this Rectangle.
@@ -726,8 +928,8 @@ inline operator Point_2D () const
 	@param	height	The Height of the Rectangle.
 	@return	This Rectangle.
 */
-inline Rectangle& size
-	(const Dimensions_Type& width, const Dimensions_Type& height)
+constexpr Rectangle& size
+	(const Dimensions_Type& width, const Dimensions_Type& height) noexcept
 	{Size_2D::size (width, height); return *this;}
 
 /**	Set the size of this Rectangle.
@@ -736,7 +938,7 @@ inline Rectangle& size
 		Rectangle.
 	@return	This Rectangle.
 */
-inline Rectangle& size (const Size_2D& size)
+constexpr Rectangle& size (const Size_2D& size) noexcept
 	{Size_2D::size (size); return *this;}
 
 /**	Assign the size of the Rectangle from a Size_2D.
@@ -744,7 +946,7 @@ inline Rectangle& size (const Size_2D& size)
 	@param	size	A Size_2D for the size of the Rectangle.
 	@return	This Rectangle.
 */
-inline Rectangle& operator= (const Size_2D& size)
+constexpr Rectangle& operator= (const Size_2D& size) noexcept
 	{Size_2D::operator= (size); return *this;}
 
 /**	Get the Rectangle size.
@@ -752,14 +954,14 @@ inline Rectangle& operator= (const Size_2D& size)
 	@return	A Size_2D with the Rectangle size. <b>N.B.</b>: Changing
 		this size will not change the size of the Rectangle.
 */
-inline Size_2D size () const
+constexpr Size_2D size () const noexcept
 	{return Size_2D (Width, Height);}
 
 /**	Convert the Rectangle to its corresponding Size_2D.
 
 	@return	A Size_2D with the Rectangle size.
 */
-inline operator Size_2D () const
+constexpr operator Size_2D () const noexcept
 	{return size ();}
 
 /**	Assign the position and size of another Rectangle to this Rectangle.
@@ -768,17 +970,7 @@ inline operator Size_2D () const
 		assigned to this Rectangle.
 	@return	This Rectangle.
 */
-inline Rectangle& operator= (const Rectangle& rectangle)
-	{
-	if (this != &rectangle)
-		{
-		X = rectangle.X;
-		Y = rectangle.Y;
-		Width  = rectangle.Width;
-		Height = rectangle.Height;
-		}
-	return *this;
-	}
+Rectangle& operator= (const Rectangle& rectangle) = default;
 
 /**	Test if this Rectangle is equal to another Rectangle.
 
@@ -789,9 +981,9 @@ inline Rectangle& operator= (const Rectangle& rectangle)
 		compared.
 	@return	true if the two Rectangles are equal; false otherwise.
 */
-inline bool operator== (const Rectangle& rectangle) const
-	{return Point_2D::operator== ((const Point_2D)rectangle) &&
-			 Size_2D::operator== ((const Size_2D)rectangle);}
+constexpr bool operator== (const Rectangle& rectangle) const noexcept
+	{return Point_2D::operator== (rectangle) &&
+			 Size_2D::operator== (rectangle);}
 
 /**	Test if this Rectangle is not equal to another Rectangle.
 
@@ -802,15 +994,39 @@ inline bool operator== (const Rectangle& rectangle) const
 		compared.
 	@return	true if the two Rectangles are not equal; false otherwise.
 */
-inline bool operator!= (const Rectangle& rectangle) const
-	{return Point_2D::operator!= ((const Point_2D)rectangle) ||
-			 Size_2D::operator!= ((const Size_2D)rectangle);}
+constexpr bool operator!= (const Rectangle& rectangle) const noexcept
+	{return Point_2D::operator!= (rectangle) ||
+			 Size_2D::operator!= (rectangle);}
+
+/**	Test if this Rectangle precedes another Rectangle.
+
+	Rectangles are ordered by their {@link Point_2D::operator<(const
+	Point_2D&)const position}, in Morton order, and then by their {@link
+	Size_2D::operator<(const Size_2D&)const size}.
+
+	@param	rectangle	The Rectangle to which this Rectangle is to be
+		compared.
+	@return	true if this Rectangle precedes the other Rectangle; false
+		otherwise.
+*/
+constexpr bool operator< (const Rectangle& rectangle) const noexcept
+	{return Point_2D::operator< (rectangle) ||
+		(Point_2D::operator== (rectangle) && Size_2D::operator< (rectangle));}
+
+/**	Get a hash of this Rectangle.
+
+	@return	A hash of the position and size with all bits well mixed.
+	@see	Hash_Mix(unsigned long long)
+*/
+constexpr std::size_t hash () const noexcept
+	{return static_cast<std::size_t>(Hash_Mix
+		(Hash_Pack (X, Y) * HASH_SPREAD ^ Hash_Pack (Width, Height)));}
 
 /**	Test for all zero dimension values.
 
 	@return	true if any dimension value is non-zero; false otherwise.
 */
-inline operator bool ()
+constexpr operator bool () const noexcept
 	{return Point_2D::operator bool () || Size_2D::operator bool ();}
 
 /*==============================================================================
@@ -821,7 +1037,7 @@ inline operator bool ()
 	@param	offset	A Point_2D that provides the offset values.
 	@return	This Rectangle with its values offset.
 */
-inline Rectangle& operator+= (const Point_2D& offset)
+constexpr Rectangle& operator+= (const Point_2D& offset) noexcept
 	{Point_2D::operator+= (offset); return *this;}
 
 /**	Add a size amount.
@@ -829,7 +1045,7 @@ inline Rectangle& operator+= (const Point_2D& offset)
 	@param	size	A Size_2D that provides the amount values.
 	@return	This Rectangle with the amount added to its size values.
 */
-inline Rectangle& operator+= (const Size_2D& size)
+constexpr Rectangle& operator+= (const Size_2D& size) noexcept
 	{Size_2D::operator+= (size); return *this;}
 
 /**	Add another Rectangle's point coordinate offset and size amount.
@@ -839,10 +1055,10 @@ inline Rectangle& operator+= (const Size_2D& size)
 		other Rectangle's point coordinate values, and the other Rectangle's
 		size amount added to its size dimensions.
 */ 
-inline Rectangle& operator+= (const Rectangle& rectangle)
+constexpr Rectangle& operator+= (const Rectangle& rectangle) noexcept
 	{
-	Point_2D::operator+= (static_cast<Point_2D>(rectangle));
-	Size_2D::operator+= (static_cast<Size_2D>(rectangle));
+	Point_2D::operator+= (static_cast<const Point_2D&>(rectangle));
+	Size_2D::operator+= (static_cast<const Size_2D&>(rectangle));
 	return *this;
 	}
 
@@ -851,7 +1067,7 @@ inline Rectangle& operator+= (const Rectangle& rectangle)
 	@param	offset	A Point_2D that provides the offset values.
 	@return	This Rectangle with its values offset.
 */
-inline Rectangle& operator-= (const Point_2D& offset)
+constexpr Rectangle& operator-= (const Point_2D& offset) noexcept
 	{Point_2D::operator-= (offset); return *this;}
 
 /**	Subtract a size amount.
@@ -863,7 +1079,7 @@ inline Rectangle& operator-= (const Point_2D& offset)
 	@param	size	A Size_2D that provides the amount values.
 	@return	This Rectangle with the amount subtracted to its values.
 */
-inline Rectangle& operator-= (const Size_2D& size)
+constexpr Rectangle& operator-= (const Size_2D& size) noexcept
 	{Size_2D::operator-= (size); return *this;}
 
 /**	Subtract another Rectangle's point coordinate offset and size amount.
@@ -873,10 +1089,10 @@ inline Rectangle& operator-= (const Size_2D& size)
 		other Rectangle's point coordinate values, and the other Rectangle's
 		size amount subtracted from its size dimensions.
 */ 
-inline Rectangle& operator-= (const Rectangle& rectangle)
+constexpr Rectangle& operator-= (const Rectangle& rectangle) noexcept
 	{
-	Point_2D::operator-= (static_cast<Point_2D>(rectangle));
-	Size_2D::operator-= (static_cast<Size_2D>(rectangle));
+	Point_2D::operator-= (static_cast<const Point_2D&>(rectangle));
+	Size_2D::operator-= (static_cast<const Size_2D&>(rectangle));
 	return *this;
 	}
 
@@ -889,7 +1105,7 @@ inline Rectangle& operator-= (const Rectangle& rectangle)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Rectangle& operator*= (double factor)
+constexpr Rectangle& operator*= (double factor)
 	{Size_2D::operator*= (factor); return *this;}
 
 /**	Divide by a factor.
@@ -910,7 +1126,7 @@ inline Rectangle& operator*= (double factor)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Rectangle& operator/= (double factor)
+constexpr Rectangle& operator/= (double factor)
 	{Size_2D::operator/= (factor); return *this;}
 
 /**	Take the intersection with another Rectangle.
@@ -923,7 +1139,38 @@ inline Rectangle& operator/= (double factor)
 		intersect this will result in a Rectangle with no area (Width
 		and Height both zero) but the position will be unchanged.
 */
-Rectangle& operator&= (const Rectangle& rectangle);
+DIMENSIONS_EXPORT constexpr Rectangle& operator&= (const Rectangle& rectangle)
+	noexcept
+	{
+	long long
+		this_right_edge  = static_cast<long long>(X) + Width,
+		this_bottom_edge = static_cast<long long>(Y) + Height,
+		that_right_edge  = static_cast<long long>(rectangle.X)
+			+ rectangle.Width,
+		that_bottom_edge = static_cast<long long>(rectangle.Y)
+			+ rectangle.Height;
+	if (this_right_edge  <= rectangle.X ||
+		that_right_edge  <= X ||
+		this_bottom_edge <= rectangle.Y ||
+		that_bottom_edge <= Y)
+		//	No intersection.
+		 Width =
+		Height = 0;
+	else
+		{
+		if (X < rectangle.X)
+			X = rectangle.X;
+		if (Y < rectangle.Y)
+			Y = rectangle.Y;
+		if (this_right_edge  > that_right_edge)
+			this_right_edge  = that_right_edge;
+		if (this_bottom_edge > that_bottom_edge)
+			this_bottom_edge = that_bottom_edge;
+		Width  = (Dimensions_Type)(this_right_edge  - X);
+		Height = (Dimensions_Type)(this_bottom_edge - Y);
+		}
+	return *this;
+	}
 
 /**	Take the union with another Rectangle.
 
@@ -933,7 +1180,28 @@ Rectangle& operator&= (const Rectangle& rectangle);
 	@return	This Rectangle with its position and size set to the
 		union - i.e. the bounding box - with the other Rectangle.
 */
-Rectangle& operator|= (const Rectangle& rectangle);
+DIMENSIONS_EXPORT constexpr Rectangle& operator|= (const Rectangle& rectangle)
+	noexcept
+	{
+	long long
+		this_right_edge  = static_cast<long long>(X) + Width,
+		this_bottom_edge = static_cast<long long>(Y) + Height,
+		that_right_edge  = static_cast<long long>(rectangle.X)
+			+ rectangle.Width,
+		that_bottom_edge = static_cast<long long>(rectangle.Y)
+			+ rectangle.Height;
+	if (X > rectangle.X)
+		X = rectangle.X;
+	if (Y > rectangle.Y)
+		Y = rectangle.Y;
+	if (this_right_edge  < that_right_edge)
+		this_right_edge  = that_right_edge;
+	if (this_bottom_edge < that_bottom_edge)
+		this_bottom_edge = that_bottom_edge;
+	Width  = (Dimensions_Type)(this_right_edge  - X);
+	Height = (Dimensions_Type)(this_bottom_edge - Y);
+	return *this;
+	}
 
 };	//	End of Rectangle class.
 
@@ -944,7 +1212,8 @@ Rectangle& operator|= (const Rectangle& rectangle);
 	@return	A Rectangle in which the coordinate point dimensions are the
 		Point_2D have been added to the coordinate point of the Rectangle.
 */
-inline Rectangle operator+ (const Rectangle& rectangle, const Point_2D& point)
+constexpr Rectangle operator+
+	(const Rectangle& rectangle, const Point_2D& point) noexcept
 	{return Rectangle (rectangle) += point;}
 
 /**	Add a Point_2D offset to a Rectangle.
@@ -954,7 +1223,8 @@ inline Rectangle operator+ (const Rectangle& rectangle, const Point_2D& point)
 	@return	A Rectangle in which the coordinate point dimensions of the
 		Point_2D have been added to the coordinate point of the Rectangle.
 */
-inline Rectangle operator+ (const Point_2D& point, const Rectangle& rectangle)
+constexpr Rectangle operator+
+	(const Point_2D& point, const Rectangle& rectangle) noexcept
 	{return Rectangle (rectangle) += point;}
 
 /**	Add two Rectangles.
@@ -964,8 +1234,8 @@ inline Rectangle operator+ (const Point_2D& point, const Rectangle& rectangle)
 	@return	A Rectangle in which the coordinate point dimensions and the size
 		amounts of the two Rectangles have been added.
 */
-inline Rectangle operator+
-	(const Rectangle& rectangle_1, const Rectangle& rectangle_2)
+constexpr Rectangle operator+
+	(const Rectangle& rectangle_1, const Rectangle& rectangle_2) noexcept
 	{return Rectangle (rectangle_1) += rectangle_2;}
 
 /**	Subtract a Point_2D offset from a Rectangle.
@@ -976,7 +1246,8 @@ inline Rectangle operator+
 		Point_2D have been subtracted from the coordinate point of the
 		Rectangle.
 */
-inline Rectangle operator- (const Rectangle& rectangle, const Point_2D& point)
+constexpr Rectangle operator-
+	(const Rectangle& rectangle, const Point_2D& point) noexcept
 	{return Rectangle (rectangle) -= point;}
 
 /**	Subtract two Rectangles.
@@ -986,8 +1257,8 @@ inline Rectangle operator- (const Rectangle& rectangle, const Point_2D& point)
 	@return	A Rectangle in which the coordinate point dimensions and the size
 		amounts of the two Rectangles have been added.
 */
-inline Rectangle operator-
-	(const Rectangle& rectangle_1, const Rectangle& rectangle_2)
+constexpr Rectangle operator-
+	(const Rectangle& rectangle_1, const Rectangle& rectangle_2) noexcept
 	{return Rectangle (rectangle_1) -= rectangle_2;}
 
 /**	Get the negation of a Rectangle.
@@ -996,7 +1267,7 @@ inline Rectangle operator-
 	@return	A Rectangle in which the coordinate point dimensions are the
 		negation of the Rectangle's coordinate point; the size is the same.
 */
-inline Rectangle operator- (const Rectangle& rectangle)
+constexpr Rectangle operator- (const Rectangle& rectangle) noexcept
 	{return Rectangle (-rectangle.X, -rectangle.Y,
 		rectangle.Width, rectangle.Height);}
 
@@ -1007,7 +1278,8 @@ inline Rectangle operator- (const Rectangle& rectangle)
 	@return	A Rectangle in which the size amount has been added to the
 		Rectangle size dimensions; the coordinate point is the same.
 */
-inline Rectangle operator+ (const Rectangle& rectangle, const Size_2D& size)
+constexpr Rectangle operator+
+	(const Rectangle& rectangle, const Size_2D& size) noexcept
 	{return Rectangle (rectangle) += size;}
 
 /**	Add a size amount to a Rectangle.
@@ -1018,7 +1290,8 @@ inline Rectangle operator+ (const Rectangle& rectangle, const Size_2D& size)
 		negation of the Rectangle size dimensions; the coordinate point
 		is the same.
 */
-inline Rectangle operator+ (const Size_2D& size, const Rectangle& rectangle)
+constexpr Rectangle operator+
+	(const Size_2D& size, const Rectangle& rectangle) noexcept
 	{return Rectangle (rectangle) += size;}
 
 /**	Subtract a size amount from a Rectangle.
@@ -1032,7 +1305,8 @@ inline Rectangle operator+ (const Size_2D& size, const Rectangle& rectangle)
 	@return	A Rectangle in which the size amount has been subtracted from
 		the Rectangle size dimensions; the coordinate point is the same.
 */
-inline Rectangle operator- (const Rectangle& rectangle, const Size_2D& size)
+constexpr Rectangle operator-
+	(const Rectangle& rectangle, const Size_2D& size) noexcept
 	{return Rectangle (rectangle) -= size;}
 
 /**	Multiply a Rectangle by a factor.
@@ -1045,7 +1319,7 @@ inline Rectangle operator- (const Rectangle& rectangle, const Size_2D& size)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Rectangle operator* (const Rectangle& rectangle, double factor)
+constexpr Rectangle operator* (const Rectangle& rectangle, double factor)
 	{return Rectangle (rectangle) *= factor;}
 
 /**	Multiply a Rectangle by a factor.
@@ -1058,7 +1332,7 @@ inline Rectangle operator* (const Rectangle& rectangle, double factor)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Rectangle operator* (double factor, const Rectangle& rectangle)
+constexpr Rectangle operator* (double factor, const Rectangle& rectangle)
 	{return Rectangle (rectangle) *= factor;}
 
 /**	Divide a Rectangle by a factor.
@@ -1082,7 +1356,7 @@ inline Rectangle operator* (double factor, const Rectangle& rectangle)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Rectangle operator/ (const Rectangle& rectangle, double factor)
+constexpr Rectangle operator/ (const Rectangle& rectangle, double factor)
 	{return Rectangle (rectangle) /= factor;}
 
 /**	Get the intersection of two Rectangles.
@@ -1094,8 +1368,8 @@ inline Rectangle operator/ (const Rectangle& rectangle, double factor)
 		intersect this will result in a Rectangle with no area (Width
 		and Height both zero) but the position of the first Rectangle.
 */
-inline Rectangle operator&
-	(const Rectangle& rectangle_1, const Rectangle& rectangle_2)
+constexpr Rectangle operator&
+	(const Rectangle& rectangle_1, const Rectangle& rectangle_2) noexcept
 	{return Rectangle (rectangle_1) &= rectangle_2;}
 
 /**	Get the union of two Rectangles.
@@ -1105,8 +1379,8 @@ inline Rectangle operator&
 	@return	A Rectangle with its position and size set to the
 		union - i.e. the bounding box - of the two Rectangles.
 */
-inline Rectangle& operator|
-	(const Rectangle& rectangle_1, const Rectangle& rectangle_2)
+constexpr Rectangle operator|
+	(const Rectangle& rectangle_1, const Rectangle& rectangle_2) noexcept
 	{return Rectangle (rectangle_1) |= rectangle_2;}
 
 /**	Print a Rectangle description to an output stream.
@@ -1144,7 +1418,10 @@ Dimensions_Type
 
 	The position is 0,0; the size is 0,0; the Depth is 0.
 */
-Cube ();
+DIMENSIONS_EXPORT constexpr Cube () noexcept
+	:	Rectangle (),
+		Depth (0)
+	{}
 
 /**	Constructs a Cube from an x,y position, width,height size, and depth.
 
@@ -1154,14 +1431,17 @@ Cube ();
 	@param	height	The Height of the Cube.
 	@param	depth	The Depth of the Cube.
 */
-Cube
+DIMENSIONS_EXPORT constexpr Cube
 	(
 	const Coordinate_Type	x,
 	const Coordinate_Type	y,
 	const Dimensions_Type	width = 0,
 	const Dimensions_Type	height = 0,
 	const Dimensions_Type	depth = 0
-	);
+	) noexcept
+	:	Rectangle (x, y, width, height),
+		Depth (depth)
+	{}
 
 /**	Constructs a Cube from a position and a size.
 
@@ -1170,7 +1450,11 @@ Cube
 	@param	position	A Point_2D.
 	@param	size		A Size_2D.
 */
-Cube (const Point_2D& position, const Size_2D& size);
+DIMENSIONS_EXPORT constexpr Cube
+	(const Point_2D& position, const Size_2D& size) noexcept
+	:	Rectangle (position, size),
+		Depth (1)
+	{}
 
 /**	Constructs a Cube from a size.
 
@@ -1178,7 +1462,10 @@ Cube (const Point_2D& position, const Size_2D& size);
 
 	@param	size		A Size_2D.
 */
-Cube (const Size_2D& size);
+DIMENSIONS_EXPORT constexpr Cube (const Size_2D& size) noexcept
+	:	Rectangle (size),
+		Depth (1)
+	{}
 
 /**	Constructs a Cube from a Rectangle.
 
@@ -1186,13 +1473,16 @@ Cube (const Size_2D& size);
 
 	@param	rectangle	A Rectangle.
 */
-Cube (const Rectangle& rectangle);
+DIMENSIONS_EXPORT constexpr Cube (const Rectangle& rectangle) noexcept
+	:	Rectangle (rectangle),
+		Depth (1)
+	{}
 
 /**	Constructs a Cube as a copy of another Cube.
 
 	@param	cube	A Cube to be copied.
 */
-Cube (const Cube& cube);
+Cube (const Cube& cube) = default;
 
 /*==============================================================================
 	Accessors:
@@ -1203,7 +1493,8 @@ Cube (const Cube& cube);
 	@param	y	The vertical (y-axis) position of the Cube.
 	@return	This Cube.
 */
-inline Cube& position (const Coordinate_Type& x,const Coordinate_Type& y)
+constexpr Cube& position
+	(const Coordinate_Type& x,const Coordinate_Type& y) noexcept
 	{Point_2D::position (x, y); return *this;}
 
 /**	Set the position of this Cube.
@@ -1212,7 +1503,7 @@ inline Cube& position (const Coordinate_Type& x,const Coordinate_Type& y)
 		the position of this Cube.
 	@return	This Cube.
 */
-inline Cube& position (const Point_2D& point)
+constexpr Cube& position (const Point_2D& point) noexcept
 	{Point_2D::position (point); return *this;}
 
 /**	Assign the position of the Cube from a Point_2D.
@@ -1220,7 +1511,7 @@ inline Cube& position (const Point_2D& point)
 	@param	point	A Point_2D for the position of the Cube.
 	@return	This Cube.
 */
-inline Cube& operator= (const Point_2D& point)
+constexpr Cube& operator= (const Point_2D& point) noexcept
 	{Point_2D::operator= (point); return *this;}
 
 /**	Set the size of this Cube.
@@ -1229,8 +1520,8 @@ inline Cube& operator= (const Point_2D& point)
 	@param	height	The Height of the Cube.
 	@return	This Cube.
 */
-inline Cube& size
-	(const Dimensions_Type& width, const Dimensions_Type& height)
+constexpr Cube& size
+	(const Dimensions_Type& width, const Dimensions_Type& height) noexcept
 	{Size_2D::size (width, height); return *this;}
 
 /**	Set the size of this Cube.
@@ -1239,7 +1530,7 @@ inline Cube& size
 		Cube.
 	@return	This Cube.
 */
-inline Cube& size (const Size_2D& size)
+constexpr Cube& size (const Size_2D& size) noexcept
 	{Size_2D::size (size); return *this;}
 
 /**	Set the Depth of this Cube.
@@ -1247,14 +1538,14 @@ inline Cube& size (const Size_2D& size)
 	@param	depth	The Depth of this Cube.
 	@return	This Cube.
 */
-inline Cube& depth (Dimensions_Type depth)
+constexpr Cube& depth (Dimensions_Type depth) noexcept
 	{Depth = depth; return *this;}
 
 /**	Get the Depth of this Cube.
 
 	@return	The Depth of this Cube.
 */
-inline Dimensions_Type depth () const
+constexpr Dimensions_Type depth () const noexcept
 	{return Depth;}
 
 /**	Assign the size of the Cube from a Size_2D.
@@ -1262,7 +1553,7 @@ inline Dimensions_Type depth () const
 	@param	size	A Size_2D for the size of the Cube.
 	@return	This Cube.
 */
-inline Cube& operator= (const Size_2D& size)
+constexpr Cube& operator= (const Size_2D& size) noexcept
 	{Size_2D::operator= (size); return *this;}
 
 /**	Set the dimensions of this Cube from a Rectangle.
@@ -1271,7 +1562,7 @@ inline Cube& operator= (const Size_2D& size)
 		this Cube.
 	@return	This Cube.
 */
-inline Cube& dimensions (const Rectangle& rectangle)
+constexpr Cube& dimensions (const Rectangle& rectangle) noexcept
 	{Rectangle::operator= (rectangle); return *this;}
 
 /**	Set the dimensions of this Cube from a Rectangle.
@@ -1280,7 +1571,7 @@ inline Cube& dimensions (const Rectangle& rectangle)
 		this Cube.
 	@return	This Cube.
 */
-inline Cube& operator= (const Rectangle& rectangle)
+constexpr Cube& operator= (const Rectangle& rectangle) noexcept
 	{Rectangle::operator= (rectangle); return *this;}
 
 /**	Assign the dimensions of another Cube to this Cube.
@@ -1289,24 +1580,13 @@ inline Cube& operator= (const Rectangle& rectangle)
 		to this Cube.
 	@return	This Cube.
 */
-inline Cube& operator= (const Cube& cube)
-	{
-	if (this != &cube)
-		{
-		X = cube.X;
-		Y = cube.Y;
-		Width  = cube.Width;
-		Height = cube.Height;
-		Depth = cube.Depth;
-		}
-	return *this;
-	}
+Cube& operator= (const Cube& cube) = default;
 
 /**	Get the volume of this Cube.
 
 	@return	The volume (Width * Height * Depth) of the Cube.
 */
-inline unsigned long long volume () const
+constexpr unsigned long long volume () const noexcept
 	{return area () * Depth;}
 
 /**	Test if this Cube is equal to another Cube.
@@ -1317,9 +1597,9 @@ inline unsigned long long volume () const
 	@param	cube	The Cube to which this Cube is to be compared.
 	@return	true if the two Cubes are equal; false otherwise.
 */
-inline bool operator== (const Cube& cube) const
+constexpr bool operator== (const Cube& cube) const noexcept
 	{return Depth == cube.Depth &&
-		Rectangle::operator== ((const Rectangle)cube);}
+		Rectangle::operator== (cube);}
 
 /**	Test if this Cube is not equal to another Cube.
 
@@ -1329,22 +1609,45 @@ inline bool operator== (const Cube& cube) const
 	@param	cube	The Cube to which this Cube is to be compared.
 	@return	true if the two Cubes are not equal; false otherwise.
 */
-inline bool operator!= (const Cube& cube) const
+constexpr bool operator!= (const Cube& cube) const noexcept
 	{return Depth != cube.Depth ||
-		Rectangle::operator!= ((const Rectangle)cube);}
+		Rectangle::operator!= (cube);}
+
+/**	Test if this Cube precedes another Cube.
+
+	Cubes are ordered by their {@link Rectangle::operator<(const
+	Rectangle&)const Rectangle} and then by their Depth.
+
+	@param	cube	The Cube to which this Cube is to be compared.
+	@return	true if this Cube precedes the other Cube; false otherwise.
+*/
+constexpr bool operator< (const Cube& cube) const noexcept
+	{return Rectangle::operator< (cube) ||
+		(Rectangle::operator== (cube) && Depth < cube.Depth);}
+
+/**	Get a hash of this Cube.
+
+	@return	A hash of the position, size and depth with all bits well
+		mixed.
+	@see	Hash_Mix(unsigned long long)
+*/
+constexpr std::size_t hash () const noexcept
+	{return static_cast<std::size_t>(Hash_Mix
+		((Hash_Pack (X, Y) * HASH_SPREAD ^ Hash_Pack (Width, Height))
+			* HASH_SPREAD ^ Depth));}
 
 /**	Test for all zero dimension values.
 
 	@return	true if any dimension value is non-zero; false otherwise.
 */
-inline operator bool ()
+constexpr operator bool () const noexcept
 	{return Depth != 0 || Rectangle::operator bool ();}
 
 /**	Test for any zero dimension values.
 
 	@return true if any dimension is zero; false otherwise.
 */
-inline bool is_empty ()
+constexpr bool is_empty () const noexcept
 	{return Depth == 0 || Size_2D::is_empty ();}
 
 /*==============================================================================
@@ -1359,7 +1662,16 @@ inline bool is_empty ()
 	@param	amount	An integer amount to add to the Depth.
 	@return	This Cube with the amount applied.
 */
-Cube& operator+= (int amount);
+DIMENSIONS_EXPORT constexpr Cube& operator+= (int amount) noexcept
+	{
+	if (amount < 0 &&
+		(Dimensions_Type)(-amount) > Depth &&
+		! std::numeric_limits<Dimensions_Type>::is_signed)
+		Depth = 0;
+	else
+		Depth += amount;
+	return *this;
+	}
 
 /**	Add another Cube's point coordinate offset, and depth and size amount.
 
@@ -1369,9 +1681,9 @@ Cube& operator+= (int amount);
 		Cube's Depth, and the other Cube's size amount added to its size
 		dimensions.
 */ 
-inline Cube& operator+= (const Cube& cube)
+constexpr Cube& operator+= (const Cube& cube) noexcept
 	{
-	Rectangle::operator+= (static_cast<Rectangle>(cube));
+	Rectangle::operator+= (static_cast<const Rectangle&>(cube));
 	operator+= (cube.Depth);
 	return *this;
 	}
@@ -1385,7 +1697,7 @@ inline Cube& operator+= (const Cube& cube)
 	@param	amount	An integer amount to subtract from the Depth.
 	@return	This Cube with the amount applied.
 */
-inline Cube& operator-= (int amount)
+constexpr Cube& operator-= (int amount) noexcept
 	{operator+= (-amount); return *this;}
 
 /**	Subtract another Cube's point coordinate and depth offset and size amount.
@@ -1396,9 +1708,9 @@ inline Cube& operator-= (int amount)
 		by the other Cube's Depth, and the other Cube's size amount
 		subtracted from its size dimensions.
 */ 
-inline Cube& operator-= (const Cube& cube)
+constexpr Cube& operator-= (const Cube& cube) noexcept
 	{
-	Rectangle::operator-= (static_cast<Rectangle>(cube));
+	Rectangle::operator-= (static_cast<const Rectangle&>(cube));
 	operator-= (cube.Depth);
 	return *this;
 	}
@@ -1412,7 +1724,7 @@ inline Cube& operator-= (const Cube& cube)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Cube& operator*= (double factor)
+constexpr Cube& operator*= (double factor)
 	{
 	Rectangle::operator*= (factor);
 	Depth = Round (Depth * factor);
@@ -1437,7 +1749,12 @@ inline Cube& operator*= (double factor)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-Cube& operator/= (double factor);
+DIMENSIONS_EXPORT constexpr Cube& operator/= (double factor)
+	{
+	Rectangle::operator/= (factor);
+	Depth = Divide (Depth, factor);
+	return *this;
+	}
 
 /**	Take the intersection with another Cube.
 
@@ -1450,7 +1767,16 @@ Cube& operator/= (double factor);
 		this will result in an {@link is_empty() emtpy} Cube (Width,
 		Height and Depth zero) but the position will be unchanged.
 */
-Cube& operator&= (const Cube& cube);
+DIMENSIONS_EXPORT constexpr Cube& operator&= (const Cube& cube) noexcept
+	{
+	Rectangle::operator&= (static_cast<const Rectangle&>(cube));
+	if (Size_2D::is_empty ())
+		Depth = 0;
+	else
+	if (Depth > cube.Depth)
+		Depth = cube.Depth;
+	return *this;
+	}
 
 /**	Take the union with another Cube.
 
@@ -1461,7 +1787,13 @@ Cube& operator&= (const Cube& cube);
 	@return	This Cube with its position, size and depth set to the
 		union - i.e. the bounding volume - with the other Cube.
 */
-Cube& operator|= (const Cube& cube);
+DIMENSIONS_EXPORT constexpr Cube& operator|= (const Cube& cube) noexcept
+	{
+	Rectangle::operator|= (static_cast<const Rectangle&>(cube));
+	if (Depth < cube.Depth)
+		Depth = cube.Depth;
+	return *this;
+	}
 
 };	//	End of Cube class.
 
@@ -1473,7 +1805,7 @@ Cube& operator|= (const Cube& cube);
 		Depth of the other cube.
 	@see Cube::operator+=(int)
 */
-inline Cube operator+ (const Cube& cube, int amount)
+constexpr Cube operator+ (const Cube& cube, int amount) noexcept
 	{return Cube (cube) += amount;}
 
 /**	Subtract an amount from a Cube Depth.
@@ -1485,7 +1817,7 @@ inline Cube operator+ (const Cube& cube, int amount)
 		Depth of the other cube.
 	@see Cube::operator-=(int)
 */
-inline Cube operator- (const Cube& cube, int amount)
+constexpr Cube operator- (const Cube& cube, int amount) noexcept
 	{return Cube (cube) -= amount;}
 
 /**	Add two Cubes.
@@ -1496,8 +1828,8 @@ inline Cube operator- (const Cube& cube, int amount)
 		and depth amounts of the two Cubes have been added.
 	@see Cube::operator+=(const Cube&)
 */
-inline Cube operator+
-	(const Cube& cube_1, const Cube& cube_2)
+constexpr Cube operator+
+	(const Cube& cube_1, const Cube& cube_2) noexcept
 	{return Cube (cube_1) += cube_2;}
 
 /**	Subtract two Cubes.
@@ -1508,8 +1840,8 @@ inline Cube operator+
 		and depth amounts of the two Cubes have been subtracted.
 	@see Cube::operator-=(const Cube&)
 */
-inline Cube operator-
-	(const Cube& cube_1, const Cube& cube_2)
+constexpr Cube operator-
+	(const Cube& cube_1, const Cube& cube_2) noexcept
 	{return Cube (cube_1) -= cube_2;}
 
 /**	Multiply a Cube by a factor.
@@ -1522,7 +1854,7 @@ inline Cube operator-
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Cube operator* (const Cube& cube, double factor)
+constexpr Cube operator* (const Cube& cube, double factor)
 	{return Cube (cube) *= factor;}
 
 /**	Multiply a Cube by a factor.
@@ -1535,7 +1867,7 @@ inline Cube operator* (const Cube& cube, double factor)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Cube operator* (double factor, const Cube& cube)
+constexpr Cube operator* (double factor, const Cube& cube)
 	{return Cube (cube) *= factor;}
 
 /**	Divide a Cube by a factor.
@@ -1559,7 +1891,7 @@ inline Cube operator* (double factor, const Cube& cube)
 	@throws invalid_argument	If the factor is negative and the size values
 		Dimensions_Type are an unsigned type (as they are by default).
 */
-inline Cube operator/ (const Cube& cube, double factor)
+constexpr Cube operator/ (const Cube& cube, double factor)
 	{return Cube (cube) /= factor;}
 
 /**	Get the intersection of two Cubes.
@@ -1574,8 +1906,8 @@ inline Cube operator/ (const Cube& cube, double factor)
 		this will result in an emtpy Cube (Width, Height and Depth zero)
 		but the position of the first Cube.
 */
-inline Cube operator&
-	(const Cube& cube_1, const Cube& cube_2)
+constexpr Cube operator&
+	(const Cube& cube_1, const Cube& cube_2) noexcept
 	{return Cube (cube_1) &= cube_2;}
 
 /**	Get the union of two Cubes.
@@ -1588,8 +1920,8 @@ inline Cube operator&
 	@return	A Cube with its position, size and depth set to the
 		union - i.e. the bounding volume - of the two Cubes.
 */
-inline Cube& operator|
-	(const Cube& cube_1, const Cube& cube_2)
+constexpr Cube operator|
+	(const Cube& cube_1, const Cube& cube_2) noexcept
 	{return Cube (cube_1) |= cube_2;}
 
 /**	Print a Cube description to an output stream.
@@ -1602,4 +1934,43 @@ std::ostream& operator<< (std::ostream& stream, const Cube& cube);
 
 
 }	//	namespace PIRL
+
+/*==============================================================================
+	Hash functions
+*/
+namespace std
+{
+//!	The hash function of a PIRL::Point_2D.
+template<>
+struct hash<PIRL::Point_2D>
+{
+std::size_t operator() (const PIRL::Point_2D& point) const noexcept
+	{return point.hash ();}
+};
+
+//!	The hash function of a PIRL::Size_2D.
+template<>
+struct hash<PIRL::Size_2D>
+{
+std::size_t operator() (const PIRL::Size_2D& size) const noexcept
+	{return size.hash ();}
+};
+
+//!	The hash function of a PIRL::Rectangle.
+template<>
+struct hash<PIRL::Rectangle>
+{
+std::size_t operator() (const PIRL::Rectangle& rectangle) const noexcept
+	{return rectangle.hash ();}
+};
+
+//!	The hash function of a PIRL::Cube.
+template<>
+struct hash<PIRL::Cube>
+{
+std::size_t operator() (const PIRL::Cube& cube) const noexcept
+	{return cube.hash ();}
+};
+
+}	//	namespace std
 #endif
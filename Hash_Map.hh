@@ -0,0 +1,427 @@
+/*	Hash_Map
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Hash_Map_
+#define _Hash_Map_
+
+#include	"Dimensions.hh"
+
+#include	<cstddef>
+#include	<algorithm>
+#include	<functional>
+#include	<limits>
+#include	<utility>
+#include	<vector>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Hash_Map
+*/
+/**	A <i>Hash_Map</i> is an open addressing hash table that maps keys,
+	such as Rectangles or Cubes, to values.
+
+	The entries are held in flat arrays with a power of two number of
+	slots. A key is placed in the slot selected by the low bits of its
+	hash or, if that slot is occupied, the next free slot after it
+	(linear probing). Beside the keys and values an array of one byte
+	tags marks each slot as empty or holds the high bits of the hash of
+	the key in the slot, so a lookup scans consecutive bytes and only
+	compares keys whose tags match. The table is enlarged when it would
+	become more than MAXIMUM_LOAD_PERCENT full. Removing an entry shifts
+	the following entries of its probe sequence back, so no deleted
+	markers accumulate and lookups never slow with use.
+
+	The hash function must mix the key bits well, since both its low
+	and high bits are used: the std::hash functions of the Point_2D,
+	Size_2D, Rectangle and Cube types do; the std::hash functions of the
+	integer types of most libraries do not.
+
+	<code>
+	Hash_Map<Cube, std::size_t> tile_slots;<br>
+	tile_slots[tile] = slot;<br>
+	if (const std::size_t* found = tile_slots.find (tile))<br>
+		&nbsp;&nbsp;&nbsp;&nbsp;use (*found);
+	</code>
+
+	<b>N.B.</b>: Lookups on a const Hash_Map may be made concurrently;
+	changing the map is not thread safe. Pointers to values are
+	invalidated when an entry is added or removed.
+
+	@param	K	The type of the keys. It must be default constructible,
+		copy or move assignable, and equality comparable.
+	@param	T	The type of the values. It must be default constructible
+		and copy or move assignable.
+	@param	H	The type of the hash function of the keys.
+	@author		Bradford Castalia, UA/PIRL
+	@see	Rectangle::hash()const
+*/
+template<typename K, typename T, typename H = std::hash<K>>
+class Hash_Map
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	The type of the keys.
+typedef K				Key_Type;
+
+//!	The type of the values.
+typedef T				Value_Type;
+
+//!	The type of the hash function.
+typedef H				Hash_Type;
+
+/*==============================================================================
+	Constants
+*/
+//!	The least number of slots of a table that has any entries.
+static constexpr std::size_t
+	MINIMUM_CAPACITY		= 16;
+
+//!	The greatest percent of the slots that may be occupied.
+static constexpr std::size_t
+	MAXIMUM_LOAD_PERCENT	= 75;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs an empty Hash_Map.
+
+	@param	hash	The hash function of the keys.
+*/
+explicit Hash_Map (const H& hash = H ())
+	:	Hash (hash),
+		Count (0)
+	{}
+
+/**	Constructs an empty Hash_Map with room for some entries.
+
+	@param	entries	The number of entries that may be added before the
+		table is enlarged.
+	@param	hash	The hash function of the keys.
+*/
+explicit Hash_Map (std::size_t entries, const H& hash = H ())
+	:	Hash (hash),
+		Count (0)
+	{reserve (entries);}
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of entries.
+
+	@return	The number of entries in the map.
+*/
+std::size_t size () const
+	{return Count;}
+
+/**	Tests if the map is empty.
+
+	@return	true if there are no entries; false otherwise.
+*/
+bool empty () const
+	{return Count == 0;}
+
+/**	Gets the number of slots.
+
+	@return	The number of slots in the table; zero before any entry has
+		been added or room reserved.
+*/
+std::size_t capacity () const
+	{return Tags.size ();}
+
+/**	Finds the value of a key.
+
+	@param	key	The key to be found.
+	@return	A pointer to the value of the key, or NULL if the key is not
+		in the map.
+*/
+T* find (const K& key)
+	{
+	std::size_t
+		slot = locate (key);
+	return (slot == NOT_FOUND) ? NULL : &Values[slot];
+	}
+
+/**	Finds the value of a key.
+
+	@param	key	The key to be found.
+	@return	A pointer to the value of the key, or NULL if the key is not
+		in the map.
+*/
+const T* find (const K& key) const
+	{
+	std::size_t
+		slot = locate (key);
+	return (slot == NOT_FOUND) ? NULL : &Values[slot];
+	}
+
+/**	Tests if a key is in the map.
+
+	@param	key	The key to be found.
+	@return	true if the key is in the map; false otherwise.
+*/
+bool contains (const K& key) const
+	{return locate (key) != NOT_FOUND;}
+
+/**	Applies a function to each entry.
+
+	The entries are visited in slot order, which is not related to the
+	order of the keys.
+
+	@param	function	A function, or function object, that is called
+		with the key and the value of each entry.
+*/
+template<typename Function>
+void for_each (Function function) const
+	{
+	for (std::size_t
+			slot = 0;
+			slot < Tags.size ();
+		  ++slot)
+		if (Tags[slot] != EMPTY)
+			function (Keys[slot], Values[slot]);
+	}
+
+/*==============================================================================
+	Manipulators
+*/
+/**	Adds an entry if its key is not already in the map.
+
+	@param	key	The key of the entry.
+	@param	value	The value of the entry.
+	@return	true if the entry was added; false if the key was already in
+		the map, in which case its value is unchanged.
+*/
+bool insert (const K& key, const T& value)
+	{
+	bool
+		added;
+	std::size_t
+		slot = place (key, added);
+	if (added)
+		Values[slot] = value;
+	return added;
+	}
+
+/**	Gets the value of a key, adding the key if it is not in the map.
+
+	@param	key	The key of the entry.
+	@return	A reference to the value of the key. The value of a key that
+		has been added is default constructed.
+*/
+T& operator[] (const K& key)
+	{
+	bool
+		added;
+	return Values[place (key, added)];
+	}
+
+/**	Removes an entry.
+
+	@param	key	The key of the entry to be removed.
+	@return	true if the entry was removed; false if the key was not in
+		the map.
+*/
+bool erase (const K& key)
+	{
+	std::size_t
+		hole = locate (key);
+	if (hole == NOT_FOUND)
+		return false;
+	const std::size_t
+		mask = Tags.size () - 1;
+	for (std::size_t
+			slot = (hole + 1) & mask;
+			Tags[slot] != EMPTY;
+			slot = (slot + 1) & mask)
+		{
+		//	An entry moves back if the hole is not after its home slot.
+		std::size_t
+			home = Hash (Keys[slot]) & mask;
+		if (((slot - home) & mask) >= ((slot - hole) & mask))
+			{
+			Tags[hole] = Tags[slot];
+			Keys[hole] = std::move (Keys[slot]);
+			Values[hole] = std::move (Values[slot]);
+			hole = slot;
+			}
+		}
+	Tags[hole] = EMPTY;
+	Keys[hole] = K ();
+	Values[hole] = T ();
+	--Count;
+	return true;
+	}
+
+/**	Removes all entries.
+
+	The number of slots is unchanged.
+
+	@return	This Hash_Map.
+*/
+Hash_Map& clear ()
+	{
+	std::fill (Tags.begin (), Tags.end (), EMPTY);
+	std::fill (Keys.begin (), Keys.end (), K ());
+	std::fill (Values.begin (), Values.end (), T ());
+	Count = 0;
+	return *this;
+	}
+
+/**	Ensures that there is room for some entries.
+
+	@param	entries	The number of entries that may be held before the
+		table is enlarged.
+	@return	This Hash_Map.
+*/
+Hash_Map& reserve (std::size_t entries)
+	{
+	std::size_t
+		slots = MINIMUM_CAPACITY;
+	while (slots * MAXIMUM_LOAD_PERCENT < entries * 100)
+		slots <<= 1;
+	if (slots > Tags.size ())
+		rehash (slots);
+	return *this;
+	}
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+static constexpr unsigned char
+	EMPTY		= 0;
+
+static constexpr std::size_t
+	NOT_FOUND	= static_cast<std::size_t>(-1);
+
+//	A nonzero tag from the high bits of a hash.
+static unsigned char tag (std::size_t hash)
+	{return static_cast<unsigned char>
+		(0x80 | (hash >> (std::numeric_limits<std::size_t>::digits - 7)));}
+
+std::size_t locate (const K& key) const
+	{
+	if (Count == 0)
+		return NOT_FOUND;
+	const std::size_t
+		hash = Hash (key),
+		mask = Tags.size () - 1;
+	const unsigned char
+		key_tag = tag (hash);
+	for (std::size_t
+			slot = hash & mask;
+			Tags[slot] != EMPTY;
+			slot = (slot + 1) & mask)
+		if (Tags[slot] == key_tag &&
+			Keys[slot] == key)
+			return slot;
+	return NOT_FOUND;
+	}
+
+std::size_t place (const K& key, bool& added)
+	{
+	const std::size_t
+		hash = Hash (key);
+	const unsigned char
+		key_tag = tag (hash);
+	std::size_t
+		mask = Tags.size () - 1,
+		slot = hash & mask;
+	if (! Tags.empty ())
+		for (;
+			 Tags[slot] != EMPTY;
+			 slot = (slot + 1) & mask)
+			if (Tags[slot] == key_tag &&
+				Keys[slot] == key)
+				{
+				added = false;
+				return slot;
+				}
+	//	The key is absent; only adding it may enlarge the table.
+	if ((Count + 1) * 100 > Tags.size () * MAXIMUM_LOAD_PERCENT)
+		{
+		rehash (Tags.empty () ? MINIMUM_CAPACITY : (Tags.size () << 1));
+		mask = Tags.size () - 1;
+		for (slot = hash & mask;
+			 Tags[slot] != EMPTY;
+			 slot = (slot + 1) & mask) ;
+		}
+	Tags[slot] = key_tag;
+	Keys[slot] = key;
+	++Count;
+	added = true;
+	return slot;
+	}
+
+void rehash (std::size_t slots)
+	{
+	std::vector<unsigned char>
+		tags (slots, EMPTY);
+	std::vector<K>
+		keys (slots);
+	std::vector<T>
+		values (slots);
+	const std::size_t
+		mask = slots - 1;
+	for (std::size_t
+			index = 0;
+			index < Tags.size ();
+		  ++index)
+		{
+		if (Tags[index] == EMPTY)
+			continue;
+		std::size_t
+			slot = Hash (Keys[index]) & mask;
+		while (tags[slot] != EMPTY)
+			slot = (slot + 1) & mask;
+		tags[slot] = Tags[index];
+		keys[slot] = std::move (Keys[index]);
+		values[slot] = std::move (Values[index]);
+		}
+	Tags.swap (tags);
+	Keys.swap (keys);
+	Values.swap (values);
+	}
+
+/*==============================================================================
+	Data
+*/
+H
+	Hash;
+
+//	Indexed by slot.
+std::vector<unsigned char>
+	Tags;
+std::vector<K>
+	Keys;
+std::vector<T>
+	Values;
+
+std::size_t
+	Count;
+
+};	//	class Hash_Map
+
+}	//	namespace PIRL
+#endif
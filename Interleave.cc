@@ -0,0 +1,627 @@
+/*	Interleave
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Interleave.hh"
+#include	"Parallel.hh"
+#include	"endian.hh"
+using namespace PIRL;
+
+#include	<vector>
+using std::vector;
+
+#include	<algorithm>
+using std::min;
+using std::max;
+
+#include	<cstring>
+#include	<cstdint>
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Interleave::ID =
+		"PIRL::Interleave ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+#ifndef DOXYGEN_PROCESSING
+const unsigned int
+	Interleave::TILE_ELEMENTS;
+const std::size_t
+	Interleave::MINIMUM_THREAD_BYTES;
+#endif	//	DOXYGEN_PROCESSING
+
+namespace
+{
+//	The most pixels reversed by one call of swap_bytes.
+const std::size_t
+	SWAP_PIXELS		= 1 << 20;
+
+/*	Transposes the elements of one tile of a rows by columns array.
+
+	The element at row, column of the source array is put at column, row
+	of the target array.
+*/
+typedef void (*Tile_Function)
+	(
+	const unsigned char*	source,
+	unsigned char*			target,
+	std::size_t				rows,
+	std::size_t				columns,
+	std::size_t				first_row,
+	std::size_t				end_row,
+	std::size_t				first_column,
+	std::size_t				end_column,
+	std::size_t				element_bytes,
+	unsigned int			pixel_bytes
+	);
+
+//	Elements that are single pixels of a register type.
+template<typename Word, bool Reverse>
+void
+word_tile
+	(
+	const unsigned char*	source,
+	unsigned char*			target,
+	std::size_t				rows,
+	std::size_t				columns,
+	std::size_t				first_row,
+	std::size_t				end_row,
+	std::size_t				first_column,
+	std::size_t				end_column,
+	std::size_t,
+	unsigned int
+	)
+{
+for (std::size_t
+		column = first_column;
+		column < end_column;
+	  ++column)
+	{
+	unsigned char
+		*element = target + (column * rows + first_row) * sizeof (Word);
+	for (std::size_t
+			row = first_row;
+			row < end_row;
+		  ++row,
+			element += sizeof (Word))
+		{
+		Word
+			value;
+		std::memcpy (&value, source + (row * columns + column) * sizeof (Word),
+			sizeof (Word));
+		if (Reverse)
+			value = PIRL::reversed (value);
+		std::memcpy (element, &value, sizeof (Word));
+		}
+	}
+}
+
+
+//	Elements of any size.
+template<bool Reverse>
+void
+byte_tile
+	(
+	const unsigned char*	source,
+	unsigned char*			target,
+	std::size_t				rows,
+	std::size_t				columns,
+	std::size_t				first_row,
+	std::size_t				end_row,
+	std::size_t				first_column,
+	std::size_t				end_column,
+	std::size_t				element_bytes,
+	unsigned int			pixel_bytes
+	)
+{
+for (std::size_t
+		column = first_column;
+		column < end_column;
+	  ++column)
+	{
+	unsigned char
+		*element = target + (column * rows + first_row) * element_bytes;
+	for (std::size_t
+			row = first_row;
+			row < end_row;
+		  ++row,
+			element += element_bytes)
+		{
+		std::memcpy (element,
+			source + (row * columns + column) * element_bytes, element_bytes);
+		if (Reverse)
+			swap_bytes (element,
+				(unsigned int)(element_bytes / pixel_bytes), pixel_bytes);
+		}
+	}
+}
+
+
+Tile_Function
+tile_function
+	(
+	std::size_t		element_bytes,
+	unsigned int	pixel_bytes,
+	bool			reverse
+	)
+{
+if (element_bytes == pixel_bytes)
+	{
+	switch (pixel_bytes)
+		{
+		case 1:
+			return word_tile<std::uint8_t, false>;
+		case 2:
+			return reverse ?
+				word_tile<std::uint16_t, true> : word_tile<std::uint16_t, false>;
+		case 4:
+			return reverse ?
+				word_tile<std::uint32_t, true> : word_tile<std::uint32_t, false>;
+		case 8:
+			return reverse ?
+				word_tile<std::uint64_t, true> : word_tile<std::uint64_t, false>;
+		}
+	}
+return (reverse && pixel_bytes > 1) ? byte_tile<true> : byte_tile<false>;
+}
+
+
+/*	Gets the sides of the tiles of a rows by columns array.
+
+	Tiles are square, TILE_ELEMENTS on a side, unless the array has fewer
+	rows or columns than that; then the other side is lengthened so the
+	tile has about as many elements as a square tile.
+*/
+void
+tile_sides
+	(
+	std::size_t		rows,
+	std::size_t		columns,
+	std::size_t&	row_side,
+	std::size_t&	column_side
+	)
+{
+const std::size_t
+	side = Interleave::TILE_ELEMENTS;
+row_side = max (std::size_t (1), min (rows, side));
+column_side = max (std::size_t (1), min (columns, side));
+if (row_side < side)
+	column_side = max (std::size_t (1), min (columns, side * side / row_side));
+else
+if (column_side < side)
+	row_side = max (std::size_t (1), min (rows, side * side / column_side));
+}
+
+
+//	Gets the number of tiles in each block of a rows by columns array.
+std::size_t
+block_tiles
+	(
+	std::size_t		rows,
+	std::size_t		columns
+	)
+{
+std::size_t
+	row_side,
+	column_side;
+tile_sides (rows, columns, row_side, column_side);
+return ((rows + row_side - 1) / row_side)
+	* ((columns + column_side - 1) / column_side);
+}
+
+
+/*	Transposes a range of the tiles of blocks of arrays.
+
+	The tiles of each block are numbered across the rows of tiles, and
+	the blocks follow each other.
+*/
+void
+transpose_tiles
+	(
+	const unsigned char*	source,
+	unsigned char*			target,
+	std::size_t				rows,
+	std::size_t				columns,
+	std::size_t				element_bytes,
+	unsigned int			pixel_bytes,
+	Tile_Function			tile,
+	std::size_t				first_tile,
+	std::size_t				end_tile
+	)
+{
+std::size_t
+	row_side,
+	column_side;
+tile_sides (rows, columns, row_side, column_side);
+const std::size_t
+	column_tiles = (columns + column_side - 1) / column_side,
+	tiles = block_tiles (rows, columns),
+	block_bytes = rows * columns * element_bytes;
+for (std::size_t
+		index = first_tile;
+		index < end_tile;
+	  ++index)
+	{
+	std::size_t
+		block = index / tiles,
+		row = ((index % tiles) / column_tiles) * row_side,
+		column = ((index % tiles) % column_tiles) * column_side;
+	tile (source + block * block_bytes, target + block * block_bytes,
+		rows, columns,
+		row, min (row + row_side, rows),
+		column, min (column + column_side, columns),
+		element_bytes, pixel_bytes);
+	}
+}
+
+
+//	Reverses the bytes of each pixel in place.
+void
+reverse_pixels
+	(
+	unsigned char*	data,
+	std::size_t		pixels,
+	unsigned int	pixel_bytes,
+	unsigned int	threads
+	)
+{
+if (pixel_bytes < 2)
+	return;
+parallel_for (pixels, SWAP_PIXELS, threads,
+	[data, pixel_bytes]
+	(unsigned int, std::size_t begin, std::size_t end)
+	{
+	for (;
+		 begin < end;
+		 begin += SWAP_PIXELS)
+		swap_bytes (data + begin * pixel_bytes,
+			(unsigned int)min (SWAP_PIXELS, end - begin), pixel_bytes);
+	});
+}
+
+}	//	local namespace
+
+/*==============================================================================
+	Constructors
+*/
+Interleave::Interleave
+	(
+	const Cube&		cube,
+	unsigned int	pixel_bytes,
+	Organization	source,
+	Organization	target,
+	bool			reverse_bytes
+	)
+	:	Dimensions (cube),
+		Pixel_Bytes (pixel_bytes),
+		Source (source),
+		Target (target),
+		Reverse_Bytes (reverse_bytes),
+		Threads (0)
+{
+if (! Pixel_Bytes)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't transpose pixels of zero bytes.";
+	throw invalid_argument (message.str ());
+	}
+}
+
+/*==============================================================================
+	Accessors
+*/
+std::size_t
+Interleave::size () const
+{
+return static_cast<std::size_t>(Dimensions.Width) * Dimensions.Height
+	* Dimensions.Depth * Pixel_Bytes;
+}
+
+
+std::size_t
+Interleave::pixel_index
+	(
+	const Cube&		cube,
+	Organization	organization,
+	std::size_t		sample,
+	std::size_t		line,
+	std::size_t		band
+	)
+{
+switch (organization)
+	{
+	case BSQ:
+		return (band * cube.Height + line) * cube.Width + sample;
+	case BIL:
+		return (line * cube.Depth + band) * cube.Width + sample;
+	default:
+		return (line * cube.Width + sample) * cube.Depth + band;
+	}
+}
+
+/*==============================================================================
+	Transposition
+*/
+const Interleave&
+Interleave::transpose
+	(
+	const void*		source,
+	void*			target
+	) const
+{
+Shape
+	array = shape (Source, Target);
+transpose_blocks (static_cast<const unsigned char*>(source),
+	static_cast<unsigned char*>(target), array);
+return *this;
+}
+
+
+const Interleave&
+Interleave::transpose
+	(
+	void*			data
+	) const
+{
+unsigned char
+	*pixels = static_cast<unsigned char*>(data);
+if (Source == Target)
+	{
+	if (Reverse_Bytes)
+		reverse_pixels (pixels, size () / Pixel_Bytes, Pixel_Bytes,
+			parallel_threads (Threads, size () / MINIMUM_THREAD_BYTES));
+	}
+else
+if (Source != BSQ &&
+	Target != BSQ)
+	//	BIL <-> BIP.
+	transpose_lines (pixels, Source, Target);
+else
+if (Source != BIP &&
+	Target != BIP)
+	{
+	//	BSQ <-> BIL.
+	permute_lines (pixels, Source, Target);
+	if (Reverse_Bytes)
+		reverse_pixels (pixels, size () / Pixel_Bytes, Pixel_Bytes,
+			parallel_threads (Threads, size () / MINIMUM_THREAD_BYTES));
+	}
+else
+if (Source == BSQ)
+	{
+	//	BSQ -> BIL -> BIP.
+	permute_lines (pixels, BSQ, BIL);
+	transpose_lines (pixels, BIL, BIP);
+	}
+else
+	{
+	//	BIP -> BIL -> BSQ.
+	transpose_lines (pixels, BIP, BIL);
+	permute_lines (pixels, BIL, BSQ);
+	}
+return *this;
+}
+
+
+std::size_t
+Interleave::scratch_size () const
+{
+std::size_t
+	line_scratch = static_cast<std::size_t>(Dimensions.Width)
+		* Dimensions.Depth * Pixel_Bytes
+		* parallel_threads (Threads,
+			min (std::size_t (Dimensions.Height),
+				size () / MINIMUM_THREAD_BYTES)),
+	permute_scratch = static_cast<std::size_t>(Dimensions.Width) * Pixel_Bytes
+		+ (static_cast<std::size_t>(Dimensions.Height) * Dimensions.Depth
+			+ 7) / 8;
+if (Source == Target)
+	return 0;
+if (Source != BSQ &&
+	Target != BSQ)
+	return line_scratch;
+if (Source != BIP &&
+	Target != BIP)
+	return permute_scratch;
+return max (line_scratch, permute_scratch);
+}
+
+/*==============================================================================
+	Helpers
+*/
+Interleave::Shape
+Interleave::shape
+	(
+	Organization	source,
+	Organization	target
+	) const
+{
+const std::size_t
+	width = Dimensions.Width,
+	height = Dimensions.Height,
+	depth = Dimensions.Depth;
+Shape
+	array = {1, 1, width * height * depth, Pixel_Bytes};
+if (source == BSQ && target == BIL)
+	{array.Rows = depth;  array.Columns = height; array.Element_Bytes *= width;}
+else if (source == BIL && target == BSQ)
+	{array.Rows = height; array.Columns = depth;  array.Element_Bytes *= width;}
+else if (source == BIL && target == BIP)
+	{array.Blocks = height; array.Rows = depth; array.Columns = width;}
+else if (source == BIP && target == BIL)
+	{array.Blocks = height; array.Rows = width; array.Columns = depth;}
+else if (source == BSQ && target == BIP)
+	{array.Rows = depth; array.Columns = width * height;}
+else if (source == BIP && target == BSQ)
+	{array.Rows = width * height; array.Columns = depth;}
+return array;
+}
+
+
+void
+Interleave::transpose_blocks
+	(
+	const unsigned char*	source,
+	unsigned char*			target,
+	const Shape&			array
+	) const
+{
+if (array.Rows == 1 ||
+	array.Columns == 1)
+	{
+	//	The transposition is a copy.
+	const std::size_t
+		pixels = size () / Pixel_Bytes;
+	const unsigned int
+		pixel_bytes = Pixel_Bytes;
+	const bool
+		reverse = Reverse_Bytes;
+	parallel_for (pixels, SWAP_PIXELS,
+		parallel_threads (Threads, size () / MINIMUM_THREAD_BYTES),
+		[source, target, pixel_bytes, reverse]
+		(unsigned int, std::size_t begin, std::size_t end)
+		{
+		std::memcpy (target + begin * pixel_bytes, source + begin * pixel_bytes,
+			(end - begin) * pixel_bytes);
+		if (reverse)
+			reverse_pixels (target + begin * pixel_bytes, end - begin,
+				pixel_bytes, 1);
+		});
+	return;
+	}
+const std::size_t
+	tiles = array.Blocks * block_tiles (array.Rows, array.Columns);
+const Tile_Function
+	tile = tile_function (array.Element_Bytes, Pixel_Bytes, Reverse_Bytes);
+const unsigned int
+	pixel_bytes = Pixel_Bytes;
+parallel_for (tiles, 1,
+	parallel_threads (Threads, min (tiles, size () / MINIMUM_THREAD_BYTES)),
+	[source, target, &array, pixel_bytes, tile]
+	(unsigned int, std::size_t first, std::size_t end)
+	{
+	transpose_tiles (source, target, array.Rows, array.Columns,
+		array.Element_Bytes, pixel_bytes, tile, first, end);
+	});
+}
+
+
+//	Transposes each line, BIL <-> BIP, in place through a scratch line.
+void
+Interleave::transpose_lines
+	(
+	unsigned char*	data,
+	Organization	source,
+	Organization	target
+	) const
+{
+const Shape
+	array = shape (source, target);
+const std::size_t
+	line_bytes = array.Rows * array.Columns * array.Element_Bytes,
+	line_tiles = block_tiles (array.Rows, array.Columns);
+const Tile_Function
+	tile = tile_function (array.Element_Bytes, Pixel_Bytes, Reverse_Bytes);
+const unsigned int
+	pixel_bytes = Pixel_Bytes;
+parallel_for (array.Blocks, 1,
+	parallel_threads (Threads,
+		min (array.Blocks, size () / MINIMUM_THREAD_BYTES)),
+	[data, &array, line_bytes, line_tiles, pixel_bytes, tile]
+	(unsigned int, std::size_t first, std::size_t end)
+	{
+	vector<unsigned char>
+		scratch (line_bytes);
+	for (std::size_t
+			line = first;
+			line < end;
+		  ++line)
+		{
+		unsigned char
+			*pixels = data + line * line_bytes;
+		transpose_tiles (pixels, scratch.data (), array.Rows, array.Columns,
+			array.Element_Bytes, pixel_bytes, tile, 0, line_tiles);
+		std::memcpy (pixels, scratch.data (), line_bytes);
+		}
+	});
+}
+
+
+/*	Moves whole sample lines, BSQ <-> BIL, in place along the cycles of
+	the transposition.
+
+	The sample line at each position of the target is pulled from its
+	position in the source; each cycle starts by saving its first line.
+*/
+void
+Interleave::permute_lines
+	(
+	unsigned char*	data,
+	Organization	source,
+	Organization	target
+	) const
+{
+const Shape
+	array = shape (source, target);
+const std::size_t
+	rows = array.Rows,
+	columns = array.Columns,
+	lines = rows * columns,
+	line_bytes = array.Element_Bytes;
+vector<bool>
+	moved (lines, false);
+vector<unsigned char>
+	scratch (line_bytes);
+for (std::size_t
+		start = 0;
+		start < lines;
+	  ++start)
+	{
+	if (moved[start])
+		continue;
+	std::memcpy (scratch.data (), data + start * line_bytes, line_bytes);
+	std::size_t
+		position = start;
+	while (true)
+		{
+		moved[position] = true;
+		//	The target position is column * rows + row.
+		std::size_t
+			from = (position % rows) * columns + position / rows;
+		if (from == start)
+			{
+			std::memcpy (data + position * line_bytes, scratch.data (),
+				line_bytes);
+			break;
+			}
+		std::memcpy (data + position * line_bytes, data + from * line_bytes,
+			line_bytes);
+		position = from;
+		}
+	}
+}
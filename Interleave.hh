@@ -0,0 +1,303 @@
+/*	Interleave
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Interleave_
+#define _Interleave_
+
+#include	"Dimensions.hh"
+
+#include	<cstddef>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Interleave
+*/
+/**	An <i>Interleave</i> reorganizes the pixels of an image cube from one
+	band interleave to another.
+
+	The pixels of an image cube of Width samples, Height lines and Depth
+	bands may be stored in three organizations:
+
+	<dl>
+	<dt>BSQ - band sequential
+		<dd>Each band is a complete image of Height lines of Width
+		samples.
+	<dt>BIL - band interleaved by line
+		<dd>Each line has the Width samples of the line of each band in
+		turn.
+	<dt>BIP - band interleaved by pixel
+		<dd>Each line has, for each sample in turn, the pixel of each
+		band.
+	</dl>
+
+	Every conversion between these organizations is a transposition of a
+	two dimensional array of elements, repeated for each of a number of
+	blocks: BSQ to BIL transposes the bands and lines of whole sample
+	lines; BIL to BIP transposes the bands and samples of each line; BSQ
+	to BIP transposes the bands and all the pixels of a band. The
+	transposition is done in tiles of TILE_ELEMENTS elements on a side -
+	lengthened on one side when the array is narrower than that - so both
+	the source and target of each tile are in the cache, and the tiles
+	are divided among threads. The bytes of each pixel may be reversed,
+	to change the data order, in the same pass. When the source and
+	target organizations are the same the pixels are copied, and
+	reversed if that is enabled.
+
+	A conversion may also be done in place. The BIL to BIP conversion,
+	and its reverse, use a scratch line for each thread; the BSQ to BIL
+	conversion, and its reverse, move whole sample lines along the
+	cycles of the transposition using one scratch sample line and a bit
+	for each sample line of the cube; a BSQ to BIP conversion, and its
+	reverse, is done in place through the BIL organization.
+
+	<code>
+	Interleave bsq_to_bip (cube, sizeof (float), Interleave::BSQ,
+		Interleave::BIP);<br>
+	bsq_to_bip.transpose (bsq_data, bip_data);
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Cube
+*/
+class Interleave
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Image cube pixel organizations.
+enum Organization
+	{
+	BSQ,
+	BIL,
+	BIP
+	};
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The number of elements on a side of a square transposition tile.
+static const unsigned int
+	TILE_ELEMENTS	= 32;
+
+//!	The fewest bytes for which an additional thread will be used.
+static const std::size_t
+	MINIMUM_THREAD_BYTES	= 1 << 20;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs an Interleave.
+
+	@param	cube	The Cube that describes the image dimensions. The
+		position of the Cube is not used.
+	@param	pixel_bytes	The number of bytes in each pixel.
+	@param	source	The Organization of the source pixels.
+	@param	target	The Organization of the target pixels.
+	@param	reverse_bytes	true if the bytes of each pixel are to be
+		reversed; false otherwise.
+	@throws	std::invalid_argument	If the pixel size is zero.
+*/
+Interleave
+	(
+	const Cube&		cube,
+	unsigned int	pixel_bytes,
+	Organization	source,
+	Organization	target,
+	bool			reverse_bytes = false
+	);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the image dimensions.
+
+	@return	The Cube that describes the image dimensions.
+*/
+const Cube& cube () const
+	{return Dimensions;}
+
+/**	Gets the pixel size.
+
+	@return	The number of bytes in each pixel.
+*/
+unsigned int pixel_bytes () const
+	{return Pixel_Bytes;}
+
+/**	Gets the source organization.
+
+	@return	The Organization of the source pixels.
+*/
+Organization source () const
+	{return Source;}
+
+/**	Gets the target organization.
+
+	@return	The Organization of the target pixels.
+*/
+Organization target () const
+	{return Target;}
+
+/**	Tests if pixel bytes are reversed.
+
+	@return	true if the bytes of each pixel are reversed; false otherwise.
+*/
+bool reverse_bytes () const
+	{return Reverse_Bytes;}
+
+/**	Enables or disables reversing pixel bytes.
+
+	@param	enabled	true if the bytes of each pixel are to be reversed;
+		false otherwise.
+	@return	This Interleave.
+*/
+Interleave& reverse_bytes (bool enabled)
+	{Reverse_Bytes = enabled; return *this;}
+
+/**	Gets the maximum number of threads used by a transposition.
+
+	@return	The maximum number of threads. Zero means the number of
+		hardware threads of the host system.
+*/
+unsigned int threads () const
+	{return Threads;}
+
+/**	Sets the maximum number of threads used by a transposition.
+
+	The image is divided among no more threads than there are {@link
+	#MINIMUM_THREAD_BYTES} in the image.
+
+	@param	maximum	The maximum number of threads. Zero means the number
+		of hardware threads of the host system; one means that only the
+		calling thread is used.
+	@return	This Interleave.
+*/
+Interleave& threads (unsigned int maximum)
+	{Threads = maximum; return *this;}
+
+/**	Gets the image size.
+
+	@return	The number of bytes in the image.
+*/
+std::size_t size () const;
+
+/**	Gets the position of a pixel.
+
+	@param	cube	The Cube that describes the image dimensions.
+	@param	organization	The Organization of the image pixels.
+	@param	sample	The sample number of the pixel.
+	@param	line	The line number of the pixel.
+	@param	band	The band number of the pixel.
+	@return	The number of pixels that precede the pixel in the image.
+*/
+static std::size_t pixel_index
+	(
+	const Cube&		cube,
+	Organization	organization,
+	std::size_t		sample,
+	std::size_t		line,
+	std::size_t		band
+	);
+
+/*==============================================================================
+	Transposition
+*/
+/**	Transposes an image into another storage area.
+
+	@param	source	A pointer to the source image pixels.
+	@param	target	A pointer to storage for the target image pixels.
+		This must be at least the image {@link size() size} and must not
+		overlap the source.
+	@return	This Interleave.
+*/
+const Interleave& transpose
+	(
+	const void*		source,
+	void*			target
+	) const;
+
+/**	Transposes an image in place.
+
+	@param	data	A pointer to the image pixels.
+	@return	This Interleave.
+	@see	scratch_size()const
+*/
+const Interleave& transpose
+	(
+	void*			data
+	) const;
+
+/**	Gets the size of the scratch storage used by an in place
+	transposition.
+
+	@return	The largest number of bytes of scratch storage that an in
+		place transposition will allocate.
+*/
+std::size_t scratch_size () const;
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+/*	The transposition of blocks of a Rows by Columns array of elements,
+	each of Element_Bytes.
+*/
+struct Shape
+{
+std::size_t
+	Blocks,
+	Rows,
+	Columns,
+	Element_Bytes;
+};
+
+Shape shape (Organization source, Organization target) const;
+void transpose_blocks (const unsigned char* source, unsigned char* target,
+	const Shape& shape) const;
+void transpose_lines (unsigned char* data, Organization source,
+	Organization target) const;
+void permute_lines (unsigned char* data, Organization source,
+	Organization target) const;
+
+/*==============================================================================
+	Data
+*/
+Cube
+	Dimensions;
+unsigned int
+	Pixel_Bytes;
+Organization
+	Source,
+	Target;
+bool
+	Reverse_Bytes;
+unsigned int
+	Threads;
+
+};	//	class Interleave
+
+}	//	namespace PIRL
+#endif
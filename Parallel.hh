@@ -0,0 +1,145 @@
+/*	Parallel
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Parallel_
+#define _Parallel_
+
+#include	<thread>
+#include	<algorithm>
+#include	<vector>
+#include	<cstddef>
+#include	<system_error>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Parallel
+*/
+/**	Gets the number of threads to use for a divisible job.
+
+	@param	maximum	The maximum number of threads. If zero the number of
+		hardware threads of the host system is used.
+	@param	limit	The most threads that the job can make good use of;
+		usually the amount of work divided by the least amount that is
+		worth giving to a thread.
+	@return	The number of threads, from 1 to the lesser of the maximum
+		and the limit.
+*/
+inline unsigned int
+parallel_threads
+	(
+	unsigned int	maximum,
+	std::size_t		limit
+	)
+{
+if (! maximum)
+	maximum = std::thread::hardware_concurrency ();
+if (maximum > limit)
+	maximum = (unsigned int)limit;
+return maximum ? maximum : 1;
+}
+
+/**	Divides a range among threads.
+
+	The range from zero to the amount is divided into no more than the
+	specified number of contiguous parts; each part, except the last,
+	is a multiple of the grain size. The function is called once for
+	each part with the part number, from zero, and the beginning and
+	end (one past the last) of the part's range:
+
+	<code>
+	function (part, begin, end);
+	</code>
+
+	The first part is done by the calling thread and each other part by
+	a new thread. If a thread can not be started the remaining parts
+	are done by the calling thread. All parts are done when the function
+	returns. Since each part has its own part number, per-part results
+	may be accumulated without locking and merged when all are done.
+
+	<b>N.B.</b>: The function must not throw an exception.
+
+	@param	amount	The size of the range.
+	@param	grain	The size of the units into which the range may be
+		divided. If zero, 1 is used.
+	@param	threads	The maximum number of parts.
+	@param	function	The function, or function object, to be called
+		for each part.
+	@return	The number of parts. This is zero if the amount is zero.
+*/
+template<typename Function>
+unsigned int
+parallel_for
+	(
+	std::size_t		amount,
+	std::size_t		grain,
+	unsigned int	threads,
+	Function		function
+	)
+{
+if (! amount)
+	return 0;
+if (! grain)
+	grain = 1;
+std::size_t
+	units = (amount + grain - 1) / grain;
+if (threads > units)
+	threads = (unsigned int)units;
+if (threads < 2)
+	{
+	function (0u, std::size_t (0), amount);
+	return 1;
+	}
+std::size_t
+	part_size = ((units + threads - 1) / threads) * grain;
+unsigned int
+	parts = (unsigned int)((amount + part_size - 1) / part_size),
+	part = 1;
+std::vector<std::thread>
+	workers;
+workers.reserve (parts - 1);
+try
+	{
+	for (;
+		 part < parts;
+		 part++)
+		workers.push_back (std::thread (function, part, part * part_size,
+			std::min (amount, (part + 1) * part_size)));
+	}
+catch (std::system_error&)
+	{
+	//	No more threads are available; the rest are done here.
+	}
+function (0u, std::size_t (0), part_size);
+for (;
+	 part < parts;
+	 part++)
+	function (part, part * part_size,
+		std::min (amount, (part + 1) * part_size));
+for (std::vector<std::thread>::iterator
+		worker = workers.begin ();
+		worker != workers.end ();
+	  ++worker)
+	worker->join ();
+return parts;
+}
+
+}	//	namespace PIRL
+#endif
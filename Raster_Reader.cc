@@ -0,0 +1,472 @@
+/*	Raster_Reader
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Raster_Reader.hh"
+#include	"endian.hh"
+using namespace PIRL;
+
+#include	<string>
+using std::string;
+
+#include	<vector>
+using std::vector;
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::runtime_error;
+using std::invalid_argument;
+using std::out_of_range;
+
+#ifdef _WIN32
+//	MS/Windows implementation system dependencies.
+#include	<windows.h>
+
+#else
+//	Unix implementation system dependencies.
+#include	<sys/types.h>
+#include	<sys/uio.h>		//	For preadv()
+#include	<fcntl.h>		//	For open()
+#include	<unistd.h>		//	For close()
+#include	<climits>		//	For IOV_MAX
+#include	<cerrno>
+#include	<cstring>		//	For strerror()
+#endif
+
+/*==============================================================================
+	Constants:
+*/
+#ifndef DOXYGEN_PROCESSING
+const char* const
+	Raster_Reader::ID =
+		"PIRL::Raster_Reader ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+const std::size_t
+	Raster_Reader::DEFAULT_MAXIMUM_GAP	= 4096;
+#endif
+
+namespace
+{
+/*	The segments of a window in the file.
+
+	The segment at i, j is at Offset + i * Stride[0] + j * Stride[1],
+	for i < Count[0] and j < Count[1]. Segments are in file order, which
+	is also the order of the window pixels in the file organization.
+*/
+struct Pattern
+{
+unsigned long long
+	Offset;
+std::size_t
+	Segment_Bytes;
+unsigned long long
+	Count[2],
+	Stride[2];
+};
+
+
+Pattern
+segments
+	(
+	const Cube&					image,
+	const Cube&					window,
+	Dimensions_Type				band,
+	unsigned long long			pixel_bytes,
+	Interleave::Organization	organization,
+	unsigned long long			header_bytes
+	)
+{
+const unsigned long long
+	samples = image.Width,
+	lines = image.Height,
+	bands = image.Depth,
+	x = window.X,
+	y = window.Y;
+Pattern
+	pattern;
+switch (organization)
+	{
+	case Interleave::BSQ:
+		pattern.Offset = ((band * lines + y) * samples + x) * pixel_bytes;
+		pattern.Segment_Bytes = window.Width * pixel_bytes;
+		pattern.Count[0] = window.Depth;
+		pattern.Stride[0] = lines * samples * pixel_bytes;
+		pattern.Count[1] = window.Height;
+		pattern.Stride[1] = samples * pixel_bytes;
+		break;
+	case Interleave::BIL:
+		pattern.Offset = ((y * bands + band) * samples + x) * pixel_bytes;
+		pattern.Segment_Bytes = window.Width * pixel_bytes;
+		pattern.Count[0] = window.Height;
+		pattern.Stride[0] = bands * samples * pixel_bytes;
+		pattern.Count[1] = window.Depth;
+		pattern.Stride[1] = samples * pixel_bytes;
+		break;
+	default:
+		pattern.Offset = ((y * samples + x) * bands + band) * pixel_bytes;
+		pattern.Segment_Bytes = window.Depth * pixel_bytes;
+		pattern.Count[0] = window.Height;
+		pattern.Stride[0] = samples * bands * pixel_bytes;
+		pattern.Count[1] = window.Width;
+		pattern.Stride[1] = bands * pixel_bytes;
+	}
+pattern.Offset += header_bytes;
+
+//	Join segments that are adjacent in the file.
+if (pattern.Stride[1] == pattern.Segment_Bytes)
+	{
+	pattern.Segment_Bytes *= pattern.Count[1];
+	pattern.Count[1] = 1;
+	pattern.Stride[1] = pattern.Segment_Bytes;
+	}
+if (pattern.Count[1] == 1 &&
+	pattern.Stride[0] == pattern.Segment_Bytes)
+	{
+	pattern.Segment_Bytes *= pattern.Count[0];
+	pattern.Count[0] = 1;
+	}
+return pattern;
+}
+
+#ifndef _WIN32
+#ifdef IOV_MAX
+const std::size_t
+	VECTORS_LIMIT	= IOV_MAX;
+#else
+const std::size_t
+	VECTORS_LIMIT	= 1024;
+#endif
+
+/*	Reads the bytes at a file offset into a list of vectors.
+
+	Short reads are continued until all the vectors are filled.
+*/
+void
+read_vectors
+	(
+	int					file,
+	unsigned long long	offset,
+	vector<iovec>&		vectors,
+	const string&		pathname
+	)
+{
+iovec
+	*vector = vectors.data ();
+std::size_t
+	count = vectors.size ();
+while (count)
+	{
+	ssize_t
+		amount = preadv (file, vector, (int)count, (off_t)offset);
+	if (amount <= 0)
+		{
+		if (amount < 0 &&
+			errno == EINTR)
+			continue;
+		ostringstream
+			message;
+		message << Raster_Reader::ID << endl
+				<< "Unable to read file \"" << pathname
+					<< "\" at offset " << offset << '.' << endl
+				<< (amount ? strerror (errno) : "End of file.");
+		throw runtime_error (message.str ());
+		}
+	offset += amount;
+	while (count &&
+		   (std::size_t)amount >= vector->iov_len)
+		{
+		amount -= vector->iov_len;
+		++vector;
+		--count;
+		}
+	if (count)
+		{
+		vector->iov_base = static_cast<char*>(vector->iov_base) + amount;
+		vector->iov_len -= amount;
+		}
+	}
+vectors.clear ();
+}
+#endif
+
+}	//	local namespace
+
+/*==============================================================================
+	Constructors
+*/
+Raster_Reader::Raster_Reader
+	(
+	const std::string&			pathname,
+	const Cube&					image,
+	unsigned int				pixel_bytes,
+	Binary_IO::Data_Order		data_order,
+	Interleave::Organization	organization,
+	unsigned long long			header_bytes
+	)
+	:	Pathname (pathname),
+		Image (image),
+		Pixel_Bytes (pixel_bytes),
+		Data_Order (data_order),
+		Organization (organization),
+		Header_Bytes (header_bytes),
+		Maximum_Gap (DEFAULT_MAXIMUM_GAP)
+{
+if (! pixel_bytes)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Invalid pixel size of zero bytes.";
+	throw invalid_argument (message.str ());
+	}
+
+#ifdef _WIN32
+File = CreateFileA (pathname.c_str (), GENERIC_READ,
+	FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING,
+	FILE_ATTRIBUTE_NORMAL, NULL);
+if (File == INVALID_HANDLE_VALUE)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Unable to open file \"" << pathname << "\".";
+	throw runtime_error (message.str ());
+	}
+#else
+File = open (pathname.c_str (), O_RDONLY);
+if (File < 0)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Unable to open file \"" << pathname << "\"." << endl
+			<< strerror (errno);
+	throw runtime_error (message.str ());
+	}
+#endif
+}
+
+
+Raster_Reader::~Raster_Reader ()
+{
+#ifdef _WIN32
+CloseHandle (File);
+#else
+close (File);
+#endif
+}
+
+/*==============================================================================
+	Accessors
+*/
+void
+Raster_Reader::check_window
+	(
+	const Cube&		window,
+	Dimensions_Type	band
+	) const
+{
+if (window.X < 0 ||
+	window.Y < 0 ||
+	(unsigned long long)window.X + window.Width  > Image.Width ||
+	(unsigned long long)window.Y + window.Height > Image.Height ||
+	(unsigned long long)band + window.Depth > Image.Depth)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "The window " << window << " at band " << band << endl
+			<< "is not in the image " << Image << '.';
+	throw out_of_range (message.str ());
+	}
+}
+
+
+vector<Raster_Reader::Byte_Range>
+Raster_Reader::ranges
+	(
+	const Cube&		window,
+	Dimensions_Type	band
+	) const
+{
+check_window (window, band);
+vector<Byte_Range>
+	byte_ranges;
+if (window.is_empty ())
+	return byte_ranges;
+const Pattern
+	pattern = segments (Image, window, band, Pixel_Bytes, Organization,
+		Header_Bytes);
+for (unsigned long long
+		outer = 0;
+		outer < pattern.Count[0];
+	  ++outer)
+	{
+	for (unsigned long long
+			inner = 0;
+			inner < pattern.Count[1];
+		  ++inner)
+		{
+		unsigned long long
+			offset = pattern.Offset
+				+ outer * pattern.Stride[0] + inner * pattern.Stride[1];
+		if (! byte_ranges.empty () &&
+			offset - (byte_ranges.back ().Offset + byte_ranges.back ().Bytes)
+				<= Maximum_Gap)
+			byte_ranges.back ().Bytes =
+				offset + pattern.Segment_Bytes - byte_ranges.back ().Offset;
+		else
+			{
+			Byte_Range
+				range = {offset, pattern.Segment_Bytes};
+			byte_ranges.push_back (range);
+			}
+		}
+	}
+return byte_ranges;
+}
+
+/*==============================================================================
+	Read
+*/
+const Raster_Reader&
+Raster_Reader::read
+	(
+	const Cube&					window,
+	Dimensions_Type				band,
+	void*						data,
+	Interleave::Organization	organization
+	) const
+{
+check_window (window, band);
+if (window.is_empty ())
+	return *this;
+const Pattern
+	pattern = segments (Image, window, band, Pixel_Bytes, Organization,
+		Header_Bytes);
+unsigned char
+	*target = static_cast<unsigned char*>(data);
+
+#ifdef _WIN32
+for (unsigned long long
+		outer = 0;
+		outer < pattern.Count[0];
+	  ++outer)
+	{
+	for (unsigned long long
+			inner = 0;
+			inner < pattern.Count[1];
+		  ++inner)
+		{
+		unsigned long long
+			offset = pattern.Offset
+				+ outer * pattern.Stride[0] + inner * pattern.Stride[1];
+		std::size_t
+			remaining = pattern.Segment_Bytes;
+		while (remaining)
+			{
+			OVERLAPPED
+				position = OVERLAPPED ();
+			position.Offset = (DWORD)offset;
+			position.OffsetHigh = (DWORD)(offset >> 32);
+			DWORD
+				amount = 0,
+				request = (remaining > (1UL << 30)) ?
+					(DWORD)(1UL << 30) : (DWORD)remaining;
+			if (! ReadFile (File, target, request, &amount, &position) ||
+				! amount)
+				{
+				ostringstream
+					message;
+				message << ID << endl
+						<< "Unable to read file \"" << Pathname
+							<< "\" at offset " << offset << '.';
+				throw runtime_error (message.str ());
+				}
+			target += amount;
+			offset += amount;
+			remaining -= amount;
+			}
+		}
+	}
+
+#else
+//	The gap bytes of a range are read into, and discarded from, a sink.
+vector<unsigned char>
+	sink;
+if (Maximum_Gap &&
+	pattern.Count[0] * pattern.Count[1] > 1)
+	sink.resize (Maximum_Gap);
+vector<iovec>
+	vectors;
+unsigned long long
+	range_offset = 0,
+	range_end = 0;
+for (unsigned long long
+		outer = 0;
+		outer < pattern.Count[0];
+	  ++outer)
+	{
+	for (unsigned long long
+			inner = 0;
+			inner < pattern.Count[1];
+		  ++inner)
+		{
+		unsigned long long
+			offset = pattern.Offset
+				+ outer * pattern.Stride[0] + inner * pattern.Stride[1];
+		if (! vectors.empty () &&
+			offset - range_end <= Maximum_Gap &&
+			vectors.size () + 2 <= VECTORS_LIMIT)
+			{
+			if (offset != range_end)
+				{
+				iovec
+					gap = {sink.data (), (std::size_t)(offset - range_end)};
+				vectors.push_back (gap);
+				}
+			}
+		else
+			{
+			if (! vectors.empty ())
+				read_vectors (File, range_offset, vectors, Pathname);
+			range_offset = offset;
+			}
+		iovec
+			segment = {target, pattern.Segment_Bytes};
+		vectors.push_back (segment);
+		target += pattern.Segment_Bytes;
+		range_end = offset + pattern.Segment_Bytes;
+		}
+	}
+read_vectors (File, range_offset, vectors, Pathname);
+#endif
+
+//	Native byte order and the requested organization.
+bool
+	reverse_bytes = Pixel_Bytes > 1 &&
+		((Data_Order == Binary_IO::MSB) != host_is_high_endian ());
+if (reverse_bytes ||
+	organization != Organization)
+	Interleave (window, Pixel_Bytes, Organization, organization, reverse_bytes)
+		.transpose (data);
+return *this;
+}
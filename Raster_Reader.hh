@@ -0,0 +1,311 @@
+/*	Raster_Reader
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Raster_Reader_
+#define _Raster_Reader_
+
+#include	"Dimensions.hh"
+#include	"Binary_IO.hh"
+#include	"Interleave.hh"
+
+#include	<string>
+#include	<cstddef>
+#include	<vector>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Raster_Reader
+*/
+/**	A <i>Raster_Reader</i> reads windows of an image cube from a raster
+	file.
+
+	The file holds a header of some number of bytes followed by the
+	pixels of an image cube of Width samples, Height lines and Depth
+	bands in one of the Interleave organizations, with each pixel of
+	some number of bytes in MSB or LSB order. A window is a Cube in the
+	image - its position is the first sample and line and its Depth is
+	the number of bands - with the number of its first band.
+
+	The bytes of a window are a regular pattern of segments in the
+	file: a segment is the part of an image line in the window for the
+	BSQ and BIL organizations, or the window bands of one pixel for the
+	BIP organization. Segments that are adjacent in the file are joined,
+	so a window of whole lines is a single segment for each band, or for
+	the whole window. The segments are then coalesced into byte {@link
+	ranges(const Cube&, Dimensions_Type)const ranges}: a segment that
+	follows the previous one by no more than the {@link
+	maximum_gap(std::size_t) maximum gap} is read in the same range, and
+	the gap bytes are discarded. Each range is read with vectored
+	positional reads (preadv) that land the segments directly in the
+	window storage, so nothing is copied, and the file position is not
+	used so a Raster_Reader may be used by concurrent threads. The pixels
+	are then put in native byte order and, if requested, in another
+	organization in the same storage.
+
+	<code>
+	Raster_Reader image (pathname, Cube (0, 0, 8192, 8192, 4), 2,<br>
+		&nbsp;&nbsp;&nbsp;&nbsp;Binary_IO::MSB, Interleave::BIL, label_size);<br>
+	std::vector<unsigned short> pixels (tile.area () * tile.Depth);<br>
+	image.read (tile, 0, pixels.data (), Interleave::BIP);
+	</code>
+
+	<b>N.B.</b>: On MS/Windows each segment is read separately.
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Interleave
+*/
+class Raster_Reader
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	A range of bytes in the file.
+struct Byte_Range
+{
+//!	The file offset of the first byte.
+unsigned long long
+	Offset;
+
+//!	The number of bytes.
+std::size_t
+	Bytes;
+};
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The default largest number of unneeded bytes read to join segments.
+static const std::size_t
+	DEFAULT_MAXIMUM_GAP;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Raster_Reader for a file.
+
+	@param	pathname	The pathname of the raster file.
+	@param	image	The Cube that describes the image dimensions. The
+		position of the Cube is not used.
+	@param	pixel_bytes	The number of bytes in each pixel.
+	@param	data_order	The Binary_IO::Data_Order of the pixel bytes.
+	@param	organization	The Interleave::Organization of the pixels.
+	@param	header_bytes	The number of bytes before the first pixel.
+	@throws	std::invalid_argument	If the pixel size is zero.
+	@throws	std::runtime_error	If the file can not be opened.
+*/
+Raster_Reader
+	(
+	const std::string&			pathname,
+	const Cube&					image,
+	unsigned int				pixel_bytes,
+	Binary_IO::Data_Order		data_order,
+	Interleave::Organization	organization,
+	unsigned long long			header_bytes = 0
+	);
+
+//!	Closes the file.
+~Raster_Reader ();
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the file pathname.
+
+	@return	The pathname of the raster file.
+*/
+const std::string& pathname () const
+	{return Pathname;}
+
+/**	Gets the image dimensions.
+
+	@return	The Cube that describes the image dimensions.
+*/
+const Cube& image () const
+	{return Image;}
+
+/**	Gets the pixel size.
+
+	@return	The number of bytes in each pixel.
+*/
+unsigned int pixel_bytes () const
+	{return Pixel_Bytes;}
+
+/**	Gets the byte order of the file pixels.
+
+	@return	The Binary_IO::Data_Order of the pixel bytes.
+*/
+Binary_IO::Data_Order data_order () const
+	{return Data_Order;}
+
+/**	Gets the organization of the file pixels.
+
+	@return	The Interleave::Organization of the pixels.
+*/
+Interleave::Organization organization () const
+	{return Organization;}
+
+/**	Gets the header size.
+
+	@return	The number of bytes before the first pixel.
+*/
+unsigned long long header_bytes () const
+	{return Header_Bytes;}
+
+/**	Gets the maximum gap.
+
+	@return	The largest number of unneeded bytes that are read to join
+		two segments in one range.
+*/
+std::size_t maximum_gap () const
+	{return Maximum_Gap;}
+
+/**	Sets the maximum gap.
+
+	Reading a small gap costs less than another read request; zero
+	reads only the bytes of a window.
+
+	@param	bytes	The largest number of unneeded bytes that are read to
+		join two segments in one range.
+	@return	This Raster_Reader.
+*/
+Raster_Reader& maximum_gap (std::size_t bytes)
+	{Maximum_Gap = bytes; return *this;}
+
+/**	Gets the size of a window.
+
+	@param	window	The Cube of the window; its Depth is the number of
+		bands.
+	@return	The number of bytes of the window pixels.
+*/
+std::size_t size (const Cube& window) const
+	{return static_cast<std::size_t>(window.area ()) * window.Depth
+		* Pixel_Bytes;}
+
+/**	Gets the file byte ranges that are read for a window.
+
+	@param	window	The Cube of the window in the image; its Depth is
+		the number of bands.
+	@param	band	The number of the first band of the window.
+	@return	The coalesced Byte_Ranges, in file order.
+	@throws	std::out_of_range	If the window is not in the image.
+*/
+std::vector<Byte_Range> ranges
+	(
+	const Cube&		window,
+	Dimensions_Type	band = 0
+	) const;
+
+/*==============================================================================
+	Read
+*/
+/**	Reads a window in the file organization.
+
+	@param	window	The Cube of the window in the image; its Depth is
+		the number of bands.
+	@param	band	The number of the first band of the window.
+	@param	data	A pointer to storage for the window pixels, which
+		will be in native byte order. This must be at least the window
+		{@link size(const Cube&)const size}.
+	@return	This Raster_Reader.
+	@throws	std::out_of_range	If the window is not in the image.
+	@throws	std::runtime_error	If the file can not be read.
+*/
+const Raster_Reader& read
+	(
+	const Cube&		window,
+	Dimensions_Type	band,
+	void*			data
+	) const
+	{return read (window, band, data, Organization);}
+
+/**	Reads a window in an organization.
+
+	@param	window	The Cube of the window in the image; its Depth is
+		the number of bands.
+	@param	band	The number of the first band of the window.
+	@param	data	A pointer to storage for the window pixels, which
+		will be in native byte order. This must be at least the window
+		{@link size(const Cube&)const size}.
+	@param	organization	The Interleave::Organization of the window
+		pixels.
+	@return	This Raster_Reader.
+	@throws	std::out_of_range	If the window is not in the image.
+	@throws	std::runtime_error	If the file can not be read.
+*/
+const Raster_Reader& read
+	(
+	const Cube&					window,
+	Dimensions_Type				band,
+	void*						data,
+	Interleave::Organization	organization
+	) const;
+
+/*==============================================================================
+	Data
+*/
+private:
+
+//	A Raster_Reader may not be copied.
+Raster_Reader (const Raster_Reader&);
+Raster_Reader& operator= (const Raster_Reader&);
+
+void check_window (const Cube& window, Dimensions_Type band) const;
+
+std::string
+	Pathname;
+
+Cube
+	Image;
+
+unsigned int
+	Pixel_Bytes;
+
+Binary_IO::Data_Order
+	Data_Order;
+
+Interleave::Organization
+	Organization;
+
+unsigned long long
+	Header_Bytes;
+
+std::size_t
+	Maximum_Gap;
+
+#ifdef _WIN32
+//!	The file handle.
+void*
+	File;
+#else
+//!	The file descriptor.
+int
+	File;
+#endif
+
+};	//	class Raster_Reader
+
+}	//	namespace PIRL
+#endif
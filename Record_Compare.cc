@@ -0,0 +1,548 @@
+/*	Record_Compare
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Record_Compare.hh"
+#include	"Parallel.hh"
+#include	"endian.hh"
+using namespace PIRL;
+
+#include	<vector>
+using std::vector;
+
+#include	<algorithm>
+using std::min;
+using std::fill;
+using std::reverse_copy;
+
+#include	<cstring>
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+using std::out_of_range;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Record_Compare::ID =
+		"PIRL::Record_Compare ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+#ifndef DOXYGEN_PROCESSING
+const unsigned int
+	Record_Compare::BLOCK_RECORDS;
+const Record_Compare::Record_Index
+	Record_Compare::MINIMUM_THREAD_RECORDS;
+#endif	//	DOXYGEN_PROCESSING
+
+namespace
+{
+//	The xxHash64 primes.
+const std::uint64_t
+	PRIME_1	= 0x9E3779B185EBCA87ULL,
+	PRIME_2	= 0xC2B2AE3D27D4EB4FULL,
+	PRIME_3	= 0x165667B19E3779F9ULL,
+	PRIME_4	= 0x85EBCA77C2B2AE63ULL,
+	PRIME_5	= 0x27D4EB2F165667C5ULL;
+
+inline std::uint64_t
+rotate_left
+	(
+	std::uint64_t	value,
+	unsigned int	bits
+	)
+{return (value << bits) | (value >> (64 - bits));}
+
+//	Words of the hashed bytes are assembled LSB first on any host.
+inline std::uint64_t
+word_64
+	(
+	const unsigned char*	bytes
+	)
+{
+std::uint64_t
+	word = 0;
+for (unsigned int
+		index = 8;
+		index--;)
+	word = (word << 8) | bytes[index];
+return word;
+}
+
+
+inline std::uint32_t
+word_32
+	(
+	const unsigned char*	bytes
+	)
+{
+return
+	 std::uint32_t (bytes[0])        |
+	(std::uint32_t (bytes[1]) <<  8) |
+	(std::uint32_t (bytes[2]) << 16) |
+	(std::uint32_t (bytes[3]) << 24);
+}
+
+/*	Mixes the bytes of a span into a hash.
+
+	The steps are those of the xxHash64 algorithm for the trailing bytes
+	of its input.
+*/
+inline std::uint64_t
+mix
+	(
+	std::uint64_t			hash,
+	const unsigned char*	bytes,
+	std::size_t				size
+	)
+{
+while (size >= 8)
+	{
+	hash ^= rotate_left (word_64 (bytes) * PRIME_2, 31) * PRIME_1;
+	hash = rotate_left (hash, 27) * PRIME_1 + PRIME_4;
+	bytes += 8;
+	size -= 8;
+	}
+if (size >= 4)
+	{
+	hash ^= std::uint64_t (word_32 (bytes)) * PRIME_1;
+	hash = rotate_left (hash, 23) * PRIME_2 + PRIME_3;
+	bytes += 4;
+	size -= 4;
+	}
+while (size--)
+	{
+	hash ^= *bytes++ * PRIME_5;
+	hash = rotate_left (hash, 11) * PRIME_1;
+	}
+return hash;
+}
+
+//	Copies values with the order of the bytes of each value reversed.
+void
+reverse_values
+	(
+	const unsigned char*	values,
+	std::size_t				size,
+	std::size_t				value_size,
+	unsigned char*			reversed
+	)
+{
+for (std::size_t
+		value = 0;
+		value < size;
+		value += value_size)
+	{
+	switch (value_size)
+		{
+		case 2:
+			{
+			std::uint16_t
+				bits;
+			std::memcpy (&bits, values + value, 2);
+			bits = reversed_16 (bits);
+			std::memcpy (reversed + value, &bits, 2);
+			break;
+			}
+		case 4:
+			{
+			std::uint32_t
+				bits;
+			std::memcpy (&bits, values + value, 4);
+			bits = reversed_32 (bits);
+			std::memcpy (reversed + value, &bits, 4);
+			break;
+			}
+		case 8:
+			{
+			std::uint64_t
+				bits;
+			std::memcpy (&bits, values + value, 8);
+			bits = reversed_64 (bits);
+			std::memcpy (reversed + value, &bits, 8);
+			break;
+			}
+		default:
+			reverse_copy (values + value, values + value + value_size,
+				reversed + value);
+		}
+	}
+}
+
+/*	Tests if two spans of values are the same.
+
+	If the second values are reversed the order of the bytes of each of
+	its values is the reverse of the first.
+*/
+inline bool
+same_values
+	(
+	const unsigned char*	first,
+	const unsigned char*	second,
+	std::size_t				size,
+	std::size_t				value_size,
+	bool					reversed
+	)
+{
+if (! reversed ||
+	value_size == 1)
+	return ! std::memcmp (first, second, size);
+for (std::size_t
+		value = 0;
+		value < size;
+		value += value_size)
+	for (std::size_t
+			index = 0;
+			index < value_size;
+		  ++index)
+		if (first[value + index] != second[value + value_size - 1 - index])
+			return false;
+return true;
+}
+
+//	The xxHash64 final avalanche.
+inline std::uint64_t
+avalanche
+	(
+	std::uint64_t	hash
+	)
+{
+hash ^= hash >> 33;
+hash *= PRIME_2;
+hash ^= hash >> 29;
+hash *= PRIME_3;
+hash ^= hash >> 32;
+return hash;
+}
+
+}	//	local namespace
+
+/*==============================================================================
+	Constructors
+*/
+Record_Compare::Record_Compare
+	(
+	const Data_Block&	layout,
+	std::size_t			record_size
+	)
+	:	Record_Size (record_size ? record_size : layout.size ()),
+		Layout (layout),
+		Selected (layout.elements (), true),
+		Threads (0)
+{
+if (Record_Size < Layout.size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "The record size of " << Record_Size
+				<< " bytes is less than the layout size of "
+				<< Layout.size () << " bytes.";
+	throw invalid_argument (message.str ());
+	}
+spans ();
+}
+
+/*==============================================================================
+	Elements
+*/
+Record_Compare&
+Record_Compare::select
+	(
+	Index	element
+	)
+{
+check (element);
+Selected[element] = true;
+spans ();
+return *this;
+}
+
+
+Record_Compare&
+Record_Compare::ignore
+	(
+	Index	element
+	)
+{
+check (element);
+Selected[element] = false;
+spans ();
+return *this;
+}
+
+
+Record_Compare&
+Record_Compare::select_all ()
+{
+fill (Selected.begin (), Selected.end (), true);
+spans ();
+return *this;
+}
+
+
+Record_Compare&
+Record_Compare::ignore_all ()
+{
+fill (Selected.begin (), Selected.end (), false);
+spans ();
+return *this;
+}
+
+/*==============================================================================
+	Records
+*/
+Record_Compare::Hash
+Record_Compare::hash
+	(
+	const void*	record,
+	Hash		seed
+	) const
+{
+vector<unsigned char>
+	buffer;
+return normalized_hash
+	(static_cast<const unsigned char*>(record), seed, buffer);
+}
+
+
+void
+Record_Compare::hash
+	(
+	const void*		records,
+	Record_Index	count,
+	Hash*			hashes,
+	Hash			seed
+	) const
+{
+const unsigned char
+	*data = static_cast<const unsigned char*>(records);
+parallel_for (count, BLOCK_RECORDS,
+	parallel_threads (Threads, count / MINIMUM_THREAD_RECORDS),
+	[this, data, hashes, seed]
+	(unsigned int, std::size_t first, std::size_t end)
+	{
+	vector<unsigned char>
+		buffer;
+	for (std::size_t
+			record = first;
+			record < end;
+		  ++record)
+		hashes[record] =
+			normalized_hash (data + record * Record_Size, seed, buffer);
+	});
+}
+
+
+bool
+Record_Compare::equal
+	(
+	const void*				first,
+	const void*				second,
+	Data_Block::Data_Order	second_order
+	) const
+{
+const unsigned char
+	*first_bytes = static_cast<const unsigned char*>(first),
+	*second_bytes = static_cast<const unsigned char*>(second);
+const bool
+	reversed = second_order != Layout.data_order ();
+for (vector<Span>::const_iterator
+		span = Spans.begin ();
+		span != Spans.end ();
+	  ++span)
+	if (! same_values (first_bytes + span->Offset,
+			second_bytes + span->Offset, span->Size, span->Value_Size,
+			reversed))
+		return false;
+return true;
+}
+
+
+Data_Block::Value_List
+Record_Compare::differences
+	(
+	const void*				first,
+	const void*				second,
+	Data_Block::Data_Order	second_order
+	) const
+{
+const unsigned char
+	*first_bytes = static_cast<const unsigned char*>(first),
+	*second_bytes = static_cast<const unsigned char*>(second);
+const bool
+	reversed = second_order != Layout.data_order ();
+Data_Block::Value_List
+	elements;
+for (Index
+		element = 0;
+		element < Selected.size ();
+	  ++element)
+	{
+	if (Selected[element])
+		{
+		Index
+			offset = Layout.offset_of (element);
+		if (! same_values (first_bytes + offset, second_bytes + offset,
+				Layout.size_of (element), value_size (element), reversed))
+			elements.push_back (element);
+		}
+	}
+return elements;
+}
+
+
+Record_Scan::Selection
+Record_Compare::differing
+	(
+	const void*				first,
+	const void*				second,
+	Record_Index			count,
+	Data_Block::Data_Order	second_order
+	) const
+{
+const std::size_t
+	word_bits = Record_Scan::SELECTION_WORD_BITS;
+Record_Scan::Selection
+	selection ((count + word_bits - 1) / word_bits, 0);
+const unsigned char
+	*first_data = static_cast<const unsigned char*>(first),
+	*second_data = static_cast<const unsigned char*>(second);
+Record_Scan::Selection_Word
+	*words = selection.data ();
+
+//	Parts are whole blocks, so no selection word is shared.
+parallel_for (count, BLOCK_RECORDS,
+	parallel_threads (Threads, count / MINIMUM_THREAD_RECORDS),
+	[this, first_data, second_data, words, word_bits, second_order]
+	(unsigned int, std::size_t begin, std::size_t end)
+	{
+	for (std::size_t
+			record = begin;
+			record < end;
+		  ++record)
+		if (! equal (first_data + record * Record_Size,
+				second_data + record * Record_Size, second_order))
+			words[record / word_bits] |=
+				Record_Scan::Selection_Word (1) << (record % word_bits);
+	});
+return selection;
+}
+
+/*==============================================================================
+	Helpers
+*/
+Record_Compare::Hash
+Record_Compare::normalized_hash
+	(
+	const unsigned char*	record,
+	Hash					seed,
+	vector<unsigned char>&	buffer
+	) const
+{
+//	The values are hashed in MSB order.
+const bool
+	reversed = Layout.data_order () != Data_Block::MSB;
+Hash
+	value = seed + PRIME_5;
+for (vector<Span>::const_iterator
+		span = Spans.begin ();
+		span != Spans.end ();
+	  ++span)
+	{
+	const unsigned char
+		*bytes = record + span->Offset;
+	if (reversed &&
+		span->Value_Size > 1)
+		{
+		buffer.resize (span->Size);
+		reverse_values (bytes, span->Size, span->Value_Size, buffer.data ());
+		bytes = buffer.data ();
+		}
+	value = mix (value + span->Size, bytes, span->Size);
+	}
+return avalanche (value);
+}
+
+
+Record_Compare::Index
+Record_Compare::value_size
+	(
+	Index	element
+	) const
+{
+Index
+	size = Layout.size_of (element),
+	value_size = Layout.value_size_of (element);
+//	Elements that are not an array of whole values are single bytes.
+return (value_size && ! (size % value_size)) ? value_size : 1;
+}
+
+
+void
+Record_Compare::spans ()
+{
+Spans.clear ();
+for (Index
+		element = 0;
+		element < Selected.size ();
+	  ++element)
+	{
+	if (! Selected[element] ||
+		! Layout.size_of (element))
+		continue;
+	std::size_t
+		offset = Layout.offset_of (element),
+		size = Layout.size_of (element),
+		values_size = value_size (element);
+	if (! Spans.empty () &&
+		Spans.back ().Offset + Spans.back ().Size == offset &&
+		Spans.back ().Value_Size == values_size)
+		//	Adjacent to the previous span, with the same size values.
+		Spans.back ().Size += size;
+	else
+		{
+		Span
+			span = {offset, size, values_size};
+		Spans.push_back (span);
+		}
+	}
+}
+
+
+void
+Record_Compare::check
+	(
+	Index	element
+	) const
+{
+if (element >= Selected.size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't select element " << element
+				<< " of a layout with " << Layout.elements ()
+				<< " elements.";
+	throw out_of_range (message.str ());
+	}
+}
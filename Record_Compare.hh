@@ -0,0 +1,355 @@
+/*	Record_Compare
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Record_Compare_
+#define _Record_Compare_
+
+#include	"Data_Block.hh"
+#include	"Record_Scan.hh"
+
+#include	<vector>
+#include	<cstddef>
+#include	<cstdint>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Record_Compare
+*/
+/**	A <i>Record_Compare</i> hashes and compares records by the elements
+	of their layout.
+
+	The records are fixed length records that have the structure of a
+	layout Data_Block. Only the {@link select(Index) selected} elements
+	of a record take part in a hash or comparison; initially all the
+	layout elements are selected, and any element may be {@link
+	ignore(Index) ignored}. Record bytes that are not in any element -
+	padding before the first element or after the last - are never
+	used.
+
+	The records are in the {@link Data_Block::data_order()const data
+	order} of the layout, and the size of the values of each element is
+	its {@link Data_Block::value_size_of(Index)const value size}. The
+	values are normalized to MSB order: a record has the same hash
+	whether its layout is in MSB or LSB order and on any host system,
+	so hashes may be stored or compared across systems. Adjacent
+	selected elements with the same value size are combined into
+	contiguous spans of bytes that are hashed or compared as a whole.
+
+	A {@link hash(const void*, Hash)const hash} is a 64-bit value
+	computed from the normalized selected bytes eight at a time, each
+	word assembled LSB first, with the mixing steps of the xxHash64
+	algorithm; it is not the same value as an xxHash64 of the bytes.
+	{@link equal(const void*, const void*)const Equal} records have the
+	same selected values, and the {@link differences(const void*, const
+	void*)const differences} of two records are the selected elements
+	with different values. The other record may be in the layout data
+	order, in which case the bytes are compared directly, or in the
+	reverse order. Each of these has a batch form for arrays of records
+	that is divided among {@link threads(unsigned int) threads}: the
+	hashes of each record, or a Record_Scan::Selection of the records
+	that differ.
+
+	<code>
+	Record_Compare compare (layout);<br>
+	compare.ignore (PROCESSING_TIME);<br>
+	Record_Scan::Selection changed<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;= compare.differing (old_records, new_records, total);
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Data_Block
+	@see	Record_Scan
+*/
+class Record_Compare
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Record number.
+typedef std::size_t				Record_Index;
+
+//!	Data_Block element index.
+typedef Data_Block::Index		Index;
+
+//!	Record hash value.
+typedef std::uint64_t			Hash;
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The number of records processed at a time by a thread.
+static const unsigned int
+	BLOCK_RECORDS	= 256;
+
+//!	The fewest records for which an additional thread will be used.
+static const Record_Index
+	MINIMUM_THREAD_RECORDS	= 65536;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Record_Compare for a record layout.
+
+	All the layout elements are selected.
+
+	@param	layout	A Data_Block that describes the record structure.
+		The data address of the layout is not used.
+	@param	record_size	The number of bytes in each record. If zero
+		the {@link Data_Block::size()const size} of the layout is used.
+	@throws	std::invalid_argument	If the record size is less than the
+		layout size.
+*/
+explicit Record_Compare
+	(
+	const Data_Block&	layout,
+	std::size_t			record_size = 0
+	);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the record layout.
+
+	@return	The Data_Block that describes the record structure.
+*/
+const Data_Block& layout () const
+	{return Layout;}
+
+/**	Gets the record size.
+
+	@return	The number of bytes in each record.
+*/
+std::size_t record_size () const
+	{return Record_Size;}
+
+/**	Gets the maximum number of threads used by a batch operation.
+
+	@return	The maximum number of threads. Zero means the number of
+		hardware threads of the host system.
+*/
+unsigned int threads () const
+	{return Threads;}
+
+/**	Sets the maximum number of threads used by a batch operation.
+
+	Records are divided among no more threads than there are {@link
+	#MINIMUM_THREAD_RECORDS} in the records.
+
+	@param	maximum	The maximum number of threads. Zero means the number
+		of hardware threads of the host system; one means that only the
+		calling thread is used.
+	@return	This Record_Compare.
+*/
+Record_Compare& threads (unsigned int maximum)
+	{Threads = maximum; return *this;}
+
+/*==============================================================================
+	Elements
+*/
+/**	Selects an element.
+
+	@param	element	The index of the layout element.
+	@return	This Record_Compare.
+	@throws	std::out_of_range	If the element is not in the layout.
+*/
+Record_Compare& select (Index element);
+
+/**	Ignores an element.
+
+	@param	element	The index of the layout element.
+	@return	This Record_Compare.
+	@throws	std::out_of_range	If the element is not in the layout.
+*/
+Record_Compare& ignore (Index element);
+
+/**	Selects all the layout elements.
+
+	@return	This Record_Compare.
+*/
+Record_Compare& select_all ();
+
+/**	Ignores all the layout elements.
+
+	@return	This Record_Compare.
+*/
+Record_Compare& ignore_all ();
+
+/**	Tests if an element is selected.
+
+	@param	element	The index of the layout element.
+	@return	true if the element is selected; false otherwise, or if the
+		element is not in the layout.
+*/
+bool selected (Index element) const
+	{return element < Selected.size () && Selected[element];}
+
+/*==============================================================================
+	Records
+*/
+/**	Computes the hash of a record.
+
+	@param	record	A pointer to the first byte of the record.
+	@param	seed	A value that is mixed into the hash.
+	@return	The hash of the selected element values in MSB order.
+*/
+Hash hash (const void* record, Hash seed = 0) const;
+
+/**	Computes the hashes of an array of records.
+
+	@param	records	A pointer to the first byte of the first record.
+	@param	count	The number of records.
+	@param	hashes	A pointer to storage for a Hash of each record.
+	@param	seed	A value that is mixed into each hash.
+*/
+void hash (const void* records, Record_Index count, Hash* hashes,
+	Hash seed = 0) const;
+
+/**	Tests if two records in the layout data order are equal.
+
+	@param	first	A pointer to the first byte of a record.
+	@param	second	A pointer to the first byte of the other record.
+	@return	true if the selected element bytes of the records are equal;
+		false otherwise.
+*/
+bool equal (const void* first, const void* second) const
+	{return equal (first, second, Layout.data_order ());}
+
+/**	Tests if two records are equal.
+
+	@param	first	A pointer to the first byte of a record in the
+		layout data order.
+	@param	second	A pointer to the first byte of the other record.
+	@param	second_order	The Data_Block::Data_Order of the other
+		record.
+	@return	true if the selected element values of the records are
+		equal; false otherwise.
+*/
+bool equal (const void* first, const void* second,
+	Data_Block::Data_Order second_order) const;
+
+/**	Gets the elements that differ between two records in the layout
+	data order.
+
+	@param	first	A pointer to the first byte of a record.
+	@param	second	A pointer to the first byte of the other record.
+	@return	A list of the indices, in increasing order, of the selected
+		elements whose bytes are not equal.
+*/
+Data_Block::Value_List differences (const void* first, const void* second)
+	const
+	{return differences (first, second, Layout.data_order ());}
+
+/**	Gets the elements that differ between two records.
+
+	@param	first	A pointer to the first byte of a record in the
+		layout data order.
+	@param	second	A pointer to the first byte of the other record.
+	@param	second_order	The Data_Block::Data_Order of the other
+		record.
+	@return	A list of the indices, in increasing order, of the selected
+		elements whose values are not equal.
+*/
+Data_Block::Value_List differences (const void* first, const void* second,
+	Data_Block::Data_Order second_order) const;
+
+/**	Finds the records that differ between two arrays of records in the
+	layout data order.
+
+	@param	first	A pointer to the first byte of the first record of
+		an array of records.
+	@param	second	A pointer to the first byte of the first record of
+		the other array of records.
+	@param	count	The number of records in each array.
+	@return	A Record_Scan::Selection with the bit of each record number
+		set for which the records of the two arrays are not equal.
+*/
+Record_Scan::Selection differing (const void* first, const void* second,
+	Record_Index count) const
+	{return differing (first, second, count, Layout.data_order ());}
+
+/**	Finds the records that differ between two arrays of records.
+
+	@param	first	A pointer to the first byte of the first record of
+		an array of records in the layout data order.
+	@param	second	A pointer to the first byte of the first record of
+		the other array of records.
+	@param	count	The number of records in each array.
+	@param	second_order	The Data_Block::Data_Order of the other
+		array of records.
+	@return	A Record_Scan::Selection with the bit of each record number
+		set for which the records of the two arrays are not equal.
+*/
+Record_Scan::Selection differing (const void* first, const void* second,
+	Record_Index count, Data_Block::Data_Order second_order) const;
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+//	A contiguous run of selected element bytes in a record.
+struct Span
+	{
+	std::size_t
+		Offset,
+		Size,
+		Value_Size;
+	};
+
+//	Hashes a record, normalizing values in the buffer.
+Hash normalized_hash (const unsigned char* record, Hash seed,
+	std::vector<unsigned char>& buffer) const;
+
+//	The size of the values of an element; one if they do not fit.
+Index value_size (Index element) const;
+
+//	Rebuilds the spans from the element selections.
+void spans ();
+
+void check (Index element) const;
+
+/*==============================================================================
+	Data
+*/
+std::size_t
+	Record_Size;
+
+Data_Block
+	Layout;
+
+std::vector<bool>
+	Selected;
+
+std::vector<Span>
+	Spans;
+
+unsigned int
+	Threads;
+
+};	//	class Record_Compare
+
+}	//	namespace PIRL
+#endif
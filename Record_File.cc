@@ -0,0 +1,263 @@
+/*	Record_File
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Record_File.hh"
+using namespace PIRL;
+
+#include	<string>
+using std::string;
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::runtime_error;
+using std::invalid_argument;
+using std::out_of_range;
+
+#ifdef _WIN32
+//	MS/Windows implementation system dependencies.
+#include	<windows.h>
+
+#else
+//	Unix implementation system dependencies.
+#include	<sys/types.h>
+#include	<sys/stat.h>
+#include	<sys/mman.h>	//	For mmap(), madvise()
+#include	<fcntl.h>		//	For open()
+#include	<unistd.h>		//	For close(), sysconf()
+#include	<cerrno>
+#include	<cstring>		//	For strerror()
+#endif
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Record_File::ID =
+		"PIRL::Record_File ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+/*==============================================================================
+	Constructors
+*/
+Record_File::Record_File
+	(
+	const std::string&	pathname,
+	const Data_Block&	layout,
+	std::size_t			header_size,
+	std::size_t			record_size,
+	bool				writable
+	)
+	:	Pathname (pathname),
+		Layout (layout),
+		File_Size (0),
+		Header_Size (header_size),
+		Record_Size (record_size ? record_size : layout.size ()),
+		Records (0),
+		Writable (writable),
+		Map (NULL)
+		#ifdef _WIN32
+		, Mapping (NULL)
+		#endif
+{
+if (! Record_Size ||
+	Record_Size < layout.size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Invalid record size " << Record_Size
+				<< " for a layout of size " << layout.size () << '.';
+	throw invalid_argument (message.str ());
+	}
+Layout.data (NULL);
+
+#ifdef _WIN32
+HANDLE
+	file = CreateFileA (pathname.c_str (),
+		writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+		FILE_SHARE_READ | (writable ? 0 : FILE_SHARE_WRITE),
+		NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+if (file == INVALID_HANDLE_VALUE)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Unable to open file \"" << pathname << "\".";
+	throw runtime_error (message.str ());
+	}
+LARGE_INTEGER
+	size;
+if (! GetFileSizeEx (file, &size))
+	{
+	CloseHandle (file);
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Unable to get the size of file \"" << pathname << "\".";
+	throw runtime_error (message.str ());
+	}
+File_Size = (std::size_t)size.QuadPart;
+if (File_Size)
+	{
+	Mapping = CreateFileMappingA (file, NULL,
+		writable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL);
+	if (Mapping)
+		Map = reinterpret_cast<unsigned char*>(MapViewOfFile (Mapping,
+			writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0));
+	}
+CloseHandle (file);
+if (File_Size &&
+	! Map)
+	{
+	if (Mapping)
+		CloseHandle (Mapping);
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Unable to map file \"" << pathname << "\".";
+	throw runtime_error (message.str ());
+	}
+
+#else
+int
+	file = open (pathname.c_str (), writable ? O_RDWR : O_RDONLY);
+if (file < 0)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Unable to open file \"" << pathname << "\"." << endl
+			<< strerror (errno);
+	throw runtime_error (message.str ());
+	}
+struct stat
+	status;
+if (fstat (file, &status))
+	{
+	int
+		error = errno;
+	close (file);
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Unable to get the size of file \"" << pathname << "\"." << endl
+			<< strerror (error);
+	throw runtime_error (message.str ());
+	}
+File_Size = status.st_size;
+if (File_Size)
+	{
+	void*
+		map = mmap (NULL, File_Size,
+			PROT_READ | (writable ? PROT_WRITE : 0),
+			MAP_SHARED, file, 0);
+	if (map == MAP_FAILED)
+		{
+		int
+			error = errno;
+		close (file);
+		ostringstream
+			message;
+		message << ID << endl
+				<< "Unable to map file \"" << pathname << "\"." << endl
+				<< strerror (error);
+		throw runtime_error (message.str ());
+		}
+	Map = reinterpret_cast<unsigned char*>(map);
+	}
+//	The mapping remains valid after the file is closed.
+close (file);
+#endif
+
+if (File_Size > Header_Size)
+	Records = (File_Size - Header_Size) / Record_Size;
+}
+
+
+Record_File::~Record_File ()
+{
+#ifdef _WIN32
+if (Map)
+	UnmapViewOfFile (Map);
+if (Mapping)
+	CloseHandle (Mapping);
+#else
+if (Map)
+	munmap (Map, File_Size);
+#endif
+}
+
+/*==============================================================================
+	Record access
+*/
+Data_Block
+Record_File::record
+	(
+	Record_Index	record
+	)
+	const
+{
+if (record >= Records)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't access record " << record << " of file \""
+				<< Pathname << "\" -" << endl
+			<< "Invalid record (of " << Records << ").";
+	throw out_of_range (message.str ());
+	}
+return (*this)[record];
+}
+
+
+void
+Record_File::prefetch
+	(
+	Record_Index	first,
+	Record_Index	count
+	)
+	const
+{
+if (first >= Records ||
+	! count)
+	return;
+if (count > Records - first)
+	count = Records - first;
+
+#ifdef _WIN32
+#if defined (_WIN32_WINNT) && (_WIN32_WINNT >= 0x0602)
+WIN32_MEMORY_RANGE_ENTRY
+	range;
+range.VirtualAddress = record_data (first);
+range.NumberOfBytes = count * Record_Size;
+PrefetchVirtualMemory (GetCurrentProcess (), 1, &range, 0);
+#endif
+#else
+static const std::size_t
+	Page_Size = sysconf (_SC_PAGESIZE);
+//	madvise requires a page aligned address.
+unsigned char
+	*start = record_data (first),
+	*page = Map + (((std::size_t)(start - Map) / Page_Size) * Page_Size);
+madvise (page, (start - page) + (count * Record_Size), MADV_WILLNEED);
+#endif
+}
@@ -0,0 +1,342 @@
+/*	Record_File
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Record_File_
+#define _Record_File_
+
+#include	"Data_Block.hh"
+
+#include	<string>
+#include	<cstddef>
+#include	<iterator>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Record_File
+*/
+/**	A <i>Record_File</i> provides random access to the fixed length
+	records of a binary file.
+
+	The file is memory mapped. Each record is accessed through a Data_Block
+	that has the structure of a record layout Data_Block and a data
+	pointer directly into the mapped file; no data is copied. Obtaining
+	the Data_Block for any record is a constant time operation that only
+	copies the layout Data_Block (which shares its structure description)
+	and sets its data address. The first access to a record's data will
+	incur at most a page fault for each system memory page spanned by the
+	record.
+
+	The file may begin with a header of any size that precedes the
+	first record. The size of each record is the size of the layout
+	Data_Block, unless a larger record size is specified; any bytes
+	beyond the layout elements are not accessed. Any trailing partial
+	record is ignored.
+
+	The records may be iterated:
+
+	<code>
+	Record_File table ("table.dat", layout, 512);<br>
+	for (Record_File::const_iterator<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;record = table.begin ();<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;record != table.end ();<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;&nbsp;++record)<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;total += (*record).get<int> (VALUE);
+	</code>
+
+	When a range of records is known to be needed soon it may be
+	{@link prefetch(Record_Index, Record_Index)const prefetched} so the
+	system can read the pages ahead of their use.
+
+	<b>N.B.</b>: A Record_File opened read-only maps the file read-only;
+	putting data into a record Data_Block will then fault.
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Data_Block
+*/
+class Record_File
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Record number.
+typedef std::size_t		Record_Index;
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Record_File for a file.
+
+	@param	pathname	The pathname of the file to be mapped.
+	@param	layout	A Data_Block that describes the record structure.
+		The data address of the layout is not used.
+	@param	header_size	The number of bytes preceding the first record.
+	@param	record_size	The number of bytes in each record. If zero
+		the {@link Data_Block::size()const size} of the layout is used.
+	@param	writable	If true the file is opened, and mapped, for
+		reading and writing; otherwise the file is read-only. Changes to
+		record data of a writable Record_File are made directly in the
+		file.
+	@throws	std::invalid_argument	If the record size is less than the
+		layout size, or the record size is zero.
+	@throws	std::runtime_error	If the file can not be opened or mapped.
+*/
+Record_File
+	(
+	const std::string&	pathname,
+	const Data_Block&	layout,
+	std::size_t			header_size = 0,
+	std::size_t			record_size = 0,
+	bool				writable = false
+	);
+
+//!	Unmaps the file.
+~Record_File ();
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the file pathname.
+
+	@return	The pathname of the mapped file.
+*/
+std::string pathname () const
+	{return Pathname;}
+
+/**	Gets the size of the file.
+
+	@return	The size, in bytes, of the file.
+*/
+std::size_t file_size () const
+	{return File_Size;}
+
+/**	Gets the size of the file header.
+
+	@return	The number of bytes preceding the first record.
+*/
+std::size_t header_size () const
+	{return Header_Size;}
+
+/**	Gets the size of each record.
+
+	@return	The number of bytes in each record.
+*/
+std::size_t record_size () const
+	{return Record_Size;}
+
+/**	Gets the number of records in the file.
+
+	@return	The number of complete records following the header.
+*/
+Record_Index records () const
+	{return Records;}
+
+/**	Gets the record layout.
+
+	@return	The Data_Block that describes the record structure. Its data
+		address is not set.
+*/
+const Data_Block& layout () const
+	{return Layout;}
+
+/**	Tests if the file is writable.
+
+	@return	true if the file was opened for writing; false otherwise.
+*/
+bool writable () const
+	{return Writable;}
+
+/*==============================================================================
+	Record access
+*/
+/**	Gets the address of a record.
+
+	<b>N.B.</b>: The record number is not checked.
+
+	@param	record	The record number, starting with 0.
+	@return	A pointer to the first byte of the record in the mapped file.
+*/
+unsigned char* record_data (Record_Index record) const
+	{return Map + Header_Size + (record * Record_Size);}
+
+/**	Gets a Data_Block view of a record.
+
+	@param	record	The record number, starting with 0.
+	@return	A Data_Block with the record layout structure and data order
+		whose data is the record in the mapped file.
+	@throws	std::out_of_range	If the record number is not less than
+		the number of {@link records() records}.
+*/
+Data_Block record (Record_Index record) const;
+
+/**	Gets a Data_Block view of a record.
+
+	<b>N.B.</b>: The record number is not checked.
+
+	@param	record	The record number, starting with 0.
+	@return	A Data_Block for the record.
+	@see	record(Record_Index)const
+*/
+Data_Block operator[] (Record_Index record) const
+	{
+	Data_Block
+		view (Layout);
+	view.data (record_data (record));
+	return view;
+	}
+
+/**	Advises the system that a range of records will be needed soon.
+
+	The system is asked to begin reading the file pages that hold the
+	records so they will be resident when accessed. This is only
+	advice; it does not block and has no effect on the data.
+
+	@param	first	The first record number of the range.
+	@param	count	The number of records in the range. The range is
+		limited to the records in the file.
+*/
+void prefetch (Record_Index first, Record_Index count) const;
+
+/*==============================================================================
+	Iterators
+*/
+/**	A <i>const_iterator</i> steps through the records of a Record_File.
+
+	Dereferencing the iterator provides a Data_Block view of the current
+	record.
+*/
+class const_iterator
+{
+public:
+typedef std::input_iterator_tag	iterator_category;
+typedef Data_Block				value_type;
+typedef std::ptrdiff_t			difference_type;
+typedef const Data_Block*		pointer;
+typedef Data_Block				reference;
+
+const_iterator ()
+	:	File (NULL), Record (0)
+	{}
+
+const_iterator (const Record_File* file, Record_Index record)
+	:	File (file), Record (record)
+	{}
+
+//!	Gets the Data_Block for the current record.
+Data_Block operator* () const
+	{return (*File)[Record];}
+
+//!	Gets the Data_Block for a record relative to the current record.
+Data_Block operator[] (difference_type offset) const
+	{return (*File)[Record + offset];}
+
+//!	Gets the current record number.
+Record_Index record () const
+	{return Record;}
+
+const_iterator& operator++ ()
+	{++Record; return *this;}
+const_iterator operator++ (int)
+	{const_iterator previous (*this); ++Record; return previous;}
+const_iterator& operator-- ()
+	{--Record; return *this;}
+const_iterator operator-- (int)
+	{const_iterator previous (*this); --Record; return previous;}
+const_iterator& operator+= (difference_type offset)
+	{Record += offset; return *this;}
+const_iterator& operator-= (difference_type offset)
+	{Record -= offset; return *this;}
+const_iterator operator+ (difference_type offset) const
+	{return const_iterator (File, Record + offset);}
+const_iterator operator- (difference_type offset) const
+	{return const_iterator (File, Record - offset);}
+difference_type operator- (const const_iterator& other) const
+	{return (difference_type)Record - (difference_type)other.Record;}
+
+bool operator== (const const_iterator& other) const
+	{return Record == other.Record && File == other.File;}
+bool operator!= (const const_iterator& other) const
+	{return ! (*this == other);}
+bool operator< (const const_iterator& other) const
+	{return Record < other.Record;}
+
+private:
+const Record_File
+	*File;
+Record_Index
+	Record;
+};
+
+//!	Gets an iterator at the first record.
+const_iterator begin () const
+	{return const_iterator (this, 0);}
+
+//!	Gets an iterator after the last record.
+const_iterator end () const
+	{return const_iterator (this, Records);}
+
+/*==============================================================================
+	Data
+*/
+private:
+
+//	A Record_File may not be copied.
+Record_File (const Record_File&);
+Record_File& operator= (const Record_File&);
+
+std::string
+	Pathname;
+
+Data_Block
+	Layout;
+
+std::size_t
+	File_Size,
+	Header_Size,
+	Record_Size;
+
+Record_Index
+	Records;
+
+bool
+	Writable;
+
+//!	The mapped file contents; NULL if the file is empty.
+unsigned char*
+	Map;
+
+#ifdef _WIN32
+//!	The file mapping object handle.
+void*
+	Mapping;
+#endif
+
+};	//	class Record_File
+
+}	//	namespace PIRL
+#endif
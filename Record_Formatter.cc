@@ -0,0 +1,343 @@
+/*	Record_Formatter
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Record_Formatter.hh"
+#include	"Parallel.hh"
+using namespace PIRL;
+
+#include	<string>
+using std::string;
+
+#include	<vector>
+using std::vector;
+
+#include	<iostream>
+using std::ostream;
+
+#include	<algorithm>
+using std::min;
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+using std::out_of_range;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Record_Formatter::ID =
+		"PIRL::Record_Formatter ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+#ifndef DOXYGEN_PROCESSING
+const unsigned int
+	Record_Formatter::BLOCK_RECORDS;
+const Record_Formatter::Record_Index
+	Record_Formatter::MINIMUM_THREAD_RECORDS;
+#endif	//	DOXYGEN_PROCESSING
+
+namespace
+{
+//	The storage for the block of values of each column.
+const std::size_t
+	COLUMN_STORAGE = Record_Formatter::BLOCK_RECORDS * sizeof (double);
+
+//	The initial estimate of the characters in a field.
+const std::size_t
+	FIELD_CHARACTERS = 16;
+}
+
+/*==============================================================================
+	Constructors
+*/
+Record_Formatter::Record_Formatter
+	(
+	const void*			records,
+	Record_Index		total_records,
+	const Data_Block&	layout,
+	std::size_t			record_size
+	)
+	:	Data (static_cast<const unsigned char*>(records)),
+		Records (total_records),
+		Record_Size (record_size ? record_size : layout.size ()),
+		Layout (layout),
+		Delimiter (','),
+		Threads (0)
+{
+if (Record_Size < Layout.size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "The record size of " << Record_Size
+				<< " bytes is less than the layout size of "
+				<< Layout.size () << " bytes.";
+	throw invalid_argument (message.str ());
+	}
+}
+
+
+Record_Formatter::Record_Formatter
+	(
+	const Record_File&	file
+	)
+	:	Data (file.records () ? file.record_data (0) : NULL),
+		Records (file.records ()),
+		Record_Size (file.record_size ()),
+		Layout (file.layout ()),
+		Delimiter (','),
+		Threads (0)
+{}
+
+/*==============================================================================
+	Fields
+*/
+void
+Record_Formatter::add
+	(
+	Column&		column
+	)
+{
+Index
+	element = column.Element;
+if (element >= Layout.elements () ||
+	! Layout.value_size_of (element) ||
+	Layout.offset_of (element) + Layout.size_of (element) > Record_Size)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't format element " << element
+				<< " of a layout with " << Layout.elements ()
+				<< " elements" << endl
+			<< "in records of " << Record_Size << " bytes.";
+	throw out_of_range (message.str ());
+	}
+Index
+	size = Layout.value_size_of (element),
+	count = Layout.count_of (element);
+for (Index
+		index = 0;
+		index < count;
+	  ++index)
+	{
+	column.Offset = index * size;
+	Columns.push_back (column);
+	}
+}
+
+/*==============================================================================
+	Formatting
+*/
+std::size_t
+Record_Formatter::format
+	(
+	char*			buffer,
+	std::size_t		size,
+	Record_Index	first,
+	Record_Index	count,
+	Record_Index*	formatted
+	) const
+{
+if (first > Records)
+	first = Records;
+if (count > Records - first)
+	count = Records - first;
+vector<unsigned char>
+	storage (Columns.size () * COLUMN_STORAGE);
+char
+	*cursor = buffer,
+	*last = buffer + size;
+Record_Index
+	done = 0;
+while (done < count)
+	{
+	std::size_t
+		amount = min (Record_Index (BLOCK_RECORDS), count - done);
+	const unsigned char*
+		records = Data + (first + done) * Record_Size;
+	std::size_t
+		column;
+	for (column = 0;
+		 column < Columns.size ();
+	   ++column)
+		Columns[column].Gather (Layout, Columns[column].Element,
+			records + Columns[column].Offset, amount, Record_Size,
+			storage.data () + column * COLUMN_STORAGE);
+
+	for (std::size_t
+			record = 0;
+			record < amount;
+		  ++record)
+		{
+		char
+			*line = cursor;
+		for (column = 0;
+			 column < Columns.size () && cursor;
+		   ++column)
+			{
+			if (column)
+				{
+				if (cursor == last)
+					{
+					cursor = NULL;
+					break;
+					}
+				*cursor++ = Delimiter;
+				}
+			const Column&
+				field = Columns[column];
+			cursor = field.Write
+				(storage.data () + column * COLUMN_STORAGE, record,
+				field.Value_Notation, field.Precision, cursor, last);
+			}
+		if (! cursor ||
+			cursor == last)
+			{
+			//	The line does not fit.
+			if (formatted)
+				*formatted = done + record;
+			return line - buffer;
+			}
+		*cursor++ = '\n';
+		}
+	done += amount;
+	}
+if (formatted)
+	*formatted = done;
+return cursor - buffer;
+}
+
+
+void
+Record_Formatter::format
+	(
+	vector<char>&	text,
+	Record_Index	first,
+	Record_Index	count
+	) const
+{
+std::size_t
+	used = 0;
+text.resize (count * (Columns.size () + 1) * FIELD_CHARACTERS + 1);
+while (count)
+	{
+	Record_Index
+		formatted;
+	used += format (text.data () + used, text.size () - used,
+		first, count, &formatted);
+	first += formatted;
+	count -= formatted;
+	if (count)
+		text.resize (text.size () * 2);
+	}
+text.resize (used);
+}
+
+
+unsigned int
+Record_Formatter::format
+	(
+	vector<vector<char> >&	parts,
+	Record_Index			first,
+	Record_Index			count
+	) const
+{
+unsigned int
+	threads = parallel_threads (Threads, count / MINIMUM_THREAD_RECORDS);
+if (parts.size () < threads)
+	parts.resize (threads);
+return parallel_for (count, BLOCK_RECORDS, threads,
+	[this, &parts, first]
+	(unsigned int part, std::size_t begin, std::size_t end)
+	{format (parts[part], first + begin, end - begin);});
+}
+
+
+string
+Record_Formatter::text
+	(
+	Record_Index	first,
+	Record_Index	count
+	) const
+{
+if (first > Records)
+	first = Records;
+if (count > Records - first)
+	count = Records - first;
+vector<vector<char> >
+	parts;
+unsigned int
+	total_parts = format (parts, first, count);
+std::size_t
+	length = 0;
+unsigned int
+	part;
+for (part = 0;
+	 part < total_parts;
+	 part++)
+	length += parts[part].size ();
+string
+	lines;
+lines.reserve (length);
+for (part = 0;
+	 part < total_parts;
+	 part++)
+	lines.append (parts[part].data (), parts[part].size ());
+return lines;
+}
+
+
+ostream&
+Record_Formatter::write
+	(
+	ostream&		stream,
+	Record_Index	first,
+	Record_Index	count
+	) const
+{
+if (first > Records)
+	first = Records;
+if (count > Records - first)
+	count = Records - first;
+Record_Index
+	batch = MINIMUM_THREAD_RECORDS
+		* parallel_threads (Threads, count / MINIMUM_THREAD_RECORDS);
+vector<vector<char> >
+	parts;
+while (count &&
+		stream)
+	{
+	Record_Index
+		amount = min (batch, count);
+	unsigned int
+		total_parts = format (parts, first, amount);
+	for (unsigned int
+			part = 0;
+			part < total_parts;
+			part++)
+		stream.write (parts[part].data (), parts[part].size ());
+	first += amount;
+	count -= amount;
+	}
+return stream;
+}
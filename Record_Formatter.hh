@@ -0,0 +1,567 @@
+/*	Record_Formatter
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Record_Formatter_
+#define _Record_Formatter_
+
+#include	"Data_Block.hh"
+#include	"Record_File.hh"
+
+#include	<string>
+#include	<vector>
+#include	<iostream>
+#include	<charconv>
+#include	<cstddef>
+#include	<cstring>
+#include	<cstdio>
+#include	<cstdlib>
+#include	<cmath>
+#include	<type_traits>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Record_Formatter
+*/
+/**	A <i>Record_Formatter</i> formats the records of a buffer as
+	delimited text.
+
+	The records are a contiguous sequence of fixed length records, such
+	as those of a Record_File, that have the structure of a layout
+	Data_Block. Each record is formatted as a line of text, ending with
+	a new-line, that has the values of the {@link field(Index, Notation,
+	int) fields} that have been added, in the order they were added,
+	separated by a {@link delimiter(char) delimiter} character: a comma
+	for CSV, or a tab for TSV. All the values of an array element are
+	formatted as successive fields.
+
+	The field values are obtained as the host type with which the field
+	is added, exactly as the layout Data_Block would {@link
+	Data_Block::get(T&, const Index, const Index)const get} them: in the
+	data order of the layout and converted from any {@link
+	Data_Block::value_format(Index, Data_Block::Value_Format) value
+	format} of the element. Each field has its own Notation and
+	precision.
+
+	The values of each field are {@link Data_Block::gather(T*, const
+	Index, const void*, std::size_t, std::size_t)const gathered} from a
+	block of records at a time and formatted with std::to_chars directly
+	into a character buffer; no stream formatting, locale or memory
+	allocation is involved. Where the C++ library has no floating point
+	std::to_chars (before libstdc++ 11, libc++ 14 or MSVC 19.24)
+	floating point values are formatted with std::snprintf instead,
+	which uses the C locale decimal point. Records may be {@link
+	format(char*,
+	std::size_t, Record_Index, Record_Index, Record_Index*)const
+	formatted} into a buffer provided by the application, or large
+	ranges of records may be formatted in parallel by {@link
+	threads(unsigned int) threads} as {@link text()const text} or as
+	they are {@link write(std::ostream&)const written} to a stream.
+
+	<code>
+	Record_Formatter formatter (table);<br>
+	formatter.field<int> (ORBIT)<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;.field<double> (TIME, Record_Formatter::FIXED, 3);<br>
+	std::ofstream file ("table.csv");<br>
+	formatter.write (file);
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Record_File
+	@see	Data_Block
+*/
+class Record_Formatter
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Record number.
+typedef std::size_t				Record_Index;
+
+//!	Data_Block element index.
+typedef Data_Block::Index		Index;
+
+//!	Field value notation.
+enum Notation
+	{
+	/**	The shortest text that reads back as the same value. Integers
+		are decimal.
+	*/
+	SHORTEST,
+	//!	Floating point [-]ddd.ddd; integers are decimal.
+	FIXED,
+	//!	Floating point [-]d.ddde±dd; integers are decimal.
+	SCIENTIFIC,
+	//!	Fixed or scientific, whichever is shorter; integers are decimal.
+	GENERAL,
+	//!	Hexadecimal floating point, without a 0x prefix, or integers.
+	HEXADECIMAL
+	};
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The number of records gathered and formatted at a time.
+static const unsigned int
+	BLOCK_RECORDS	= 256;
+
+//!	The fewest records for which an additional thread will be used.
+static const Record_Index
+	MINIMUM_THREAD_RECORDS	= 16384;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Record_Formatter for a buffer of records.
+
+	@param	records	A pointer to the first byte of the first record.
+	@param	total_records	The number of records in the buffer.
+	@param	layout	A Data_Block that describes the record structure.
+		The data address of the layout is not used.
+	@param	record_size	The number of bytes in each record. If zero
+		the {@link Data_Block::size()const size} of the layout is used.
+	@throws	std::invalid_argument	If the record size is less than the
+		layout size.
+*/
+Record_Formatter
+	(
+	const void*			records,
+	Record_Index		total_records,
+	const Data_Block&	layout,
+	std::size_t			record_size = 0
+	);
+
+/**	Constructs a Record_Formatter for the records of a Record_File.
+
+	@param	file	The Record_File whose records are to be formatted.
+		The file must remain open while the Record_Formatter is used.
+*/
+explicit Record_Formatter (const Record_File& file);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of records.
+
+	@return	The number of records that may be formatted.
+*/
+Record_Index records () const
+	{return Records;}
+
+/**	Gets the record layout.
+
+	@return	The Data_Block that describes the record structure.
+*/
+const Data_Block& layout () const
+	{return Layout;}
+
+/**	Gets the number of fields in each line.
+
+	@return	The number of fields, including each value of an array
+		element.
+*/
+unsigned int fields () const
+	{return (unsigned int)Columns.size ();}
+
+/**	Gets the field delimiter.
+
+	@return	The character that separates the fields of a line.
+*/
+char delimiter () const
+	{return Delimiter;}
+
+/**	Sets the field delimiter.
+
+	@param	character	The character that separates the fields of a
+		line. The default is a comma.
+	@return	This Record_Formatter.
+*/
+Record_Formatter& delimiter (char character)
+	{Delimiter = character; return *this;}
+
+/**	Gets the maximum number of threads used to format text.
+
+	@return	The maximum number of threads. Zero means the number of
+		hardware threads of the host system.
+*/
+unsigned int threads () const
+	{return Threads;}
+
+/**	Sets the maximum number of threads used to format text.
+
+	Records are divided among no more threads than there are {@link
+	#MINIMUM_THREAD_RECORDS} in the records to be formatted.
+
+	@param	maximum	The maximum number of threads. Zero means the number
+		of hardware threads of the host system; one means that only the
+		calling thread is used.
+	@return	This Record_Formatter.
+*/
+Record_Formatter& threads (unsigned int maximum)
+	{Threads = maximum; return *this;}
+
+/*==============================================================================
+	Fields
+*/
+/**	Adds the values of an element as fields.
+
+	@param	T	The host type as which the element values are obtained.
+		This must be an arithmetic type other than bool, no larger than
+		8 bytes.
+	@param	element	The index of the layout element.
+	@param	notation	The Notation of the values.
+	@param	precision	The number of digits after the decimal point of
+		a floating point value, or the number of significant digits for
+		GENERAL notation. If negative the shortest text that reads back
+		as the same value is used. This does not apply to integers.
+	@return	This Record_Formatter.
+	@throws	std::out_of_range	If the element is not in the layout, or
+		its values do not fit within a record.
+*/
+template<typename T>
+Record_Formatter& field
+	(
+	Index		element,
+	Notation	notation = SHORTEST,
+	int			precision = -1
+	)
+	{
+	static_assert (std::is_arithmetic<T>::value &&
+		! std::is_same<T, bool>::value &&
+		sizeof (T) <= sizeof (double),
+		"Record_Formatter values must be arithmetic");
+	Column
+		column;
+	column.Gather = gather<T>;
+	column.Write = write_value<T>;
+	column.Element = element;
+	column.Value_Notation = notation;
+	column.Precision = precision;
+	add (column);
+	return *this;
+	}
+
+/**	Removes all fields.
+
+	@return	This Record_Formatter.
+*/
+Record_Formatter& clear ()
+	{Columns.clear (); return *this;}
+
+/*==============================================================================
+	Formatting
+*/
+/**	Formats records into a buffer.
+
+	Only whole lines are formatted; formatting stops at the first
+	record whose line does not fit in the remainder of the buffer. The
+	text is not NUL terminated.
+
+	@param	buffer	A pointer to the character storage.
+	@param	size	The number of characters available in the buffer.
+	@param	first	The number of the first record to be formatted.
+	@param	count	The number of records to be formatted. This is
+		limited to the records following the first record.
+	@param	formatted	If not NULL the number of records that were
+		formatted is stored here.
+	@return	The number of characters that were stored in the buffer.
+*/
+std::size_t format (char* buffer, std::size_t size,
+	Record_Index first, Record_Index count,
+	Record_Index* formatted = NULL) const;
+
+/**	Formats all the records as text.
+
+	@return	A string with a line for each record.
+	@see	text(Record_Index, Record_Index)const
+*/
+std::string text () const
+	{return text (0, Records);}
+
+/**	Formats a range of records as text.
+
+	The records are divided among threads, each of which formats its
+	part into its own buffer; the buffers are joined when all the
+	threads are done.
+
+	@param	first	The number of the first record to be formatted.
+	@param	count	The number of records to be formatted. This is
+		limited to the records following the first record.
+	@return	A string with a line for each record.
+*/
+std::string text (Record_Index first, Record_Index count) const;
+
+/**	Writes all the records as text to a stream.
+
+	@param	stream	The ostream to which the text is written.
+	@return	The stream.
+	@see	write(std::ostream&, Record_Index, Record_Index)const
+*/
+std::ostream& write (std::ostream& stream) const
+	{return write (stream, 0, Records);}
+
+/**	Writes a range of records as text to a stream.
+
+	The records are formatted in parallel batches; each batch is
+	written, in record order, while the text of the next batch has not
+	yet been formatted.
+
+	@param	stream	The ostream to which the text is written.
+	@param	first	The number of the first record to be written.
+	@param	count	The number of records to be written. This is
+		limited to the records following the first record.
+	@return	The stream.
+*/
+std::ostream& write (std::ostream& stream,
+	Record_Index first, Record_Index count) const;
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+//!	Gathers the element values of a run of records into column storage.
+typedef void (*Gatherer)
+	(
+	const Data_Block&		layout,
+	Index					element,
+	const unsigned char*	records,
+	std::size_t				count,
+	std::size_t				record_size,
+	unsigned char*			values
+	);
+
+/**	Formats a column value; returns the end of the text, or NULL if the
+	text did not fit.
+*/
+typedef char* (*Writer)
+	(
+	const unsigned char*	values,
+	std::size_t				index,
+	Notation				notation,
+	int						precision,
+	char*					first,
+	char*					last
+	);
+
+//	A field for each value of an element.
+struct Column
+	{
+	Gatherer
+		Gather;
+	Writer
+		Write;
+	Index
+		Element;
+	//	The offset of the array value from the first element value.
+	std::size_t
+		Offset;
+	Notation
+		Value_Notation;
+	int
+		Precision;
+	};
+
+void add (Column& column);
+
+//	Formats a range of records into a growing buffer.
+void format (std::vector<char>& text,
+	Record_Index first, Record_Index count) const;
+
+//	Formats a range of records in parallel into part buffers.
+unsigned int format (std::vector<std::vector<char> >& parts,
+	Record_Index first, Record_Index count) const;
+
+template<typename T>
+static void
+gather
+	(
+	const Data_Block&		layout,
+	Index					element,
+	const unsigned char*	records,
+	std::size_t				count,
+	std::size_t				record_size,
+	unsigned char*			values
+	)
+{
+layout.gather (reinterpret_cast<T*>(values), element,
+	records, count, record_size);
+}
+
+template<typename T>
+static char*
+write_value
+	(
+	const unsigned char*	values,
+	std::size_t				index,
+	Notation				notation,
+	int						precision,
+	char*					first,
+	char*					last
+	)
+{
+T
+	value;
+std::memcpy (&value, values + index * sizeof (T), sizeof (T));
+std::to_chars_result
+	result;
+if constexpr (std::is_floating_point<T>::value)
+	{
+#ifndef __cpp_lib_to_chars
+	return write_floating (value, notation, precision, first, last);
+#else
+	std::chars_format
+		format;
+	switch (notation)
+		{
+		case FIXED:			format = std::chars_format::fixed;		break;
+		case SCIENTIFIC:	format = std::chars_format::scientific;	break;
+		case HEXADECIMAL:	format = std::chars_format::hex;		break;
+		default:			format = std::chars_format::general;
+		}
+	if (precision >= 0)
+		result = std::to_chars (first, last, value, format, precision);
+	else if (notation == SHORTEST)
+		result = std::to_chars (first, last, value);
+	else
+		result = std::to_chars (first, last, value, format);
+#endif
+	}
+else
+	result = std::to_chars (first, last, value,
+		(notation == HEXADECIMAL) ? 16 : 10);
+return (result.ec == std::errc ()) ? result.ptr : NULL;
+}
+
+#ifndef __cpp_lib_to_chars
+/*	Formats a floating point value with std::snprintf.
+
+	Without a precision the fewest digits that read back as the same
+	value are used, as std::to_chars would. With those digits the
+	shortest notation is fixed, unless scientific notation is shorter,
+	and the general notation is fixed for exponents from -4 to 5.
+*/
+template<typename T>
+static char*
+write_floating
+	(
+	T			value,
+	Notation	notation,
+	int			precision,
+	char*		first,
+	char*		last
+	)
+{
+char
+	conversion;
+switch (notation)
+	{
+	case FIXED:			conversion = 'f';	break;
+	case SCIENTIFIC:	conversion = 'e';	break;
+	case HEXADECIMAL:	conversion = 'a';	break;
+	default:			conversion = 'g';
+	}
+const bool
+	exact = precision >= 0 || conversion == 'a' || ! std::isfinite (value),
+	either = conversion == 'g' && ! exact;
+if (either)
+	conversion = 'e';
+char
+	format[] = {'%', '.', '*', 'L', conversion, 0};
+if (! std::is_same<T, long double>::value)
+	{
+	format[3] = conversion;
+	format[4] = 0;
+	}
+int
+	digits = exact ? precision : 0,
+	size;
+for (;;
+   ++digits)
+	{
+	size = std::snprintf (first, last - first, format, digits, value);
+	if (size < 0 ||
+		size >= last - first)
+		return NULL;
+	if (exact ||
+		static_cast<T>(std::strtold (first, NULL)) == value)
+		break;
+	}
+if (either)
+	{
+	//	Fixed notation with the same digits.
+	int
+		exponent = std::atoi (std::strchr (first, 'e') + 1),
+		decimals = (digits > exponent) ? (digits - exponent) : 0;
+	format[std::strlen (format) - 1] = 'f';
+	if ((notation == SHORTEST) ?
+			(std::snprintf (NULL, 0, format, decimals, value) <= size) :
+			(exponent >= -4 && exponent < 6))
+		size = std::snprintf (first, last - first, format, decimals, value);
+	if (size >= last - first)
+		return NULL;
+	}
+char
+	*digit = first + (*first == '-');
+if (conversion == 'a' &&
+	digit[0] == '0' &&
+	digit[1] == 'x')
+	{
+	//	Remove the 0x prefix.
+	std::memmove (digit, digit + 2, (first + size) - (digit + 2));
+	size -= 2;
+	}
+return first + size;
+}
+#endif
+
+/*==============================================================================
+	Data
+*/
+const unsigned char*
+	Data;
+
+Record_Index
+	Records;
+
+std::size_t
+	Record_Size;
+
+Data_Block
+	Layout;
+
+std::vector<Column>
+	Columns;
+
+char
+	Delimiter;
+
+unsigned int
+	Threads;
+
+};	//	class Record_Formatter
+
+}	//	namespace PIRL
+#endif
@@ -0,0 +1,325 @@
+/*	Record_Scan
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Record_Scan.hh"
+#include	"Parallel.hh"
+using namespace PIRL;
+
+#include	<vector>
+using std::vector;
+
+#include	<algorithm>
+using std::min;
+using std::fill;
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+using std::out_of_range;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Record_Scan::ID =
+		"PIRL::Record_Scan ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+#ifndef DOXYGEN_PROCESSING
+const unsigned int
+	Record_Scan::SELECTION_WORD_BITS,
+	Record_Scan::SCAN_BLOCK_RECORDS;
+const Record_Scan::Record_Index
+	Record_Scan::MINIMUM_THREAD_RECORDS;
+#endif	//	DOXYGEN_PROCESSING
+
+namespace
+{
+//	The number of selection words in a block of scanned records.
+const std::size_t
+	BLOCK_WORDS = Record_Scan::SCAN_BLOCK_RECORDS
+		/ Record_Scan::SELECTION_WORD_BITS;
+
+unsigned int
+bits_set
+	(
+	Record_Scan::Selection_Word	word
+	)
+{
+#if defined (__GNUC__)
+return __builtin_popcountll (word);
+#else
+unsigned int
+	bits = 0;
+for (; word; word &= word - 1)
+	++bits;
+return bits;
+#endif
+}
+
+unsigned int
+lowest_bit
+	(
+	Record_Scan::Selection_Word	word
+	)
+{
+#if defined (__GNUC__)
+return __builtin_ctzll (word);
+#else
+unsigned int
+	bit = 0;
+for (; ! (word & 1); word >>= 1)
+	++bit;
+return bit;
+#endif
+}
+
+}	//	local namespace
+
+/*==============================================================================
+	Constructors
+*/
+Record_Scan::Record_Scan
+	(
+	const void*			records,
+	Record_Index		total_records,
+	const Data_Block&	layout,
+	std::size_t			record_size
+	)
+	:	Data (static_cast<const unsigned char*>(records)),
+		Records (total_records),
+		Record_Size (record_size ? record_size : layout.size ()),
+		Layout (layout),
+		Threads (0)
+{
+if (Record_Size < Layout.size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "The record size of " << Record_Size
+				<< " bytes is less than the layout size of "
+				<< Layout.size () << " bytes.";
+	throw invalid_argument (message.str ());
+	}
+}
+
+
+Record_Scan::Record_Scan
+	(
+	const Record_File&	file
+	)
+	:	Data (file.records () ? file.record_data (0) : NULL),
+		Records (file.records ()),
+		Record_Size (file.record_size ()),
+		Layout (file.layout ()),
+		Threads (0)
+{}
+
+/*==============================================================================
+	Predicates
+*/
+void
+Record_Scan::add_predicate
+	(
+	const Predicate&	predicate,
+	std::size_t			host_size,
+	bool				host_floating
+	)
+{
+Index
+	element = predicate.Element;
+if (element >= Layout.elements ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't scan element " << element
+				<< " of a layout with " << Layout.elements ()
+				<< " elements.";
+	throw out_of_range (message.str ());
+	}
+Index
+	offset = Layout.offset_of (element),
+	size = Layout.value_size_of (element);
+if (! size ||
+	offset + size > Record_Size)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't scan element " << element
+				<< " with a value of " << size
+				<< " bytes at offset " << offset << endl
+			<< "in records of " << Record_Size << " bytes.";
+	throw out_of_range (message.str ());
+	}
+if (Layout.value_format (element) == Data_Block::UNSPECIFIED_FORMAT &&
+		(host_floating ?
+			size != host_size :
+			size > sizeof (std::uint64_t)))
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't compare the " << size
+				<< " byte values of element " << element
+				<< " as " << host_size << " byte "
+				<< (host_floating ? "floating point" : "integer")
+				<< " values.";
+	throw invalid_argument (message.str ());
+	}
+Predicates.push_back (predicate);
+}
+
+/*==============================================================================
+	Scanning
+*/
+Record_Scan::Selection
+Record_Scan::select () const
+{
+Selection
+	selection ((Records + SELECTION_WORD_BITS - 1) / SELECTION_WORD_BITS);
+if (Predicates.empty ())
+	{
+	fill (selection.begin (), selection.end (), ~Selection_Word (0));
+	if (Records % SELECTION_WORD_BITS)
+		selection.back () =
+			(Selection_Word (1) << (Records % SELECTION_WORD_BITS)) - 1;
+	return selection;
+	}
+
+//	Divide the selection words among the threads by whole blocks.
+Selection_Word*
+	words = selection.data ();
+parallel_for (selection.size (), BLOCK_WORDS,
+	parallel_threads (Threads, Records / MINIMUM_THREAD_RECORDS),
+	[this, words] (unsigned int, std::size_t first, std::size_t end)
+		{scan_words (words, first, end);});
+return selection;
+}
+
+
+void
+Record_Scan::scan_words
+	(
+	Selection_Word*	selection,
+	std::size_t		first_word,
+	std::size_t		end_word
+	) const
+{
+Selection_Word
+	block[BLOCK_WORDS];
+for (std::size_t
+		word = first_word;
+		word < end_word;
+		word += BLOCK_WORDS)
+	{
+	Record_Index
+		first_record = word * SELECTION_WORD_BITS,
+		count = min
+			(Record_Index (SCAN_BLOCK_RECORDS), Records - first_record);
+	const unsigned char*
+		records = Data + first_record * Record_Size;
+	Selection_Word*
+		result = selection + word;
+	std::size_t
+		words = (count + SELECTION_WORD_BITS - 1) / SELECTION_WORD_BITS,
+		index;
+	Predicates[0].Scan
+		(Layout, Predicates[0], records, Record_Size, count, result);
+	for (vector<Predicate>::const_iterator
+			predicate = Predicates.begin () + 1;
+			predicate != Predicates.end ();
+		  ++predicate)
+		{
+		if (predicate->Combine == AND)
+			{
+			//	Nothing is left to be excluded.
+			Selection_Word
+				any = 0;
+			for (index = 0;
+				 index < words;
+			   ++index)
+				any |= result[index];
+			if (! any)
+				continue;
+			}
+		predicate->Scan
+			(Layout, *predicate, records, Record_Size, count, block);
+		if (predicate->Combine == AND)
+			for (index = 0;
+				 index < words;
+			   ++index)
+				result[index] &= block[index];
+		else
+			for (index = 0;
+				 index < words;
+			   ++index)
+				result[index] |= block[index];
+		}
+	}
+}
+
+/*------------------------------------------------------------------------------
+	Selection utilities
+*/
+Record_Scan::Record_Index
+Record_Scan::count
+	(
+	const Selection&	selection
+	)
+{
+Record_Index
+	total = 0;
+for (Selection::const_iterator
+		word = selection.begin ();
+		word != selection.end ();
+	  ++word)
+	total += bits_set (*word);
+return total;
+}
+
+
+vector<Record_Scan::Record_Index>
+Record_Scan::indices
+	(
+	const Selection&	selection
+	)
+{
+vector<Record_Index>
+	records;
+records.reserve (count (selection));
+for (std::size_t
+		index = 0;
+		index < selection.size ();
+	  ++index)
+	{
+	Record_Index
+		base = index * SELECTION_WORD_BITS;
+	for (Selection_Word
+			word = selection[index];
+			word;
+			word &= word - 1)
+		records.push_back (base + lowest_bit (word));
+	}
+return records;
+}
@@ -0,0 +1,541 @@
+/*	Record_Scan
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Record_Scan_
+#define _Record_Scan_
+
+#include	"Data_Block.hh"
+#include	"Record_File.hh"
+
+#include	<vector>
+#include	<cstddef>
+#include	<cstdint>
+#include	<cstring>
+#include	<type_traits>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Record_Scan
+*/
+/**	A <i>Record_Scan</i> selects the records of a buffer that satisfy
+	a set of element value predicates.
+
+	The records are a contiguous sequence of fixed length records, such
+	as those of a Record_File, that have the structure of a layout
+	Data_Block. Each predicate compares the value of one layout element
+	with a constant, or a range of constants, and is combined with the
+	result of the predicates before it by a logical AND or OR; the
+	predicates are evaluated from first to last.
+
+	The element values are compared as the host type of the predicate
+	constant. They are obtained exactly as the layout Data_Block would
+	{@link Data_Block::get(T&, const Index, const Index)const get} them:
+	in the data order of the layout and converted from any {@link
+	Data_Block::value_format(Index, Data_Block::Value_Format) value
+	format} of the element. When an element is an array only its first
+	value is compared.
+
+	Rather than getting the records one at a time, the values of an
+	element are {@link Data_Block::gather(T*, const Index, const void*,
+	std::size_t, std::size_t)const gathered} from a block of records
+	into a host array by a batch conversion that reverses the byte order
+	as it goes, and the array is then compared with the constants in a
+	loop that the compiler can vectorize. The scan is divided among
+	{@link threads(unsigned int) threads} when there are enough records
+	to make this worthwhile.
+
+	The result of a scan is a Selection bitmap with one bit for each
+	record, or a list of the selected record numbers:
+
+	<code>
+	Record_Scan scan (table);<br>
+	scan.where (TEMPERATURE, Record_Scan::GREATER, 250.0)<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;.where (LATITUDE, Record_Scan::IN_RANGE, -30.0, 30.0);<br>
+	std::vector<Record_Scan::Record_Index> hits = scan.indices ();
+	</code>
+
+	<b>N.B.</b>: The record data is only read; it must not be changed
+	while a scan is in progress.
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Record_File
+	@see	Data_Block
+*/
+class Record_Scan
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Record number.
+typedef std::size_t				Record_Index;
+
+//!	Data_Block element index.
+typedef Data_Block::Index		Index;
+
+//!	A word of a Selection bitmap.
+typedef std::uint64_t			Selection_Word;
+
+/**	A record selection bitmap.
+
+	Record n is selected when bit (n % 64) of word (n / 64) is set. Any
+	bits beyond the last record are clear.
+*/
+typedef std::vector<Selection_Word>	Selection;
+
+//!	Predicate comparisons of an element value with the constants.
+enum Comparison
+	{
+	LESS,
+	LESS_EQUAL,
+	EQUAL,
+	NOT_EQUAL,
+	GREATER_EQUAL,
+	GREATER,
+	//!	Value within the inclusive range from the value to the limit.
+	IN_RANGE,
+	//!	Value not within the inclusive range.
+	OUT_OF_RANGE
+	};
+
+//!	How a predicate is combined with the preceding predicates.
+enum Combination
+	{
+	AND,
+	OR
+	};
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The number of bits in a Selection_Word.
+static const unsigned int
+	SELECTION_WORD_BITS	= 64;
+
+//!	The number of records gathered and compared at a time.
+static const unsigned int
+	SCAN_BLOCK_RECORDS	= 256;
+
+//!	The fewest records for which an additional thread will be used.
+static const Record_Index
+	MINIMUM_THREAD_RECORDS	= 65536;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Record_Scan for a buffer of records.
+
+	@param	records	A pointer to the first byte of the first record.
+	@param	total_records	The number of records in the buffer.
+	@param	layout	A Data_Block that describes the record structure.
+		The data address of the layout is not used.
+	@param	record_size	The number of bytes in each record. If zero
+		the {@link Data_Block::size()const size} of the layout is used.
+	@throws	std::invalid_argument	If the record size is less than the
+		layout size.
+*/
+Record_Scan
+	(
+	const void*			records,
+	Record_Index		total_records,
+	const Data_Block&	layout,
+	std::size_t			record_size = 0
+	);
+
+/**	Constructs a Record_Scan for the records of a Record_File.
+
+	@param	file	The Record_File whose records are to be scanned. The
+		file must remain open while the Record_Scan is used.
+*/
+explicit Record_Scan (const Record_File& file);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of records.
+
+	@return	The number of records to be scanned.
+*/
+Record_Index records () const
+	{return Records;}
+
+/**	Gets the size of each record.
+
+	@return	The number of bytes in each record.
+*/
+std::size_t record_size () const
+	{return Record_Size;}
+
+/**	Gets the record layout.
+
+	@return	The Data_Block that describes the record structure.
+*/
+const Data_Block& layout () const
+	{return Layout;}
+
+/**	Gets the number of predicates.
+
+	@return	The number of predicates that will be applied.
+*/
+unsigned int predicates () const
+	{return (unsigned int)Predicates.size ();}
+
+/**	Gets the maximum number of threads used by a scan.
+
+	@return	The maximum number of threads. Zero means the number of
+		hardware threads of the host system.
+*/
+unsigned int threads () const
+	{return Threads;}
+
+/**	Sets the maximum number of threads used by a scan.
+
+	A scan is divided among no more threads than there are {@link
+	#MINIMUM_THREAD_RECORDS} in the records to be scanned.
+
+	@param	maximum	The maximum number of threads. Zero means the number
+		of hardware threads of the host system; one means that the scan
+		is done only by the calling thread.
+	@return	This Record_Scan.
+*/
+Record_Scan& threads (unsigned int maximum)
+	{Threads = maximum; return *this;}
+
+/*==============================================================================
+	Predicates
+*/
+/**	Adds a predicate that is ANDed with the preceding predicates.
+
+	@param	T	The host type as which the element values are compared.
+		This must be an arithmetic type other than bool. A floating
+		point type is 4 or 8 bytes.
+	@param	element	The index of the layout element to be compared.
+	@param	comparison	The Comparison of the element value with the
+		constants.
+	@param	value	The constant with which the element value is
+		compared. For a range comparison this is the low end of the
+		range.
+	@param	limit	The high end of the range for a range comparison;
+		otherwise it is not used.
+	@return	This Record_Scan.
+	@throws	std::out_of_range	If the element is not in the layout, or
+		its first value does not fit within a record.
+	@throws	std::invalid_argument	If the element does not have a
+		value format and its value size is not usable with the host
+		type: larger than 8 bytes for an integer type, or not the size
+		of a floating point type.
+	@see	or_where(Index, Comparison, T, T)
+*/
+template<typename T>
+Record_Scan& where
+	(
+	Index		element,
+	Comparison	comparison,
+	T			value,
+	T			limit = T ()
+	)
+	{return add<T> (element, comparison, value, limit, AND);}
+
+/**	Adds a predicate that is ORed with the preceding predicates.
+
+	@see	where(Index, Comparison, T, T)
+*/
+template<typename T>
+Record_Scan& or_where
+	(
+	Index		element,
+	Comparison	comparison,
+	T			value,
+	T			limit = T ()
+	)
+	{return add<T> (element, comparison, value, limit, OR);}
+
+/**	Removes all predicates.
+
+	@return	This Record_Scan.
+*/
+Record_Scan& clear ()
+	{Predicates.clear (); return *this;}
+
+/*==============================================================================
+	Scanning
+*/
+/**	Scans the records.
+
+	@return	A Selection bitmap of the records that satisfy the
+		predicates. If there are no predicates all records are selected.
+*/
+Selection select () const;
+
+/**	Scans the records.
+
+	@return	A vector of the record numbers, in increasing order, of the
+		records that satisfy the predicates.
+	@see	select()const
+*/
+std::vector<Record_Index> indices () const
+	{return indices (select ());}
+
+/*------------------------------------------------------------------------------
+	Selection utilities
+*/
+/**	Tests if a record is selected.
+
+	<b>N.B.</b>: The record number is not checked.
+
+	@param	selection	A Selection bitmap.
+	@param	record	A record number.
+	@return	true if the record's selection bit is set; false otherwise.
+*/
+static bool selected (const Selection& selection, Record_Index record)
+	{
+	return (selection[record / SELECTION_WORD_BITS] >>
+		(record % SELECTION_WORD_BITS)) & 1;
+	}
+
+/**	Counts the selected records.
+
+	@param	selection	A Selection bitmap.
+	@return	The number of selection bits that are set.
+*/
+static Record_Index count (const Selection& selection);
+
+/**	Lists the selected records.
+
+	@param	selection	A Selection bitmap.
+	@return	A vector of the record numbers, in increasing order, of the
+		selection bits that are set.
+*/
+static std::vector<Record_Index> indices (const Selection& selection);
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+struct Predicate;
+
+//!	Scans a run of records into their selection words.
+typedef void (*Kernel)
+	(
+	const Data_Block&		layout,
+	const Predicate&		predicate,
+	const unsigned char*	records,
+	std::size_t				record_size,
+	Record_Index			count,
+	Selection_Word*			selection
+	);
+
+struct Predicate
+	{
+	Kernel
+		Scan;
+	Index
+		Element;
+	Comparison
+		Compare;
+	Combination
+		Combine;
+	//	The constants, in the bytes of the host type.
+	std::uint64_t
+		Value,
+		Limit;
+	};
+
+template<typename T>
+Record_Scan& add
+	(
+	Index		element,
+	Comparison	comparison,
+	T			value,
+	T			limit,
+	Combination	combination
+	)
+	{
+	static_assert (std::is_arithmetic<T>::value &&
+		! std::is_same<T, bool>::value &&
+		sizeof (T) <= sizeof (std::uint64_t),
+		"Record_Scan values must be arithmetic");
+	static_assert (! std::is_floating_point<T>::value ||
+		sizeof (T) == 4 || sizeof (T) == 8,
+		"Record_Scan floating point values must be 4 or 8 bytes");
+	Predicate
+		predicate;
+	predicate.Scan = scan<T>;
+	predicate.Element = element;
+	predicate.Compare = comparison;
+	predicate.Combine = combination;
+	predicate.Value = predicate.Limit = 0;
+	std::memcpy (&predicate.Value, &value, sizeof (T));
+	std::memcpy (&predicate.Limit, &limit, sizeof (T));
+	add_predicate (predicate, sizeof (T), std::is_floating_point<T>::value);
+	return *this;
+	}
+
+/*	Checks that the predicate element can be compared as the host type
+	and appends the predicate.
+*/
+void add_predicate (const Predicate& predicate,
+	std::size_t host_size, bool host_floating);
+
+//	Scans the records of a range of selection words.
+void scan_words (Selection_Word* selection,
+	std::size_t first_word, std::size_t end_word) const;
+
+/*..............................................................................
+	Kernels
+*/
+template<typename T, Comparison Compare>
+static bool
+compared
+	(
+	T	value,
+	T	low,
+	T	high
+	)
+{
+switch (Compare)
+	{
+	case LESS:			return value <  low;
+	case LESS_EQUAL:	return value <= low;
+	case EQUAL:			return value == low;
+	case NOT_EQUAL:		return value != low;
+	case GREATER_EQUAL:	return value >= low;
+	case GREATER:		return value >  low;
+	case IN_RANGE:		return (low <= value) & (value <= high);
+	case OUT_OF_RANGE:	return ! ((low <= value) & (value <= high));
+	}
+return false;
+}
+
+//	Sets the selection bits of values that satisfy the comparison.
+template<typename T, Comparison Compare>
+static void
+compare
+	(
+	const T*		values,
+	Record_Index	count,
+	T				low,
+	T				high,
+	Selection_Word*	selection
+	)
+{
+while (count)
+	{
+	unsigned int
+		bits = (count < SELECTION_WORD_BITS) ?
+			(unsigned int)count : SELECTION_WORD_BITS;
+	Selection_Word
+		word = 0;
+	for (unsigned int
+			bit = 0;
+			bit < bits;
+		  ++bit)
+		word |= (Selection_Word)compared<T, Compare>
+			(values[bit], low, high) << bit;
+	*selection++ = word;
+	values += bits;
+	count -= bits;
+	}
+}
+
+/*	The Kernel for a host type.
+
+	The records, and their selection words, are taken a block at a time.
+	The first record must be at the start of a selection word.
+*/
+template<typename T>
+static void
+scan
+	(
+	const Data_Block&		layout,
+	const Predicate&		predicate,
+	const unsigned char*	records,
+	std::size_t				record_size,
+	Record_Index			count,
+	Selection_Word*			selection
+	)
+{
+T
+	values[SCAN_BLOCK_RECORDS],
+	low,
+	high;
+std::memcpy (&low,  &predicate.Value, sizeof (T));
+std::memcpy (&high, &predicate.Limit, sizeof (T));
+while (count)
+	{
+	Record_Index
+		amount = (count < SCAN_BLOCK_RECORDS) ? count : SCAN_BLOCK_RECORDS;
+	layout.gather (values, predicate.Element, records, amount, record_size);
+	switch (predicate.Compare)
+		{
+		case LESS:
+			compare<T, LESS> (values, amount, low, high, selection); break;
+		case LESS_EQUAL:
+			compare<T, LESS_EQUAL> (values, amount, low, high, selection); break;
+		case EQUAL:
+			compare<T, EQUAL> (values, amount, low, high, selection); break;
+		case NOT_EQUAL:
+			compare<T, NOT_EQUAL> (values, amount, low, high, selection); break;
+		case GREATER_EQUAL:
+			compare<T, GREATER_EQUAL> (values, amount, low, high, selection); break;
+		case GREATER:
+			compare<T, GREATER> (values, amount, low, high, selection); break;
+		case IN_RANGE:
+			compare<T, IN_RANGE> (values, amount, low, high, selection); break;
+		case OUT_OF_RANGE:
+			compare<T, OUT_OF_RANGE> (values, amount, low, high, selection); break;
+		}
+	records += amount * record_size;
+	selection += SCAN_BLOCK_RECORDS / SELECTION_WORD_BITS;
+	count -= amount;
+	}
+}
+
+/*==============================================================================
+	Data
+*/
+const unsigned char*
+	Data;
+
+Record_Index
+	Records;
+
+std::size_t
+	Record_Size;
+
+Data_Block
+	Layout;
+
+std::vector<Predicate>
+	Predicates;
+
+unsigned int
+	Threads;
+
+};	//	class Record_Scan
+
+}	//	namespace PIRL
+#endif
@@ -0,0 +1,382 @@
+/*	Record_Sort
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Record_Sort.hh"
+#include	"Parallel.hh"
+using namespace PIRL;
+
+#include	<vector>
+using std::vector;
+
+#include	<algorithm>
+using std::min;
+
+#include	<cstring>
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+using std::out_of_range;
+using std::logic_error;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Record_Sort::ID =
+		"PIRL::Record_Sort ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+#ifndef DOXYGEN_PROCESSING
+const unsigned int
+	Record_Sort::BLOCK_RECORDS;
+const Record_Sort::Record_Index
+	Record_Sort::MINIMUM_THREAD_RECORDS;
+#endif	//	DOXYGEN_PROCESSING
+
+namespace
+{
+//	An encoded key and the number of its record.
+struct Entry
+	{
+	std::uint64_t
+		Key;
+	Record_Sort::Record_Index
+		Record;
+	};
+
+const unsigned int
+	DIGITS		= 256;
+
+/*	Moves the entries, ordered by the digit at a bit shift of their keys,
+	to the spare entries and swaps the two.
+
+	Returns false, with the entries unchanged, if all the digits are the
+	same.
+*/
+bool
+radix_pass
+	(
+	vector<Entry>&	entries,
+	vector<Entry>&	spare,
+	unsigned int	shift,
+	unsigned int	threads
+	)
+{
+const std::size_t
+	total = entries.size ();
+vector<vector<Record_Sort::Record_Index> >
+	counts (threads, vector<Record_Sort::Record_Index> (DIGITS, 0));
+Entry
+	*source = entries.data (),
+	*destination = spare.data ();
+
+//	Each part counts its digits.
+unsigned int
+	parts = parallel_for (total, Record_Sort::BLOCK_RECORDS, threads,
+		[source, shift, &counts]
+		(unsigned int part, std::size_t first, std::size_t end)
+		{
+		Record_Sort::Record_Index
+			*count = counts[part].data ();
+		for (std::size_t
+				index = first;
+				index < end;
+			  ++index)
+			++count[(source[index].Key >> shift) & (DIGITS - 1)];
+		});
+
+//	Each part's digits follow the same digits of the preceding parts.
+Record_Sort::Record_Index
+	position = 0;
+for (unsigned int
+		digit = 0;
+		digit < DIGITS;
+	  ++digit)
+	{
+	Record_Sort::Record_Index
+		digit_total = 0;
+	for (unsigned int
+			part = 0;
+			part < parts;
+		  ++part)
+		{
+		Record_Sort::Record_Index
+			count = counts[part][digit];
+		counts[part][digit] = position;
+		position += count;
+		digit_total += count;
+		}
+	if (digit_total == total)
+		return false;
+	}
+
+//	Each part moves its entries to their positions.
+parallel_for (total, Record_Sort::BLOCK_RECORDS, threads,
+	[source, destination, shift, &counts]
+	(unsigned int part, std::size_t first, std::size_t end)
+	{
+	Record_Sort::Record_Index
+		*next = counts[part].data ();
+	for (std::size_t
+			index = first;
+			index < end;
+		  ++index)
+		destination[next[(source[index].Key >> shift) & (DIGITS - 1)]++]
+			= source[index];
+	});
+entries.swap (spare);
+return true;
+}
+
+}	//	local namespace
+
+/*==============================================================================
+	Constructors
+*/
+Record_Sort::Record_Sort
+	(
+	void*				records,
+	Record_Index		total_records,
+	const Data_Block&	layout,
+	std::size_t			record_size
+	)
+	:	Data (static_cast<unsigned char*>(records)),
+		Records (total_records),
+		Record_Size (record_size ? record_size : layout.size ()),
+		Layout (layout),
+		Threads (0),
+		Writable (true)
+{
+if (Record_Size < Layout.size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "The record size of " << Record_Size
+				<< " bytes is less than the layout size of "
+				<< Layout.size () << " bytes.";
+	throw invalid_argument (message.str ());
+	}
+}
+
+
+Record_Sort::Record_Sort
+	(
+	const Record_File&	file
+	)
+	:	Data (file.records () ? file.record_data (0) : NULL),
+		Records (file.records ()),
+		Record_Size (file.record_size ()),
+		Layout (file.layout ()),
+		Threads (0),
+		Writable (file.writable ())
+{}
+
+/*==============================================================================
+	Keys
+*/
+void
+Record_Sort::add_key
+	(
+	const Key&	key,
+	bool		host_floating
+	)
+{
+Index
+	element = key.Element;
+if (element >= Layout.elements ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't sort by element " << element
+				<< " of a layout with " << Layout.elements ()
+				<< " elements.";
+	throw out_of_range (message.str ());
+	}
+Index
+	offset = Layout.offset_of (element),
+	size = Layout.value_size_of (element);
+if (! size ||
+	offset + size > Record_Size)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't sort by element " << element
+				<< " with a value of " << size
+				<< " bytes at offset " << offset << endl
+			<< "in records of " << Record_Size << " bytes.";
+	throw out_of_range (message.str ());
+	}
+if (Layout.value_format (element) == Data_Block::UNSPECIFIED_FORMAT &&
+		(host_floating ?
+			size != key.Size :
+			size > sizeof (std::uint64_t)))
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't sort by the " << size
+				<< " byte values of element " << element
+				<< " as " << key.Size << " byte "
+				<< (host_floating ? "floating point" : "integer")
+				<< " values.";
+	throw invalid_argument (message.str ());
+	}
+Keys.push_back (key);
+}
+
+/*==============================================================================
+	Sorting
+*/
+vector<Record_Sort::Record_Index>
+Record_Sort::permutation () const
+{
+vector<Record_Index>
+	order (Records);
+if (Keys.empty ())
+	{
+	for (Record_Index
+			record = 0;
+			record < Records;
+		  ++record)
+		order[record] = record;
+	return order;
+	}
+
+unsigned int
+	threads = parallel_threads (Threads, Records / MINIMUM_THREAD_RECORDS);
+vector<Entry>
+	entries (Records),
+	spare (Records);
+vector<std::uint64_t>
+	encoded (Records);
+
+//	Least significant key first.
+for (std::size_t
+		key_index = Keys.size ();
+		key_index--;)
+	{
+	const Key&
+		key = Keys[key_index];
+	bool
+		first_pass = (key_index == Keys.size () - 1);
+	std::uint64_t
+		*keys = encoded.data ();
+	Entry
+		*entry = entries.data ();
+	parallel_for (Records, BLOCK_RECORDS, threads,
+		[this, &key, keys] (unsigned int, std::size_t first, std::size_t end)
+		{
+		for (Record_Index
+				record = first;
+				record < end;
+				record += BLOCK_RECORDS)
+			key.Encode (Layout, key.Element, key.Descending,
+				Data + record * Record_Size,
+				min (Record_Index (BLOCK_RECORDS), end - record),
+				Record_Size, keys + record);
+		});
+	//	The entries take the keys of their records.
+	parallel_for (Records, BLOCK_RECORDS, threads,
+		[first_pass, keys, entry]
+		(unsigned int, std::size_t first, std::size_t end)
+		{
+		for (std::size_t
+				index = first;
+				index < end;
+			  ++index)
+			{
+			if (first_pass)
+				entry[index].Record = index;
+			entry[index].Key = keys[entry[index].Record];
+			}
+		});
+
+	for (unsigned int
+			shift = 0;
+			shift < key.Size * 8;
+			shift += 8)
+		radix_pass (entries, spare, shift, threads);
+	}
+
+for (Record_Index
+		record = 0;
+		record < Records;
+	  ++record)
+	order[record] = entries[record].Record;
+return order;
+}
+
+
+Record_Sort&
+Record_Sort::sort ()
+{
+if (! Writable)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't sort the records of a read-only Record_File.";
+	throw logic_error (message.str ());
+	}
+if (Records &&
+	! Keys.empty ())
+	reorder (Data, Record_Size, permutation (), Threads);
+return *this;
+}
+
+
+void
+Record_Sort::reorder
+	(
+	void*						records,
+	std::size_t					record_size,
+	const vector<Record_Index>&	order,
+	unsigned int				threads
+	)
+{
+unsigned char
+	*data = static_cast<unsigned char*>(records);
+vector<unsigned char>
+	buffer (order.size () * record_size);
+unsigned char
+	*sorted = buffer.data ();
+const Record_Index
+	*record = order.data ();
+threads = parallel_threads (threads, order.size () / MINIMUM_THREAD_RECORDS);
+parallel_for (order.size (), BLOCK_RECORDS, threads,
+	[data, sorted, record, record_size]
+	(unsigned int, std::size_t first, std::size_t end)
+	{
+	for (std::size_t
+			index = first;
+			index < end;
+		  ++index)
+		std::memcpy (sorted + index * record_size,
+			data + record[index] * record_size, record_size);
+	});
+parallel_for (buffer.size (), record_size * BLOCK_RECORDS, threads,
+	[data, sorted] (unsigned int, std::size_t first, std::size_t end)
+	{std::memcpy (data + first, sorted + first, end - first);});
+}
@@ -0,0 +1,389 @@
+/*	Record_Sort
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Record_Sort_
+#define _Record_Sort_
+
+#include	"Data_Block.hh"
+#include	"Record_File.hh"
+
+#include	<vector>
+#include	<cstddef>
+#include	<cstdint>
+#include	<cstring>
+#include	<type_traits>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Record_Sort
+*/
+/**	A <i>Record_Sort</i> sorts the records of a buffer by the values of
+	one or more key elements.
+
+	The records are a contiguous sequence of fixed length records, such
+	as those of a writable Record_File, that have the structure of a
+	layout Data_Block. The records are ordered by the first key, then
+	records with equal first keys by the second key, and so on; each key
+	may be ascending or descending. The sort is stable: records with all
+	keys equal remain in their original order.
+
+	The key values are obtained as the host type with which the key is
+	added, exactly as the layout Data_Block would {@link
+	Data_Block::get(T&, const Index, const Index)const get} them: in the
+	data order of the layout and converted from any {@link
+	Data_Block::value_format(Index, Data_Block::Value_Format) value
+	format} of the element. When an element is an array only its first
+	value is used.
+
+	Each key value is encoded as an unsigned integer that has the same
+	order as the value: the sign bit of a signed integer is inverted,
+	and all the bits of a negative floating point value, or only the
+	sign bit of a positive value, are inverted; a descending key is
+	then complemented. The records are then ordered by a least
+	significant digit radix sort of the encoded keys, one byte at a
+	time, that moves only the keys and record numbers; a pass in which
+	all the digits are the same is skipped. Each pass is divided among
+	{@link threads(unsigned int) threads}: each thread counts the digits
+	of its part of the keys, and then moves them to the positions that
+	the combined counts assign to it.
+
+	<code>
+	Record_Sort sorter (table);<br>
+	sorter.key<double> (TIME_TAG)<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;.key<int> (ORBIT, Record_Sort::DESCENDING);<br>
+	sorter.sort ();
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Record_File
+	@see	Data_Block
+*/
+class Record_Sort
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Record number.
+typedef std::size_t				Record_Index;
+
+//!	Data_Block element index.
+typedef Data_Block::Index		Index;
+
+//!	Key sort direction.
+enum Direction
+	{
+	ASCENDING,
+	DESCENDING
+	};
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The number of records gathered and encoded at a time.
+static const unsigned int
+	BLOCK_RECORDS	= 256;
+
+//!	The fewest records for which an additional thread will be used.
+static const Record_Index
+	MINIMUM_THREAD_RECORDS	= 65536;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Record_Sort for a buffer of records.
+
+	@param	records	A pointer to the first byte of the first record.
+	@param	total_records	The number of records in the buffer.
+	@param	layout	A Data_Block that describes the record structure.
+		The data address of the layout is not used.
+	@param	record_size	The number of bytes in each record. If zero
+		the {@link Data_Block::size()const size} of the layout is used.
+	@throws	std::invalid_argument	If the record size is less than the
+		layout size.
+*/
+Record_Sort
+	(
+	void*				records,
+	Record_Index		total_records,
+	const Data_Block&	layout,
+	std::size_t			record_size = 0
+	);
+
+/**	Constructs a Record_Sort for the records of a Record_File.
+
+	<b>N.B.</b>: The Record_File must be writable for its records to be
+	{@link sort() sorted}; a {@link permutation()const permutation} may
+	be obtained for any Record_File.
+
+	@param	file	The Record_File whose records are to be sorted. The
+		file must remain open while the Record_Sort is used.
+*/
+explicit Record_Sort (const Record_File& file);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of records.
+
+	@return	The number of records to be sorted.
+*/
+Record_Index records () const
+	{return Records;}
+
+/**	Gets the record layout.
+
+	@return	The Data_Block that describes the record structure.
+*/
+const Data_Block& layout () const
+	{return Layout;}
+
+/**	Gets the number of keys.
+
+	@return	The number of keys by which the records are sorted.
+*/
+unsigned int keys () const
+	{return (unsigned int)Keys.size ();}
+
+/**	Gets the maximum number of threads used by a sort.
+
+	@return	The maximum number of threads. Zero means the number of
+		hardware threads of the host system.
+*/
+unsigned int threads () const
+	{return Threads;}
+
+/**	Sets the maximum number of threads used by a sort.
+
+	A sort is divided among no more threads than there are {@link
+	#MINIMUM_THREAD_RECORDS} in the records.
+
+	@param	maximum	The maximum number of threads. Zero means the number
+		of hardware threads of the host system; one means that only the
+		calling thread is used.
+	@return	This Record_Sort.
+*/
+Record_Sort& threads (unsigned int maximum)
+	{Threads = maximum; return *this;}
+
+/*==============================================================================
+	Keys
+*/
+/**	Adds a key.
+
+	Keys are applied in the order they are added: the first key is the
+	primary key.
+
+	@param	T	The host type as which the key values are obtained. This
+		must be an arithmetic type other than bool. A floating point type
+		is 4 or 8 bytes.
+	@param	element	The index of the layout element.
+	@param	direction	The Direction of the key order.
+	@return	This Record_Sort.
+	@throws	std::out_of_range	If the element is not in the layout, or
+		its first value does not fit within a record.
+	@throws	std::invalid_argument	If the element does not have a
+		value format and its value size is not usable with the host
+		type: larger than 8 bytes for an integer type, or not the size
+		of a floating point type.
+*/
+template<typename T>
+Record_Sort& key
+	(
+	Index		element,
+	Direction	direction = ASCENDING
+	)
+	{
+	static_assert (std::is_arithmetic<T>::value &&
+		! std::is_same<T, bool>::value &&
+		sizeof (T) <= sizeof (std::uint64_t),
+		"Record_Sort keys must be arithmetic");
+	static_assert (! std::is_floating_point<T>::value ||
+		sizeof (T) == 4 || sizeof (T) == 8,
+		"Record_Sort floating point keys must be 4 or 8 bytes");
+	Key
+		key;
+	key.Encode = encode<T>;
+	key.Element = element;
+	key.Size = sizeof (T);
+	key.Descending = (direction == DESCENDING);
+	add_key (key, std::is_floating_point<T>::value);
+	return *this;
+	}
+
+/**	Removes all keys.
+
+	@return	This Record_Sort.
+*/
+Record_Sort& clear ()
+	{Keys.clear (); return *this;}
+
+/*==============================================================================
+	Sorting
+*/
+/**	Gets the sorted order of the records.
+
+	The records are not changed.
+
+	@return	A vector of the record numbers in sorted order. If there
+		are no keys the records are in their original order.
+*/
+std::vector<Record_Index> permutation () const;
+
+/**	Sorts the records in place.
+
+	The records are copied, in sorted order, to a buffer the size of
+	all the records which is then copied back over the records.
+
+	@return	This Record_Sort.
+	@throws	std::logic_error	If the records are those of a Record_File
+		that is not writable.
+	@see	permutation()const
+*/
+Record_Sort& sort ();
+
+/**	Reorders records.
+
+	@param	records	A pointer to the first byte of the first record.
+	@param	record_size	The number of bytes in each record.
+	@param	order	A vector of record numbers in the order that the
+		records are to have; every record number must occur exactly once.
+	@param	threads	The maximum number of threads to use. Zero means
+		the number of hardware threads of the host system.
+*/
+static void reorder (void* records, std::size_t record_size,
+	const std::vector<Record_Index>& order, unsigned int threads = 0);
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+//!	Encodes the key values of a run of records.
+typedef void (*Encoder)
+	(
+	const Data_Block&		layout,
+	Index					element,
+	bool					descending,
+	const unsigned char*	records,
+	std::size_t				count,
+	std::size_t				record_size,
+	std::uint64_t*			keys
+	);
+
+struct Key
+	{
+	Encoder
+		Encode;
+	Index
+		Element;
+	//	The number of bytes in an encoded key.
+	unsigned int
+		Size;
+	bool
+		Descending;
+	};
+
+/*	Checks that the key element can be obtained as the host type and
+	appends the key.
+*/
+void add_key (const Key& key, bool host_floating);
+
+template<typename T>
+static void
+encode
+	(
+	const Data_Block&		layout,
+	Index					element,
+	bool					descending,
+	const unsigned char*	records,
+	std::size_t				count,
+	std::size_t				record_size,
+	std::uint64_t*			keys
+	)
+{
+T
+	values[BLOCK_RECORDS];
+layout.gather (values, element, records, count, record_size);
+const std::uint64_t
+	sign = std::uint64_t (1) << (sizeof (T) * 8 - 1),
+	mask = ~std::uint64_t (0) >> (64 - sizeof (T) * 8),
+	complement = descending ? mask : 0;
+for (std::size_t
+		index = 0;
+		index < count;
+	  ++index)
+	{
+	std::uint64_t
+		bits;
+	if constexpr (std::is_floating_point<T>::value)
+		{
+		typedef typename std::conditional<sizeof (T) == 4,
+			std::uint32_t, std::uint64_t>::type	Bits;
+		Bits
+			raw;
+		std::memcpy (&raw, &values[index], sizeof (T));
+		bits = raw;
+		bits ^= (bits & sign) ? mask : sign;
+		}
+	else
+		{
+		bits = static_cast<std::uint64_t>(values[index]) & mask;
+		if constexpr (std::is_signed<T>::value)
+			bits ^= sign;
+		}
+	keys[index] = bits ^ complement;
+	}
+}
+
+/*==============================================================================
+	Data
+*/
+unsigned char*
+	Data;
+
+Record_Index
+	Records;
+
+std::size_t
+	Record_Size;
+
+Data_Block
+	Layout;
+
+std::vector<Key>
+	Keys;
+
+unsigned int
+	Threads;
+
+//	False for the records of a read-only Record_File.
+bool
+	Writable;
+
+};	//	class Record_Sort
+
+}	//	namespace PIRL
+#endif
@@ -0,0 +1,313 @@
+/*	Record_Statistics
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Record_Statistics.hh"
+#include	"Parallel.hh"
+using namespace PIRL;
+
+#include	<vector>
+using std::vector;
+
+#include	<limits>
+using std::numeric_limits;
+
+#include	<algorithm>
+using std::min;
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+using std::out_of_range;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Record_Statistics::ID =
+		"PIRL::Record_Statistics ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+#ifndef DOXYGEN_PROCESSING
+const unsigned int
+	Record_Statistics::BLOCK_RECORDS;
+const Record_Statistics::Record_Index
+	Record_Statistics::MINIMUM_THREAD_RECORDS;
+#endif	//	DOXYGEN_PROCESSING
+
+/*==============================================================================
+	Statistics
+*/
+double
+Record_Statistics::Statistics::mean () const
+{
+return Count ?
+	Sum / Count :
+	numeric_limits<double>::quiet_NaN ();
+}
+
+/*==============================================================================
+	Constructors
+*/
+Record_Statistics::Record_Statistics
+	(
+	const void*			records,
+	Record_Index		total_records,
+	const Data_Block&	layout,
+	std::size_t			record_size
+	)
+	:	Data (static_cast<const unsigned char*>(records)),
+		Records (total_records),
+		Record_Size (record_size ? record_size : layout.size ()),
+		Layout (layout),
+		Threads (0)
+{
+if (Record_Size < Layout.size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "The record size of " << Record_Size
+				<< " bytes is less than the layout size of "
+				<< Layout.size () << " bytes.";
+	throw invalid_argument (message.str ());
+	}
+}
+
+
+Record_Statistics::Record_Statistics
+	(
+	const Record_File&	file
+	)
+	:	Data (file.records () ? file.record_data (0) : NULL),
+		Records (file.records ()),
+		Record_Size (file.record_size ()),
+		Layout (file.layout ()),
+		Threads (0)
+{}
+
+/*==============================================================================
+	Columns
+*/
+Record_Statistics&
+Record_Statistics::add
+	(
+	Gatherer		gatherer,
+	Index			element,
+	bool			histogram,
+	double			low,
+	double			high,
+	unsigned int	bins
+	)
+{
+if (element >= Layout.elements () ||
+	! Layout.value_size_of (element) ||
+	Layout.offset_of (element) + Layout.value_size_of (element)
+		> Record_Size)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't accumulate element " << element
+				<< " of a layout with " << Layout.elements ()
+				<< " elements" << endl
+			<< "in records of " << Record_Size << " bytes.";
+	throw out_of_range (message.str ());
+	}
+if (histogram &&
+	(! bins || ! (low < high)))
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Invalid histogram for element " << element
+				<< ": " << bins << " bins from " << low << " to " << high
+				<< '.';
+	throw invalid_argument (message.str ());
+	}
+Column
+	column;
+column.Gather = gatherer;
+column.Element = element;
+column.Low = low;
+column.High = high;
+column.Bins = histogram ? bins : 0;
+Columns.push_back (column);
+return *this;
+}
+
+/*==============================================================================
+	Accumulation
+*/
+vector<Record_Statistics::Statistics>
+Record_Statistics::accumulate () const
+{
+//	The initial statistics of each column.
+vector<Statistics>
+	initial (Columns.size ());
+for (std::size_t
+		index = 0;
+		index < Columns.size ();
+	  ++index)
+	{
+	Statistics&
+		statistics = initial[index];
+	statistics.Element = Columns[index].Element;
+	statistics.Count = 0;
+	statistics.Minimum = numeric_limits<double>::infinity ();
+	statistics.Maximum = -numeric_limits<double>::infinity ();
+	statistics.Sum = 0.0;
+	statistics.Low = Columns[index].Low;
+	statistics.High = Columns[index].High;
+	statistics.Bins.assign (Columns[index].Bins, 0);
+	statistics.Below = 0;
+	statistics.Above = 0;
+	}
+
+//	Each thread accumulates its own partial statistics.
+unsigned int
+	threads = parallel_threads (Threads, Records / MINIMUM_THREAD_RECORDS);
+vector<vector<Statistics> >
+	partials (threads, initial);
+threads = parallel_for (Records, BLOCK_RECORDS, threads,
+	[this, &partials] (unsigned int part, std::size_t first, std::size_t end)
+		{accumulate (partials[part], first, end);});
+
+//	Merge the partial statistics.
+vector<Statistics>
+	results (initial);
+for (unsigned int
+		part = 0;
+		part < threads;
+	  ++part)
+	{
+	for (std::size_t
+			index = 0;
+			index < results.size ();
+		  ++index)
+		{
+		Statistics
+			&result = results[index],
+			&partial = partials[part][index];
+		result.Count += partial.Count;
+		result.Minimum = min (result.Minimum, partial.Minimum);
+		if (result.Maximum < partial.Maximum)
+			result.Maximum = partial.Maximum;
+		result.Sum += partial.Sum;
+		for (std::size_t
+				bin = 0;
+				bin < result.Bins.size ();
+			  ++bin)
+			result.Bins[bin] += partial.Bins[bin];
+		result.Below += partial.Below;
+		result.Above += partial.Above;
+		}
+	}
+for (vector<Statistics>::iterator
+		result = results.begin ();
+		result != results.end ();
+	  ++result)
+	if (! result->Count)
+		result->Minimum =
+		result->Maximum = numeric_limits<double>::quiet_NaN ();
+return results;
+}
+
+
+void
+Record_Statistics::accumulate
+	(
+	vector<Statistics>&	statistics,
+	Record_Index		first,
+	Record_Index		end
+	) const
+{
+double
+	values[BLOCK_RECORDS];
+for (Record_Index
+		record = first;
+		record < end;
+		record += BLOCK_RECORDS)
+	{
+	std::size_t
+		count = min (Record_Index (BLOCK_RECORDS), end - record);
+	const unsigned char*
+		records = Data + record * Record_Size;
+	for (std::size_t
+			index = 0;
+			index < Columns.size ();
+		  ++index)
+		{
+		const Column&
+			column = Columns[index];
+		Statistics&
+			result = statistics[index];
+		column.Gather
+			(Layout, column.Element, records, count, Record_Size, values);
+
+		//	A block sum is added to the total to limit rounding error.
+		double
+			minimum = result.Minimum,
+			maximum = result.Maximum,
+			sum = 0.0;
+		std::size_t
+			counted = 0,
+			value;
+		for (value = 0;
+			 value < count;
+		   ++value)
+			{
+			double
+				datum = values[value];
+			if (datum == datum)
+				{
+				++counted;
+				sum += datum;
+				minimum = (datum < minimum) ? datum : minimum;
+				maximum = (datum > maximum) ? datum : maximum;
+				}
+			}
+		result.Count += counted;
+		result.Sum += sum;
+		result.Minimum = minimum;
+		result.Maximum = maximum;
+
+		if (column.Bins)
+			{
+			double
+				scale = column.Bins / (column.High - column.Low);
+			for (value = 0;
+				 value < count;
+			   ++value)
+				{
+				double
+					datum = values[value];
+				if (datum < column.Low)
+					++result.Below;
+				else if (datum >= column.High)
+					++result.Above;
+				else if (datum == datum)
+					++result.Bins[min (column.Bins - 1,
+						(unsigned int)((datum - column.Low) * scale))];
+				}
+			}
+		}
+	}
+}
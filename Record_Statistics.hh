@@ -0,0 +1,368 @@
+/*	Record_Statistics
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Record_Statistics_
+#define _Record_Statistics_
+
+#include	"Data_Block.hh"
+#include	"Record_File.hh"
+
+#include	<vector>
+#include	<cstddef>
+#include	<type_traits>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Record_Statistics
+*/
+/**	A <i>Record_Statistics</i> accumulates the statistics of element
+	values across a buffer of records.
+
+	The records are a contiguous sequence of fixed length records, such
+	as those of a Record_File, that have the structure of a layout
+	Data_Block. For each element column that is added the count, minimum,
+	maximum, sum and mean of its values, and optionally a histogram of
+	fixed width bins, are accumulated by a single pass over the records.
+
+	The element values are obtained as the host type with which the
+	column is added, exactly as the layout Data_Block would {@link
+	Data_Block::get(T&, const Index, const Index)const get} them: in the
+	data order of the layout, with the signedness of the host type or of
+	an integer {@link Data_Block::value_format(Index,
+	Data_Block::Value_Format) value format}, and converted from any
+	other value format of the element. They are then accumulated as
+	double values; integer values of more than 53 bits are rounded.
+	When an element is an array only its first value is used. NaN values
+	are not counted.
+
+	The values of each column are {@link Data_Block::gather(T*, const
+	Index, const void*, std::size_t, std::size_t)const gathered} from a
+	block of records at a time. The records are divided among {@link
+	threads(unsigned int) threads}, each of which accumulates its own
+	partial statistics; the partial statistics are merged when all the
+	threads are done.
+
+	<code>
+	Record_Statistics statistics (table);<br>
+	statistics.column<float> (TEMPERATURE, 0.0, 400.0, 40)<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;.column<unsigned short> (ORBIT);<br>
+	std::vector<Record_Statistics::Statistics> results<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;= statistics.accumulate ();
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Record_File
+	@see	Data_Block
+*/
+class Record_Statistics
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Record number.
+typedef std::size_t				Record_Index;
+
+//!	Data_Block element index.
+typedef Data_Block::Index		Index;
+
+/**	The statistics of an element column.
+
+	The histogram bins, if any, evenly divide the range from Low to
+	High; values from Low up to, but not including, High are counted in
+	the bins. Values outside this range are counted as Below or Above.
+*/
+struct Statistics
+	{
+	//!	The layout element index.
+	Index
+		Element;
+	//!	The number of values, not including NaN values.
+	Record_Index
+		Count;
+	//!	The least, greatest and sum of the values.
+	double
+		Minimum,
+		Maximum,
+		Sum;
+
+	//!	The histogram range.
+	double
+		Low,
+		High;
+	//!	The histogram bin counts; empty if there is no histogram.
+	std::vector<Record_Index>
+		Bins;
+	//!	The number of values less than Low.
+	Record_Index
+		Below;
+	//!	The number of values not less than High.
+	Record_Index
+		Above;
+
+	/**	Gets the mean of the values.
+
+		@return	The Sum divided by the Count. This is NaN if there are
+			no values.
+	*/
+	double mean () const;
+	};
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The number of records gathered and accumulated at a time.
+static const unsigned int
+	BLOCK_RECORDS	= 256;
+
+//!	The fewest records for which an additional thread will be used.
+static const Record_Index
+	MINIMUM_THREAD_RECORDS	= 65536;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Record_Statistics for a buffer of records.
+
+	@param	records	A pointer to the first byte of the first record.
+	@param	total_records	The number of records in the buffer.
+	@param	layout	A Data_Block that describes the record structure.
+		The data address of the layout is not used.
+	@param	record_size	The number of bytes in each record. If zero
+		the {@link Data_Block::size()const size} of the layout is used.
+	@throws	std::invalid_argument	If the record size is less than the
+		layout size.
+*/
+Record_Statistics
+	(
+	const void*			records,
+	Record_Index		total_records,
+	const Data_Block&	layout,
+	std::size_t			record_size = 0
+	);
+
+/**	Constructs a Record_Statistics for the records of a Record_File.
+
+	@param	file	The Record_File whose records are to be used. The
+		file must remain open while the Record_Statistics is used.
+*/
+explicit Record_Statistics (const Record_File& file);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of records.
+
+	@return	The number of records to be accumulated.
+*/
+Record_Index records () const
+	{return Records;}
+
+/**	Gets the record layout.
+
+	@return	The Data_Block that describes the record structure.
+*/
+const Data_Block& layout () const
+	{return Layout;}
+
+/**	Gets the number of columns.
+
+	@return	The number of element columns that will be accumulated.
+*/
+unsigned int columns () const
+	{return (unsigned int)Columns.size ();}
+
+/**	Gets the maximum number of threads used to accumulate statistics.
+
+	@return	The maximum number of threads. Zero means the number of
+		hardware threads of the host system.
+*/
+unsigned int threads () const
+	{return Threads;}
+
+/**	Sets the maximum number of threads used to accumulate statistics.
+
+	The records are divided among no more threads than there are {@link
+	#MINIMUM_THREAD_RECORDS} in the records.
+
+	@param	maximum	The maximum number of threads. Zero means the number
+		of hardware threads of the host system; one means that only the
+		calling thread is used.
+	@return	This Record_Statistics.
+*/
+Record_Statistics& threads (unsigned int maximum)
+	{Threads = maximum; return *this;}
+
+/*==============================================================================
+	Columns
+*/
+/**	Adds an element column.
+
+	@param	T	The host type as which the element values are obtained.
+		This must be an arithmetic type other than bool.
+	@param	element	The index of the layout element.
+	@return	This Record_Statistics.
+	@throws	std::out_of_range	If the element is not in the layout, or
+		its first value does not fit within a record.
+*/
+template<typename T>
+Record_Statistics& column
+	(
+	Index		element
+	)
+	{return add (gather<T>, element, false, 0.0, 0.0, 0);}
+
+/**	Adds an element column with a histogram.
+
+	@param	T	The host type as which the element values are obtained.
+		This must be an arithmetic type other than bool.
+	@param	element	The index of the layout element.
+	@param	low	The low end of the histogram range.
+	@param	high	The high end of the histogram range.
+	@param	bins	The number of histogram bins.
+	@return	This Record_Statistics.
+	@throws	std::out_of_range	If the element is not in the layout, or
+		its first value does not fit within a record.
+	@throws	std::invalid_argument	If there are no bins or the low end
+		of the range is not less than the high end.
+*/
+template<typename T>
+Record_Statistics& column
+	(
+	Index			element,
+	double			low,
+	double			high,
+	unsigned int	bins
+	)
+	{return add (gather<T>, element, true, low, high, bins);}
+
+/**	Removes all columns.
+
+	@return	This Record_Statistics.
+*/
+Record_Statistics& clear ()
+	{Columns.clear (); return *this;}
+
+/*==============================================================================
+	Accumulation
+*/
+/**	Accumulates the statistics of the columns.
+
+	@return	A vector of Statistics, one for each column in the order
+		they were added.
+*/
+std::vector<Statistics> accumulate () const;
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+//!	Gathers the element values of a run of records as double values.
+typedef void (*Gatherer)
+	(
+	const Data_Block&		layout,
+	Index					element,
+	const unsigned char*	records,
+	std::size_t				count,
+	std::size_t				record_size,
+	double*					values
+	);
+
+struct Column
+	{
+	Gatherer
+		Gather;
+	Index
+		Element;
+	double
+		Low,
+		High;
+	unsigned int
+		Bins;
+	};
+
+Record_Statistics& add (Gatherer gatherer, Index element,
+	bool histogram, double low, double high, unsigned int bins);
+
+//	Accumulates the statistics of a range of records.
+void accumulate (std::vector<Statistics>& statistics,
+	Record_Index first, Record_Index end) const;
+
+template<typename T>
+static void
+gather
+	(
+	const Data_Block&		layout,
+	Index					element,
+	const unsigned char*	records,
+	std::size_t				count,
+	std::size_t				record_size,
+	double*					values
+	)
+{
+static_assert (std::is_arithmetic<T>::value &&
+	! std::is_same<T, bool>::value,
+	"Record_Statistics values must be arithmetic");
+if constexpr (std::is_same<T, double>::value)
+	layout.gather (values, element, records, count, record_size);
+else
+	{
+	T
+		host[BLOCK_RECORDS];
+	layout.gather (host, element, records, count, record_size);
+	for (std::size_t
+			index = 0;
+			index < count;
+		  ++index)
+		values[index] = static_cast<double>(host[index]);
+	}
+}
+
+/*==============================================================================
+	Data
+*/
+const unsigned char*
+	Data;
+
+Record_Index
+	Records;
+
+std::size_t
+	Record_Size;
+
+Data_Block
+	Layout;
+
+std::vector<Column>
+	Columns;
+
+unsigned int
+	Threads;
+
+};	//	class Record_Statistics
+
+}	//	namespace PIRL
+#endif
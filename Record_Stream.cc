@@ -0,0 +1,195 @@
+/*	Record_Stream
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Record_Stream.hh"
+using namespace PIRL;
+
+#include	<iostream>
+using std::istream;
+
+#include	<algorithm>
+using std::min;
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+using std::out_of_range;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Record_Stream::ID =
+		"PIRL::Record_Stream ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+#ifndef DOXYGEN_PROCESSING
+const Record_Stream::Record_Index
+	Record_Stream::DEFAULT_BATCH_RECORDS;
+#endif	//	DOXYGEN_PROCESSING
+
+/*==============================================================================
+	Constructors
+*/
+Record_Stream::Record_Stream
+	(
+	std::istream&		source,
+	const Data_Block&	layout,
+	std::size_t			record_size,
+	Record_Index		margin,
+	Record_Index		batch
+	)
+	:	Records_Cache (0, source),
+		Layout (layout),
+		Record (layout),
+		Record_Size (record_size ? record_size : layout.size ()),
+		Margin (margin),
+		Batch (batch ? batch : DEFAULT_BATCH_RECORDS),
+		Consumed (0),
+		Retained (0),
+		Position (NULL)
+{
+if (! Record_Size ||
+	Record_Size < Layout.size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "The record size of " << Record_Size
+				<< " bytes is not valid for a layout size of "
+				<< Layout.size () << " bytes.";
+	throw invalid_argument (message.str ());
+	}
+capacity (Batch);
+}
+
+/*==============================================================================
+	Accessors
+*/
+Record_Stream&
+Record_Stream::margin
+	(
+	Record_Index	records
+	)
+{
+Margin = records;
+if (Retained > Margin + 1)
+	{
+	//	Release the records beyond the new margin.
+	Retained = Margin + 1;
+	Records_Cache.next (Position - Retained * Record_Size);
+	}
+capacity (Batch);
+return *this;
+}
+
+/*==============================================================================
+	Records
+*/
+Record_Stream::Record_Index
+Record_Stream::peek
+	(
+	Record_Index	count
+	)
+{
+if (count > Batch)
+	capacity (count);
+while (available () < count)
+	{
+	//	Drains the records before the margin and fills the free space.
+	bool
+		filled = Records_Cache.refill ();
+	locate ();
+	if (! filled)
+		break;
+	}
+return min (available (), count);
+}
+
+
+Record_Stream::Record_Index
+Record_Stream::advance
+	(
+	Record_Index	count
+	)
+{
+count = min (count, available ());
+if (count)
+	{
+	Position += count * Record_Size;
+	Consumed += count;
+	Retained = min (Retained + count, Margin + 1);
+	Records_Cache.next (Position - Retained * Record_Size);
+	Record.data (Position - Record_Size);
+	}
+return count;
+}
+
+
+Data_Block
+Record_Stream::record
+	(
+	Record_Index	back
+	) const
+{
+if (back >= Retained)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't look back " << back << " record"
+				<< ((back != 1) ? "s" : "")
+				<< " with " << Retained << " record"
+				<< ((Retained != 1) ? "s" : "") << " retained.";
+	throw out_of_range (message.str ());
+	}
+Data_Block
+	view (Layout);
+view.data (Position - (back + 1) * Record_Size);
+return view;
+}
+
+/*==============================================================================
+	Helpers
+*/
+void
+Record_Stream::capacity
+	(
+	Record_Index	records
+	)
+{
+unsigned long
+	amount = (unsigned long)((Margin + 1 + records) * Record_Size);
+if (amount > Records_Cache.capacity ())
+	{
+	//	The retained records may be moved to new storage.
+	Records_Cache.capacity (amount);
+	locate ();
+	}
+}
+
+
+void
+Record_Stream::locate ()
+{
+Position = Records_Cache.next () + Retained * Record_Size;
+Record.data (Retained ? Position - Record_Size : NULL);
+}
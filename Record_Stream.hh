@@ -0,0 +1,295 @@
+/*	Record_Stream
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Record_Stream_
+#define _Record_Stream_
+
+#include	"Cache.hh"
+#include	"Data_Block.hh"
+
+#include	<iosfwd>
+#include	<cstddef>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Record_Stream
+*/
+/**	A <i>Record_Stream</i> reads fixed length records from an input
+	stream into a Cache and provides them in place.
+
+	The records have the structure of a layout Data_Block. The stream is
+	read into the storage of a Cache a batch of records at a time, and
+	each {@link next() next} record is provided as a {@link record()const
+	record} Data_Block view whose data is the record in the Cache
+	storage; no record is copied out of the Cache. Records are consumed
+	in order, one at a time or in batches: {@link peek(Record_Index)
+	peek} makes a number of records following the current record
+	available contiguously in the Cache, which may be used in place -
+	for example by a Record_Scan of the {@link records()const records}
+	- and then {@link advance(Record_Index) advanced} over.
+
+	A {@link margin(Record_Index) margin} of records preceding the
+	current record is retained in the Cache when it is refilled, so that
+	previously consumed records remain available for look-back as
+	{@link record(Record_Index)const record} views.
+
+	<b>N.B.</b>: A refill of the Cache may move the records in its
+	storage. The record view and the records pointer are updated when
+	this happens, but any other view or pointer into the Cache storage
+	is invalid after the next call to peek, next or advance.
+
+	<code>
+	std::ifstream file ("table.dat", std::ios::binary);<br>
+	Record_Stream stream (file, layout);<br>
+	while (stream.next ())<br>
+	&nbsp;&nbsp;&nbsp;&nbsp;total += stream.record ().get<double> (TIME);
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Cache
+	@see	Data_Block
+*/
+class Record_Stream
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Record number.
+typedef std::size_t				Record_Index;
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+//!	The default number of records read into the Cache at a time.
+static const Record_Index
+	DEFAULT_BATCH_RECORDS	= 4096;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Record_Stream for an input stream.
+
+	@param	source	The istream from which the records are read. This
+		should be opened in binary mode.
+	@param	layout	A Data_Block that describes the record structure.
+		The data address of the layout is not used.
+	@param	record_size	The number of bytes in each record. If zero the
+		{@link Data_Block::size()const size} of the layout is used.
+	@param	margin	The number of records preceding the current record
+		that are retained for look-back.
+	@param	batch	The number of records read into the Cache at a time.
+		If zero the #DEFAULT_BATCH_RECORDS is used.
+	@throws	std::invalid_argument	If the record size is zero or less
+		than the layout size.
+*/
+Record_Stream
+	(
+	std::istream&		source,
+	const Data_Block&	layout,
+	std::size_t			record_size = 0,
+	Record_Index		margin = 0,
+	Record_Index		batch = DEFAULT_BATCH_RECORDS
+	);
+
+private:
+//	Copying disallowed:
+Record_Stream (const Record_Stream& stream);
+Record_Stream& operator= (const Record_Stream& stream);
+
+/*==============================================================================
+	Accessors
+*/
+public:
+/**	Gets the record layout.
+
+	@return	The Data_Block that describes the record structure. Its data
+		address is not used.
+*/
+const Data_Block& layout () const
+	{return Layout;}
+
+/**	Gets the record size.
+
+	@return	The number of bytes in each record.
+*/
+std::size_t record_size () const
+	{return Record_Size;}
+
+/**	Gets the number of look-back records.
+
+	@return	The number of records preceding the current record that are
+		retained in the Cache.
+*/
+Record_Index margin () const
+	{return Margin;}
+
+/**	Sets the number of look-back records.
+
+	The Cache capacity is increased, if necessary, to hold the margin
+	records, the current record and a batch of records.
+
+	@param	records	The number of records preceding the current record
+		that are to be retained in the Cache.
+	@return	This Record_Stream.
+*/
+Record_Stream& margin (Record_Index records);
+
+/**	Gets the number of records read into the Cache at a time.
+
+	@return	The number of records in a batch.
+*/
+Record_Index batch () const
+	{return Batch;}
+
+/**	Gets the number of records that have been consumed.
+
+	@return	The number of records that have been consumed. The current
+		record, if any, is the record number one less than this.
+*/
+Record_Index records_consumed () const
+	{return Consumed;}
+
+/**	Gets the Cache.
+
+	@return	The Cache into which the records are read.
+*/
+const Cache& cache () const
+	{return Records_Cache;}
+
+/*==============================================================================
+	Records
+*/
+/**	Makes records following the current record available.
+
+	The Cache is refilled, as necessary, until it holds the records or
+	the end of the source stream is reached. The records are not
+	consumed. If more records than a batch are requested the Cache
+	capacity is increased to hold them.
+
+	@param	count	The number of records wanted.
+	@return	The number of whole records that are available at the
+		{@link records()const records} location. This is less than the
+		count only when the end of the source stream has been reached.
+	@throws	std::ios::failure	If the source stream fails.
+*/
+Record_Index peek (Record_Index count = 1);
+
+/**	Gets the number of records that are available without a refill.
+
+	@return	The number of whole records in the Cache following the
+		current record.
+*/
+Record_Index available () const
+	{return (Records_Cache.last () - Position) / Record_Size;}
+
+/**	Gets the location of the records following the current record.
+
+	@return	A pointer to the first byte of the record following the
+		current record in the Cache storage.
+	@see	peek(Record_Index)
+*/
+const unsigned char* records () const
+	{return reinterpret_cast<const unsigned char*>(Position);}
+
+/**	Consumes records.
+
+	The last record consumed becomes the current record.
+
+	@param	count	The number of records to consume. This is limited to
+		the records that are {@link available()const available}.
+	@return	The number of records that were consumed.
+*/
+Record_Index advance (Record_Index count = 1);
+
+/**	Consumes the next record.
+
+	@return	true if the next record is now the current record; false if
+		there is no whole record remaining in the source stream.
+	@throws	std::ios::failure	If the source stream fails.
+*/
+bool next ()
+	{return peek (1) && advance (1);}
+
+/**	Gets the current record.
+
+	@return	A Data_Block view of the layout whose data is the current
+		record in the Cache storage. The data address is NULL before the
+		first record has been consumed.
+*/
+const Data_Block& record () const
+	{return Record;}
+
+/**	Gets a previous record.
+
+	@param	back	The number of records preceding the current record.
+		Zero is the current record.
+	@return	A Data_Block view of the layout whose data is the record in
+		the Cache storage.
+	@throws	std::out_of_range	If the record is not retained: back is
+		greater than the margin or than the number of records preceding
+		the current record.
+*/
+Data_Block record (Record_Index back) const;
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+//	Sets the Cache capacity for a number of records following the current record.
+void capacity (Record_Index records);
+
+//	Sets the Cache consumed location and the current record view.
+void locate ();
+
+/*==============================================================================
+	Data
+*/
+Cache
+	Records_Cache;
+
+Data_Block
+	Layout,
+	Record;
+
+std::size_t
+	Record_Size;
+
+Record_Index
+	Margin,
+	Batch,
+	Consumed,
+	//	The number of consumed records retained before Position.
+	Retained;
+
+//	The next record location in the Cache storage.
+char*
+	Position;
+
+};	//	class Record_Stream
+
+}	//	namespace PIRL
+#endif
@@ -0,0 +1,769 @@
+/*	Rectangle_Index
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Rectangle_Index_
+#define _Rectangle_Index_
+
+#include	"Dimensions.hh"
+
+#include	<cstddef>
+#include	<cmath>
+#include	<algorithm>
+#include	<functional>
+#include	<queue>
+#include	<vector>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Rectangle_Index
+*/
+/**	A <i>Rectangle_Index</i> is a spatial index of Rectangles, each with
+	an associated value.
+
+	The index is a packed R-tree: the Rectangles are grouped into leaf
+	nodes of up to NODE_ENTRIES nearby Rectangles, and the nodes are
+	grouped in the same way, level by level, up to a single root node.
+	The grouping uses Sort-Tile-Recursive packing - the Rectangles are
+	sorted into vertical slices by the horizontal position of their
+	centers and each slice is sorted by the vertical position of their
+	centers - which produces nodes with little overlap. The nodes are
+	held in a single array, and the bounds of the Rectangles of the
+	leaf nodes are held in another array in the order of the leaves, so
+	a query reads memory mostly in sequence.
+
+	An index is most efficiently {@link load(Iterator, Iterator) loaded}
+	with all of its Rectangles at once. Rectangles that are {@link
+	insert(const Rectangle&, const T&) inserted} later are held in a
+	pending list that is searched linearly until there are enough of
+	them to warrant packing the tree again; likewise {@link
+	remove(Identifier) removed} Rectangles are marked until enough of
+	them accumulate. Each Rectangle is identified by the Identifier
+	assigned when it is added; Identifiers do not change when the tree is
+	packed again, and are not reused until the index is {@link clear()
+	cleared}.
+
+	Rectangles overlap when their intersection is not empty, as for the
+	Rectangle intersection operator; an empty Rectangle does not overlap
+	or contain anything. A Cube may be indexed: it is indexed by its
+	Rectangle, since a Cube has no band position.
+
+	<code>
+	Rectangle_Index<std::string> footprints (images.begin (), images.end ());<br>
+	std::vector<Rectangle_Index<std::string>::Identifier><br>
+		&nbsp;&nbsp;&nbsp;&nbsp;inputs = footprints.overlapping (tile);
+	</code>
+
+	<b>N.B.</b>: Queries on a const Rectangle_Index may be made
+	concurrently; changing the index is not thread safe.
+
+	@param	T	The type of the value associated with each Rectangle.
+	@author		Bradford Castalia, UA/PIRL
+	@see	Rectangle
+*/
+template<typename T>
+class Rectangle_Index
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	The identifier of an indexed Rectangle.
+typedef std::size_t		Identifier;
+
+//!	The type of the value associated with each Rectangle.
+typedef T				Value_Type;
+
+/*==============================================================================
+	Constants
+*/
+//!	The maximum number of entries in a node of the tree.
+static constexpr std::size_t
+	NODE_ENTRIES	= 16;
+
+/**	The least number of pending or removed Rectangles that causes the
+	tree to be packed again.
+
+	The tree is packed again when the number of pending Rectangles
+	exceeds the larger of this and a quarter of the number in the tree,
+	or when the number of removed Rectangles exceeds the larger of this
+	and the number of Rectangles in the index.
+*/
+static constexpr std::size_t
+	REBUILD_MINIMUM	= 64;
+
+/*==============================================================================
+	Constructors
+*/
+//!	Constructs an empty Rectangle_Index.
+Rectangle_Index ()
+	:	Live (0),
+		Removed (0)
+	{}
+
+/**	Constructs a Rectangle_Index loaded with Rectangles.
+
+	@param	first	An iterator at the first of a sequence of pairs, each
+		with a Rectangle as its first member and a value as its second
+		member.
+	@param	last	An iterator after the last pair of the sequence.
+	@see	load(Iterator, Iterator)
+*/
+template<typename Iterator>
+Rectangle_Index (Iterator first, Iterator last)
+	:	Live (0),
+		Removed (0)
+	{load (first, last);}
+
+/*==============================================================================
+	Contents
+*/
+/**	Loads the index with Rectangles.
+
+	Any existing contents are {@link clear() cleared}. The Identifiers
+	of the Rectangles are their positions in the sequence.
+
+	@param	first	An iterator at the first of a sequence of pairs, each
+		with a Rectangle as its first member and a value as its second
+		member.
+	@param	last	An iterator after the last pair of the sequence.
+	@return	This Rectangle_Index.
+*/
+template<typename Iterator>
+Rectangle_Index& load
+	(
+	Iterator	first,
+	Iterator	last
+	)
+	{
+	clear ();
+	for (;
+		 first != last;
+	   ++first)
+		Entries.push_back (Entry (first->first, first->second));
+	Live = Entries.size ();
+	pack ();
+	return *this;
+	}
+
+/**	Inserts a Rectangle.
+
+	@param	rectangle	The Rectangle to be indexed.
+	@param	value	The value associated with the Rectangle.
+	@return	The Identifier of the Rectangle.
+*/
+Identifier insert
+	(
+	const Rectangle&	rectangle,
+	const T&			value = T ()
+	)
+	{
+	Identifier
+		identifier = Entries.size ();
+	Entries.push_back (Entry (rectangle, value));
+	Pending.push_back (identifier);
+	++Live;
+	if (Pending.size () > std::max (REBUILD_MINIMUM, Order.size () / 4))
+		pack ();
+	return identifier;
+	}
+
+/**	Removes a Rectangle.
+
+	@param	identifier	The Identifier of the Rectangle.
+	@return	true if the Rectangle was removed; false if there is no
+		Rectangle in the index with the Identifier.
+*/
+bool remove
+	(
+	Identifier	identifier
+	)
+	{
+	if (! valid (identifier))
+		return false;
+	Entries[identifier].Removed = true;
+	--Live;
+	if (++Removed > std::max (REBUILD_MINIMUM, Live))
+		pack ();
+	return true;
+	}
+
+/**	Removes all Rectangles.
+
+	All Identifiers become available for reuse.
+
+	@return	This Rectangle_Index.
+*/
+Rectangle_Index& clear ()
+	{
+	Entries.clear ();
+	Nodes.clear ();
+	Order.clear ();
+	Leaf_Edges.clear ();
+	Pending.clear ();
+	Live =
+	Removed = 0;
+	return *this;
+	}
+
+/**	Packs the tree with all the Rectangles in the index.
+
+	This is done automatically as Rectangles are inserted and removed;
+	packing the tree after a series of changes ensures that following
+	queries are as fast as possible.
+
+	@return	This Rectangle_Index.
+*/
+Rectangle_Index& rebuild ()
+	{pack (); return *this;}
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the number of Rectangles.
+
+	@return	The number of Rectangles in the index.
+*/
+std::size_t size () const
+	{return Live;}
+
+/**	Tests if the index is empty.
+
+	@return	true if there are no Rectangles in the index; false otherwise.
+*/
+bool empty () const
+	{return ! Live;}
+
+/**	Tests if an Identifier is for a Rectangle in the index.
+
+	@param	identifier	A Rectangle Identifier.
+	@return	true if the Rectangle is in the index; false otherwise.
+*/
+bool valid (Identifier identifier) const
+	{return identifier < Entries.size () && ! Entries[identifier].Removed;}
+
+/**	Gets an indexed Rectangle.
+
+	@param	identifier	The {@link valid(Identifier)const valid}
+		Identifier of the Rectangle.
+	@return	The Rectangle.
+*/
+const Rectangle& rectangle (Identifier identifier) const
+	{return Entries[identifier].Area;}
+
+/**	Gets the value of an indexed Rectangle.
+
+	@param	identifier	The {@link valid(Identifier)const valid}
+		Identifier of the Rectangle.
+	@return	The value associated with the Rectangle.
+*/
+T& value (Identifier identifier)
+	{return Entries[identifier].Value;}
+
+/**	Gets the value of an indexed Rectangle.
+
+	@param	identifier	The {@link valid(Identifier)const valid}
+		Identifier of the Rectangle.
+	@return	The value associated with the Rectangle.
+*/
+const T& value (Identifier identifier) const
+	{return Entries[identifier].Value;}
+
+/*==============================================================================
+	Queries
+*/
+/**	Finds the Rectangles that overlap an area.
+
+	@param	area	The area to be searched.
+	@param	function	A function that is called with the Identifier of
+		each Rectangle that overlaps the area, in no particular order.
+*/
+template<typename Function>
+void overlapping
+	(
+	const Rectangle&	area,
+	Function			function
+	) const
+	{
+	const Bounds
+		edges (area);
+	if (edges.is_empty ())
+		return;
+	search
+		([&edges] (const Bounds& node) {return node.overlaps (edges);},
+		 [&edges] (const Bounds& entry)
+			{return ! entry.is_empty () && entry.overlaps (edges);},
+		 function);
+	}
+
+/**	Finds the Rectangles that overlap an area.
+
+	@param	area	The area to be searched.
+	@return	A vector of the Identifiers of the Rectangles that overlap
+		the area, in no particular order.
+*/
+std::vector<Identifier> overlapping
+	(
+	const Rectangle&	area
+	) const
+	{
+	std::vector<Identifier>
+		identifiers;
+	overlapping (area,
+		[&identifiers] (Identifier identifier)
+			{identifiers.push_back (identifier);});
+	return identifiers;
+	}
+
+/**	Finds the Rectangles that contain an area.
+
+	@param	area	The area to be contained.
+	@return	A vector of the Identifiers of the Rectangles that contain
+		all of the area, in no particular order. This is empty if the
+		area is empty.
+*/
+std::vector<Identifier> containing
+	(
+	const Rectangle&	area
+	) const
+	{
+	std::vector<Identifier>
+		identifiers;
+	const Bounds
+		edges (area);
+	if (edges.is_empty ())
+		return identifiers;
+	search
+		([&edges] (const Bounds& node) {return node.contains (edges);},
+		 [&edges] (const Bounds& entry) {return entry.contains (edges);},
+		 [&identifiers] (Identifier identifier)
+			{identifiers.push_back (identifier);});
+	return identifiers;
+	}
+
+/**	Finds the Rectangles that contain a pixel.
+
+	@param	point	The position of the pixel.
+	@return	A vector of the Identifiers of the Rectangles that contain
+		the pixel, in no particular order.
+*/
+std::vector<Identifier> containing
+	(
+	const Point_2D&		point
+	) const
+	{return containing (Rectangle (point, Size_2D (1)));}
+
+/**	Finds the Rectangles nearest to a point.
+
+	The distance from the point to a Rectangle is the distance to the
+	nearest point on its edges, or zero if the point is inside the
+	Rectangle.
+
+	@param	point	The point from which distances are measured.
+	@param	count	The maximum number of Rectangles to find.
+	@return	A vector of the Identifiers of the nearest Rectangles in
+		order of increasing distance.
+*/
+std::vector<Identifier> nearest
+	(
+	const Point_2D&		point,
+	std::size_t			count = 1
+	) const
+	{
+	std::vector<Identifier>
+		identifiers;
+	if (! count)
+		return identifiers;
+
+	//	Best first search: an entry is found when it is nearer than
+	//	every node that has not yet been opened.
+	std::priority_queue<Candidate, std::vector<Candidate>,
+		std::greater<Candidate> >
+		candidates;
+	for (std::size_t
+			pending = 0;
+			pending < Pending.size ();
+		  ++pending)
+		if (! Entries[Pending[pending]].Removed)
+			candidates.push (Candidate
+				(Bounds (Entries[Pending[pending]].Area).distance (point),
+				 Pending[pending], true));
+	if (! Nodes.empty ())
+		candidates.push (Candidate
+			(Nodes.back ().Edges.distance (point), Nodes.size () - 1, false));
+	while (! candidates.empty ())
+		{
+		Candidate
+			candidate = candidates.top ();
+		candidates.pop ();
+		if (candidate.Is_Entry)
+			{
+			identifiers.push_back (candidate.Index);
+			if (identifiers.size () == count)
+				break;
+			continue;
+			}
+		const Node
+			&node = Nodes[candidate.Index];
+		for (std::size_t
+				index = node.First;
+				index < node.First + node.Count;
+			  ++index)
+			{
+			if (node.Leaf)
+				{
+				if (! Entries[Order[index]].Removed)
+					candidates.push (Candidate
+						(Leaf_Edges[index].distance (point), Order[index], true));
+				}
+			else
+				candidates.push (Candidate
+					(Nodes[index].Edges.distance (point), index, false));
+			}
+		}
+	return identifiers;
+	}
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+//	Rectangle edges that can not overflow.
+struct Bounds
+{
+long long
+	Left,
+	Top,
+	Right,
+	Bottom;
+
+Bounds ()
+	:	Left (0), Top (0), Right (0), Bottom (0)
+	{}
+
+explicit Bounds (const Rectangle& rectangle)
+	:	Left (rectangle.X),
+		Top (rectangle.Y),
+		Right (static_cast<long long>(rectangle.X) + rectangle.Width),
+		Bottom (static_cast<long long>(rectangle.Y) + rectangle.Height)
+	{}
+
+bool is_empty () const
+	{return Left >= Right || Top >= Bottom;}
+
+bool overlaps (const Bounds& bounds) const
+	{return Left < bounds.Right && bounds.Left < Right &&
+			Top < bounds.Bottom && bounds.Top < Bottom;}
+
+bool contains (const Bounds& bounds) const
+	{return Left <= bounds.Left && bounds.Right <= Right &&
+			Top <= bounds.Top && bounds.Bottom <= Bottom;}
+
+void include (const Bounds& bounds)
+	{
+	Left   = std::min (Left,   bounds.Left);
+	Top    = std::min (Top,    bounds.Top);
+	Right  = std::max (Right,  bounds.Right);
+	Bottom = std::max (Bottom, bounds.Bottom);
+	}
+
+double distance (const Point_2D& point) const
+	{
+	double
+		x = static_cast<double>(std::max (std::max (Left - point.X,
+			point.X - Right), 0LL)),
+		y = static_cast<double>(std::max (std::max (Top - point.Y,
+			point.Y - Bottom), 0LL));
+	return std::sqrt (x * x + y * y);
+	}
+};
+
+struct Entry
+{
+Rectangle
+	Area;
+T
+	Value;
+bool
+	Removed;
+
+Entry (const Rectangle& area, const T& value)
+	:	Area (area),
+		Value (value),
+		Removed (false)
+	{}
+};
+
+/*	A tree node.
+
+	The entries of a leaf node are at First in the Order and Leaf_Edges;
+	the entries of any other node are its child nodes at First in the
+	Nodes.
+*/
+struct Node
+{
+Bounds
+	Edges;
+std::size_t
+	First,
+	Count;
+bool
+	Leaf;
+};
+
+//	An entry or node to be packed.
+struct Item
+{
+Bounds
+	Edges;
+std::size_t
+	Index;
+
+long long center_x () const
+	{return Edges.Left + Edges.Right;}
+long long center_y () const
+	{return Edges.Top + Edges.Bottom;}
+};
+
+//	An entry or node to be opened by a nearest search.
+struct Candidate
+{
+double
+	Distance;
+std::size_t
+	Index;
+bool
+	Is_Entry;
+
+Candidate (double distance, std::size_t index, bool is_entry)
+	:	Distance (distance),
+		Index (index),
+		Is_Entry (is_entry)
+	{}
+
+//	At equal distances entries are found before nodes are opened.
+bool operator> (const Candidate& candidate) const
+	{return Distance > candidate.Distance ||
+		(Distance == candidate.Distance &&
+			! Is_Entry && candidate.Is_Entry);}
+};
+
+//	Sort-Tile-Recursive ordering of the items of one tree level.
+static void str_sort
+	(
+	std::vector<Item>&	items
+	)
+	{
+	if (items.size () <= NODE_ENTRIES)
+		return;
+	std::size_t
+		nodes = (items.size () + NODE_ENTRIES - 1) / NODE_ENTRIES,
+		slices = static_cast<std::size_t>
+			(std::ceil (std::sqrt (static_cast<double>(nodes)))),
+		slice_items = ((nodes + slices - 1) / slices) * NODE_ENTRIES;
+	std::sort (items.begin (), items.end (),
+		[] (const Item& first, const Item& second)
+			{return first.center_x () < second.center_x ();});
+	for (std::size_t
+			slice = 0;
+			slice < items.size ();
+			slice += slice_items)
+		std::sort (items.begin () + slice,
+			items.begin () + std::min (slice + slice_items, items.size ()),
+			[] (const Item& first, const Item& second)
+				{return first.center_y () < second.center_y ();});
+	}
+
+//	Groups the nodes of one level, at first in the Nodes, into parents.
+std::vector<Node> parents
+	(
+	std::size_t	first,
+	std::size_t	count,
+	bool		leaf
+	) const
+	{
+	std::vector<Node>
+		level;
+	for (std::size_t
+			index = 0;
+			index < count;
+			index += NODE_ENTRIES)
+		{
+		Node
+			node;
+		node.First = first + index;
+		node.Count = std::min (NODE_ENTRIES, count - index);
+		node.Leaf = leaf;
+		node.Edges = leaf ? Leaf_Edges[node.First] : Nodes[node.First].Edges;
+		for (std::size_t
+				child = node.First + 1;
+				child < node.First + node.Count;
+			  ++child)
+			node.Edges.include (leaf ? Leaf_Edges[child] : Nodes[child].Edges);
+		level.push_back (node);
+		}
+	return level;
+	}
+
+//	Packs the tree with all the entries that have not been removed.
+void pack ()
+	{
+	Nodes.clear ();
+	Order.clear ();
+	Leaf_Edges.clear ();
+	Pending.clear ();
+	Removed = 0;
+
+	std::vector<Item>
+		items;
+	items.reserve (Live);
+	for (std::size_t
+			index = 0;
+			index < Entries.size ();
+		  ++index)
+		{
+		if (! Entries[index].Removed)
+			{
+			Item
+				item = {Bounds (Entries[index].Area), index};
+			items.push_back (item);
+			}
+		}
+	if (items.empty ())
+		return;
+	str_sort (items);
+	Order.reserve (items.size ());
+	Leaf_Edges.reserve (items.size ());
+	for (std::size_t
+			index = 0;
+			index < items.size ();
+		  ++index)
+		{
+		Order.push_back (items[index].Index);
+		Leaf_Edges.push_back (items[index].Edges);
+		}
+
+	std::vector<Node>
+		level = parents (0, Order.size (), true);
+	while (level.size () > 1)
+		{
+		items.resize (level.size ());
+		for (std::size_t
+				index = 0;
+				index < level.size ();
+			  ++index)
+			{
+			items[index].Edges = level[index].Edges;
+			items[index].Index = index;
+			}
+		str_sort (items);
+		std::size_t
+			first = Nodes.size ();
+		for (std::size_t
+				index = 0;
+				index < items.size ();
+			  ++index)
+			Nodes.push_back (level[items[index].Index]);
+		level = parents (first, items.size (), false);
+		}
+	//	The root is the last node.
+	Nodes.push_back (level[0]);
+	}
+
+/*	Searches the tree and the pending entries.
+
+	The node test selects the nodes to be opened; the entry test selects
+	the entries for which the function is called.
+*/
+template<typename Node_Test, typename Entry_Test, typename Function>
+void search
+	(
+	Node_Test	node_test,
+	Entry_Test	entry_test,
+	Function	function
+	) const
+	{
+	if (! Nodes.empty ())
+		{
+		std::vector<std::size_t>
+			stack (1, Nodes.size () - 1);
+		while (! stack.empty ())
+			{
+			const Node
+				&node = Nodes[stack.back ()];
+			stack.pop_back ();
+			if (! node_test (node.Edges))
+				continue;
+			if (node.Leaf)
+				{
+				for (std::size_t
+						index = node.First;
+						index < node.First + node.Count;
+					  ++index)
+					if (entry_test (Leaf_Edges[index]) &&
+						! Entries[Order[index]].Removed)
+						function (Order[index]);
+				}
+			else
+				for (std::size_t
+						index = node.First;
+						index < node.First + node.Count;
+					  ++index)
+					stack.push_back (index);
+			}
+		}
+	for (std::size_t
+			index = 0;
+			index < Pending.size ();
+		  ++index)
+		if (! Entries[Pending[index]].Removed &&
+			entry_test (Bounds (Entries[Pending[index]].Area)))
+			function (Pending[index]);
+	}
+
+/*==============================================================================
+	Data
+*/
+//	Indexed by Identifier.
+std::vector<Entry>
+	Entries;
+
+std::vector<Node>
+	Nodes;
+
+//	The Identifiers and edges of the leaf entries, in leaf order.
+std::vector<Identifier>
+	Order;
+std::vector<Bounds>
+	Leaf_Edges;
+
+//	Inserted since the tree was packed.
+std::vector<Identifier>
+	Pending;
+
+std::size_t
+	Live,
+	Removed;
+
+};	//	class Rectangle_Index
+
+}	//	namespace PIRL
+#endif
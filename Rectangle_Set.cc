@@ -0,0 +1,569 @@
+/*	Rectangle_Set
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Rectangle_Set.hh"
+using namespace PIRL;
+
+#include	<vector>
+using std::vector;
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Rectangle_Set::ID =
+		"PIRL::Rectangle_Set ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+/*	The kernels below compute edges as long long values, as the Rectangle
+	operators do, and select their results without branches.
+
+	Each kernel is written once, as a function template over the source
+	of the other Rectangle: a Single_Source provides the same Rectangle
+	for every position; a Set_Source provides the Rectangle at the same
+	position of another set.
+*/
+namespace
+{
+struct Single_Source
+{
+long long
+	Left,
+	Top,
+	Right,
+	Bottom;
+
+explicit Single_Source (const Rectangle& rectangle)
+	:	Left (rectangle.X),
+		Top (rectangle.Y),
+		Right (static_cast<long long>(rectangle.X) + rectangle.Width),
+		Bottom (static_cast<long long>(rectangle.Y) + rectangle.Height)
+	{}
+
+long long left (std::size_t) const
+	{return Left;}
+long long top (std::size_t) const
+	{return Top;}
+long long right (std::size_t) const
+	{return Right;}
+long long bottom (std::size_t) const
+	{return Bottom;}
+};
+
+
+struct Set_Source
+{
+const Coordinate_Type
+	*X,
+	*Y;
+const Dimensions_Type
+	*Width,
+	*Height;
+
+explicit Set_Source (const Rectangle_Set& rectangles)
+	:	X (rectangles.x ()),
+		Y (rectangles.y ()),
+		Width (rectangles.width ()),
+		Height (rectangles.height ())
+	{}
+
+long long left (std::size_t index) const
+	{return X[index];}
+long long top (std::size_t index) const
+	{return Y[index];}
+long long right (std::size_t index) const
+	{return static_cast<long long>(X[index]) + Width[index];}
+long long bottom (std::size_t index) const
+	{return static_cast<long long>(Y[index]) + Height[index];}
+};
+
+
+inline long long
+least
+	(
+	long long	first,
+	long long	second
+	)
+{return (first < second) ? first : second;}
+
+
+inline long long
+greatest
+	(
+	long long	first,
+	long long	second
+	)
+{return (first > second) ? first : second;}
+
+
+template<typename Source>
+void
+intersect
+	(
+	Coordinate_Type*	x,
+	Coordinate_Type*	y,
+	Dimensions_Type*	width,
+	Dimensions_Type*	height,
+	std::size_t			count,
+	const Source&		source
+	)
+{
+for (std::size_t
+		index = 0;
+		index < count;
+	  ++index)
+	{
+	long long
+		this_left   = x[index],
+		this_top    = y[index],
+		this_right  = this_left + width[index],
+		this_bottom = this_top + height[index],
+		that_left   = source.left (index),
+		that_top    = source.top (index),
+		that_right  = source.right (index),
+		that_bottom = source.bottom (index);
+	bool
+		disjoint =
+			(this_right  <= that_left) |
+			(that_right  <= this_left) |
+			(this_bottom <= that_top) |
+			(that_bottom <= this_top);
+	long long
+		left   = greatest (this_left, that_left),
+		top    = greatest (this_top, that_top);
+	//	The position is unchanged when there is no intersection.
+	x[index]      = static_cast<Coordinate_Type>(disjoint ? this_left : left);
+	y[index]      = static_cast<Coordinate_Type>(disjoint ? this_top : top);
+	width[index]  = static_cast<Dimensions_Type>
+		(disjoint ? 0 : least (this_right, that_right) - left);
+	height[index] = static_cast<Dimensions_Type>
+		(disjoint ? 0 : least (this_bottom, that_bottom) - top);
+	}
+}
+
+
+template<typename Source>
+void
+unite
+	(
+	Coordinate_Type*	x,
+	Coordinate_Type*	y,
+	Dimensions_Type*	width,
+	Dimensions_Type*	height,
+	std::size_t			count,
+	const Source&		source
+	)
+{
+for (std::size_t
+		index = 0;
+		index < count;
+	  ++index)
+	{
+	long long
+		left   = least (x[index], source.left (index)),
+		top    = least (y[index], source.top (index)),
+		right  = greatest (static_cast<long long>(x[index]) + width[index],
+			source.right (index)),
+		bottom = greatest (static_cast<long long>(y[index]) + height[index],
+			source.bottom (index));
+	x[index]      = static_cast<Coordinate_Type>(left);
+	y[index]      = static_cast<Coordinate_Type>(top);
+	width[index]  = static_cast<Dimensions_Type>(right - left);
+	height[index] = static_cast<Dimensions_Type>(bottom - top);
+	}
+}
+
+
+template<typename Source>
+std::size_t
+overlap
+	(
+	const Coordinate_Type*	x,
+	const Coordinate_Type*	y,
+	const Dimensions_Type*	width,
+	const Dimensions_Type*	height,
+	std::size_t				count,
+	const Source&			source,
+	unsigned char*			mask
+	)
+{
+std::size_t
+	total = 0;
+for (std::size_t
+		index = 0;
+		index < count;
+	  ++index)
+	{
+	long long
+		left   = greatest (x[index], source.left (index)),
+		top    = greatest (y[index], source.top (index)),
+		right  = least (static_cast<long long>(x[index]) + width[index],
+			source.right (index)),
+		bottom = least (static_cast<long long>(y[index]) + height[index],
+			source.bottom (index));
+	unsigned char
+		overlaps = (left < right) & (top < bottom);
+	mask[index] = overlaps;
+	total += overlaps;
+	}
+return total;
+}
+
+}	//	local namespace
+
+/*==============================================================================
+	Constructors
+*/
+Rectangle_Set::Rectangle_Set ()
+{}
+
+
+Rectangle_Set::Rectangle_Set
+	(
+	size_type	count
+	)
+	:	X (count, 0),
+		Y (count, 0),
+		Width (count, 0),
+		Height (count, 0)
+{}
+
+
+Rectangle_Set::Rectangle_Set
+	(
+	const std::vector<Rectangle>&	rectangles
+	)
+{
+reserve (rectangles.size ());
+for (vector<Rectangle>::const_iterator
+		rectangle = rectangles.begin ();
+		rectangle != rectangles.end ();
+	  ++rectangle)
+	push_back (*rectangle);
+}
+
+/*==============================================================================
+	Contents
+*/
+Rectangle_Set&
+Rectangle_Set::reserve
+	(
+	size_type	count
+	)
+{
+X.reserve (count);
+Y.reserve (count);
+Width.reserve (count);
+Height.reserve (count);
+return *this;
+}
+
+
+Rectangle_Set&
+Rectangle_Set::resize
+	(
+	size_type	count
+	)
+{
+X.resize (count, 0);
+Y.resize (count, 0);
+Width.resize (count, 0);
+Height.resize (count, 0);
+return *this;
+}
+
+
+Rectangle_Set&
+Rectangle_Set::clear ()
+{
+X.clear ();
+Y.clear ();
+Width.clear ();
+Height.clear ();
+return *this;
+}
+
+
+Rectangle_Set&
+Rectangle_Set::push_back
+	(
+	const Rectangle&	rectangle
+	)
+{
+X.push_back (rectangle.X);
+Y.push_back (rectangle.Y);
+Width.push_back (rectangle.Width);
+Height.push_back (rectangle.Height);
+return *this;
+}
+
+
+Rectangle_Set&
+Rectangle_Set::set
+	(
+	size_type			index,
+	const Rectangle&	rectangle
+	)
+{
+X[index]      = rectangle.X;
+Y[index]      = rectangle.Y;
+Width[index]  = rectangle.Width;
+Height[index] = rectangle.Height;
+return *this;
+}
+
+
+std::vector<Rectangle>
+Rectangle_Set::rectangles () const
+{
+vector<Rectangle>
+	rectangles;
+rectangles.reserve (size ());
+for (size_type
+		index = 0;
+		index < size ();
+	  ++index)
+	rectangles.push_back ((*this)[index]);
+return rectangles;
+}
+
+/*==============================================================================
+	Manipulators
+*/
+Rectangle_Set&
+Rectangle_Set::operator&=
+	(
+	const Rectangle&	rectangle
+	)
+{
+intersect (X.data (), Y.data (), Width.data (), Height.data (), size (),
+	Single_Source (rectangle));
+return *this;
+}
+
+
+Rectangle_Set&
+Rectangle_Set::operator&=
+	(
+	const Rectangle_Set&	rectangles
+	)
+{
+check (rectangles);
+intersect (X.data (), Y.data (), Width.data (), Height.data (), size (),
+	Set_Source (rectangles));
+return *this;
+}
+
+
+Rectangle_Set&
+Rectangle_Set::operator|=
+	(
+	const Rectangle&	rectangle
+	)
+{
+unite (X.data (), Y.data (), Width.data (), Height.data (), size (),
+	Single_Source (rectangle));
+return *this;
+}
+
+
+Rectangle_Set&
+Rectangle_Set::operator|=
+	(
+	const Rectangle_Set&	rectangles
+	)
+{
+check (rectangles);
+unite (X.data (), Y.data (), Width.data (), Height.data (), size (),
+	Set_Source (rectangles));
+return *this;
+}
+
+/*==============================================================================
+	Tests
+*/
+Rectangle_Set::size_type
+Rectangle_Set::overlaps
+	(
+	const Rectangle&	rectangle,
+	Mask&				mask
+	) const
+{
+mask.resize (size ());
+return overlap (X.data (), Y.data (), Width.data (), Height.data (), size (),
+	Single_Source (rectangle), mask.data ());
+}
+
+
+Rectangle_Set::size_type
+Rectangle_Set::overlaps
+	(
+	const Rectangle_Set&	rectangles,
+	Mask&					mask
+	) const
+{
+check (rectangles);
+mask.resize (size ());
+return overlap (X.data (), Y.data (), Width.data (), Height.data (), size (),
+	Set_Source (rectangles), mask.data ());
+}
+
+
+Rectangle_Set::size_type
+Rectangle_Set::contains
+	(
+	const Rectangle&	rectangle,
+	Mask&				mask
+	) const
+{
+mask.resize (size ());
+const long long
+	left   = rectangle.X,
+	top    = rectangle.Y,
+	right  = left + rectangle.Width,
+	bottom = top + rectangle.Height;
+const Coordinate_Type
+	*x = X.data (),
+	*y = Y.data ();
+const Dimensions_Type
+	*width = Width.data (),
+	*height = Height.data ();
+unsigned char
+	*values = mask.data ();
+size_type
+	total = 0;
+for (size_type
+		index = 0;
+		index < size ();
+	  ++index)
+	{
+	unsigned char
+		contained =
+			(x[index] <= left) &
+			(y[index] <= top) &
+			(right <= static_cast<long long>(x[index]) + width[index]) &
+			(bottom <= static_cast<long long>(y[index]) + height[index]);
+	values[index] = contained;
+	total += contained;
+	}
+return total;
+}
+
+
+Rectangle_Set::size_type
+Rectangle_Set::contains
+	(
+	const Point_2D&	point,
+	Mask&			mask
+	) const
+{return contains (Rectangle (point, Size_2D (1)), mask);}
+
+
+Rectangle_Set::size_type
+Rectangle_Set::within
+	(
+	const Rectangle&	rectangle,
+	Mask&				mask
+	) const
+{
+mask.resize (size ());
+const long long
+	left   = rectangle.X,
+	top    = rectangle.Y,
+	right  = left + rectangle.Width,
+	bottom = top + rectangle.Height;
+const Coordinate_Type
+	*x = X.data (),
+	*y = Y.data ();
+const Dimensions_Type
+	*width = Width.data (),
+	*height = Height.data ();
+unsigned char
+	*values = mask.data ();
+size_type
+	total = 0;
+for (size_type
+		index = 0;
+		index < size ();
+	  ++index)
+	{
+	unsigned char
+		inside =
+			(left <= x[index]) &
+			(top <= y[index]) &
+			(static_cast<long long>(x[index]) + width[index] <= right) &
+			(static_cast<long long>(y[index]) + height[index] <= bottom);
+	values[index] = inside;
+	total += inside;
+	}
+return total;
+}
+
+
+unsigned long long
+Rectangle_Set::areas
+	(
+	std::vector<unsigned long long>&	areas
+	) const
+{
+areas.resize (size ());
+const Dimensions_Type
+	*width = Width.data (),
+	*height = Height.data ();
+unsigned long long
+	*values = areas.data (),
+	total = 0;
+for (size_type
+		index = 0;
+		index < size ();
+	  ++index)
+	{
+	values[index] =
+		static_cast<unsigned long long>(width[index]) * height[index];
+	total += values[index];
+	}
+return total;
+}
+
+/*==============================================================================
+	Helpers
+*/
+void
+Rectangle_Set::check
+	(
+	const Rectangle_Set&	rectangles
+	) const
+{
+if (rectangles.size () != size ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't combine a set of " << size ()
+				<< " Rectangles with a set of " << rectangles.size ()
+				<< " Rectangles.";
+	throw invalid_argument (message.str ());
+	}
+}
@@ -0,0 +1,318 @@
+/*	Rectangle_Set
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Rectangle_Set_
+#define _Rectangle_Set_
+
+#include	"Dimensions.hh"
+
+#include	<cstddef>
+#include	<vector>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Rectangle_Set
+*/
+/**	A <i>Rectangle_Set</i> is a sequence of Rectangles held as separate
+	columns of X, Y, Width and Height values.
+
+	The operations of a Rectangle_Set apply to all of its Rectangles in
+	one pass: each Rectangle is intersected or united with, or tested
+	against, a single Rectangle or the Rectangle at the same position in
+	another Rectangle_Set of the same size. The results are the same as
+	those of the Rectangle operators applied to each Rectangle, but the
+	loops are free of branches and read each column in sequence, so the
+	compiler can vectorize them.
+
+	The results of tests are produced as a Mask with one value for each
+	Rectangle that is 1 where the test is true and 0 where it is false.
+
+	<code>
+	Rectangle_Set footprints (rectangles);<br>
+	Rectangle_Set::Mask visible;<br>
+	footprints.overlaps (viewport, visible);<br>
+	footprints &= viewport;
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Rectangle
+*/
+class Rectangle_Set
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Rectangle position in the set.
+typedef std::size_t					size_type;
+
+//!	Test results; one value, 1 or 0, per Rectangle.
+typedef std::vector<unsigned char>	Mask;
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+//!	Constructs an empty Rectangle_Set.
+Rectangle_Set ();
+
+/**	Constructs a Rectangle_Set of empty Rectangles.
+
+	@param	count	The number of Rectangles, each at position 0,0 with
+		no size.
+*/
+explicit Rectangle_Set (size_type count);
+
+/**	Constructs a Rectangle_Set from a vector of Rectangles.
+
+	@param	rectangles	The Rectangles to be copied into the set.
+*/
+explicit Rectangle_Set (const std::vector<Rectangle>& rectangles);
+
+/*==============================================================================
+	Contents
+*/
+/**	Gets the number of Rectangles.
+
+	@return	The number of Rectangles in the set.
+*/
+size_type size () const
+	{return X.size ();}
+
+/**	Tests if the set is empty.
+
+	@return	true if there are no Rectangles in the set; false otherwise.
+*/
+bool empty () const
+	{return X.empty ();}
+
+/**	Reserves storage for Rectangles.
+
+	@param	count	The number of Rectangles for which to reserve storage.
+	@return	This Rectangle_Set.
+*/
+Rectangle_Set& reserve (size_type count);
+
+/**	Changes the number of Rectangles.
+
+	Added Rectangles are empty at position 0,0.
+
+	@param	count	The number of Rectangles in the set.
+	@return	This Rectangle_Set.
+*/
+Rectangle_Set& resize (size_type count);
+
+/**	Removes all Rectangles.
+
+	@return	This Rectangle_Set.
+*/
+Rectangle_Set& clear ();
+
+/**	Appends a Rectangle.
+
+	@param	rectangle	The Rectangle to be appended to the set.
+	@return	This Rectangle_Set.
+*/
+Rectangle_Set& push_back (const Rectangle& rectangle);
+
+/**	Gets a Rectangle.
+
+	@param	index	The position of the Rectangle in the set. This must be
+		less than the {@link size() size}.
+	@return	A copy of the Rectangle.
+*/
+Rectangle operator[] (size_type index) const
+	{return Rectangle (X[index], Y[index], Width[index], Height[index]);}
+
+/**	Sets a Rectangle.
+
+	@param	index	The position of the Rectangle in the set. This must be
+		less than the {@link size() size}.
+	@param	rectangle	The Rectangle to be put in the set.
+	@return	This Rectangle_Set.
+*/
+Rectangle_Set& set
+	(
+	size_type			index,
+	const Rectangle&	rectangle
+	);
+
+/**	Gets the Rectangles.
+
+	@return	A vector with a copy of each Rectangle in the set.
+*/
+std::vector<Rectangle> rectangles () const;
+
+/*==============================================================================
+	Columns
+*/
+//!	Gets the X column.
+const Coordinate_Type* x () const
+	{return X.data ();}
+//!	Gets the modifiable X column.
+Coordinate_Type* x ()
+	{return X.data ();}
+
+//!	Gets the Y column.
+const Coordinate_Type* y () const
+	{return Y.data ();}
+//!	Gets the modifiable Y column.
+Coordinate_Type* y ()
+	{return Y.data ();}
+
+//!	Gets the Width column.
+const Dimensions_Type* width () const
+	{return Width.data ();}
+//!	Gets the modifiable Width column.
+Dimensions_Type* width ()
+	{return Width.data ();}
+
+//!	Gets the Height column.
+const Dimensions_Type* height () const
+	{return Height.data ();}
+//!	Gets the modifiable Height column.
+Dimensions_Type* height ()
+	{return Height.data ();}
+
+/*==============================================================================
+	Manipulators
+*/
+/**	Takes the intersection of each Rectangle with a Rectangle.
+
+	@param	rectangle	The Rectangle to intersect with each Rectangle.
+	@return	This Rectangle_Set with each Rectangle changed as the
+		Rectangle intersection operator would change it.
+*/
+Rectangle_Set& operator&= (const Rectangle& rectangle);
+
+/**	Takes the intersection of each Rectangle with the Rectangle at the
+	same position in another set.
+
+	@param	rectangles	The Rectangle_Set to intersect with this set.
+	@return	This Rectangle_Set with each Rectangle changed as the
+		Rectangle intersection operator would change it.
+	@throws	std::invalid_argument	If the sets are not the same size.
+*/
+Rectangle_Set& operator&= (const Rectangle_Set& rectangles);
+
+/**	Takes the union of each Rectangle with a Rectangle.
+
+	@param	rectangle	The Rectangle to unite with each Rectangle.
+	@return	This Rectangle_Set with each Rectangle changed as the
+		Rectangle union operator would change it.
+*/
+Rectangle_Set& operator|= (const Rectangle& rectangle);
+
+/**	Takes the union of each Rectangle with the Rectangle at the same
+	position in another set.
+
+	@param	rectangles	The Rectangle_Set to unite with this set.
+	@return	This Rectangle_Set with each Rectangle changed as the
+		Rectangle union operator would change it.
+	@throws	std::invalid_argument	If the sets are not the same size.
+*/
+Rectangle_Set& operator|= (const Rectangle_Set& rectangles);
+
+/*==============================================================================
+	Tests
+*/
+/**	Tests which Rectangles overlap a Rectangle.
+
+	Rectangles overlap when their intersection is not empty.
+
+	@param	rectangle	The Rectangle to be tested against.
+	@param	mask	The Mask that is set to the results.
+	@return	The number of Rectangles that overlap.
+*/
+size_type overlaps (const Rectangle& rectangle, Mask& mask) const;
+
+/**	Tests which Rectangles overlap the Rectangle at the same position in
+	another set.
+
+	@param	rectangles	The Rectangle_Set to be tested against.
+	@param	mask	The Mask that is set to the results.
+	@return	The number of Rectangles that overlap.
+	@throws	std::invalid_argument	If the sets are not the same size.
+*/
+size_type overlaps (const Rectangle_Set& rectangles, Mask& mask) const;
+
+/**	Tests which Rectangles contain a Rectangle.
+
+	A Rectangle contains another Rectangle when no edge of the other
+	Rectangle is outside its edges.
+
+	@param	rectangle	The Rectangle to be contained.
+	@param	mask	The Mask that is set to the results.
+	@return	The number of Rectangles that contain the Rectangle.
+*/
+size_type contains (const Rectangle& rectangle, Mask& mask) const;
+
+/**	Tests which Rectangles contain a pixel.
+
+	@param	point	The position of the pixel.
+	@param	mask	The Mask that is set to the results.
+	@return	The number of Rectangles that contain the pixel.
+*/
+size_type contains (const Point_2D& point, Mask& mask) const;
+
+/**	Tests which Rectangles are within a Rectangle.
+
+	@param	rectangle	The Rectangle that is to contain the Rectangles.
+	@param	mask	The Mask that is set to the results.
+	@return	The number of Rectangles within the Rectangle.
+	@see	contains(const Rectangle&, Mask&)const
+*/
+size_type within (const Rectangle& rectangle, Mask& mask) const;
+
+/**	Gets the area of each Rectangle.
+
+	@param	areas	A vector that is set to the area of each Rectangle.
+	@return	The sum of the areas.
+*/
+unsigned long long areas (std::vector<unsigned long long>& areas) const;
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+void check (const Rectangle_Set& rectangles) const;
+
+/*==============================================================================
+	Data
+*/
+std::vector<Coordinate_Type>
+	X,
+	Y;
+std::vector<Dimensions_Type>
+	Width,
+	Height;
+
+};	//	class Rectangle_Set
+
+}	//	namespace PIRL
+#endif
@@ -48,6 +48,8 @@ using std::clog;
 using std::endl;
 #endif	//	DEBUG
 
+#include	<atomic>
+
 
 namespace PIRL
 {
@@ -109,6 +111,11 @@ namespace PIRL
 	Distinct Reference_Counted_Pointer objects can be bound together by
 	assigning one to the other.
 
+	The reference counter is updated atomically, so copies of a
+	Reference_Counted_Pointer may be created and destroyed concurrently in
+	different threads. Access to the referenced object, and to any single
+	Reference_Counted_Pointer object, is not synchronized.
+
 	This implementation is based on the CountedPtr class in "The C++
 	Standard Library", by Nicolai M. Josuttis.
 
@@ -121,7 +128,7 @@ class Reference_Counted_Pointer
 private:
 T
 	*Pointer;
-long
+std::atomic<long>
 	*Counter;
 
 
@@ -145,7 +152,7 @@ public:
 */
 explicit Reference_Counted_Pointer (T* pointer = 0)
 	:	Pointer (pointer),
-		Counter (new long (1))
+		Counter (new std::atomic<long> (1))
 {
 #ifdef RCP_DEBUG
 clog << ">-< Reference_Counted_Pointer @ " << (void*)this
@@ -303,7 +310,7 @@ if (Pointer != pointer)
 	{
 	dispose ();
 	Pointer = pointer;
-	Counter = new long (1);
+	Counter = new std::atomic<long> (1);
 	#ifdef RCP_DEBUG
 	clog << "    reset Pointer and Counter" << endl;
 	#endif
@@ -0,0 +1,791 @@
+/*	Region
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Region.hh"
+using namespace PIRL;
+
+#include	<vector>
+using std::vector;
+
+#include	<set>
+using std::multiset;
+
+#include	<utility>
+using std::pair;
+using std::make_pair;
+
+#include	<algorithm>
+using std::sort;
+using std::unique;
+using std::lower_bound;
+using std::upper_bound;
+using std::min;
+using std::max;
+
+#include	<limits>
+using std::numeric_limits;
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Region::ID =
+		"PIRL::Region ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+namespace
+{
+//	Rectangle edges that can not overflow.
+struct Edges
+{
+long long
+	Left,
+	Top,
+	Right,
+	Bottom;
+
+explicit Edges (const Rectangle& rectangle)
+	:	Left (rectangle.X),
+		Top (rectangle.Y),
+		Right (static_cast<long long>(rectangle.X) + rectangle.Width),
+		Bottom (static_cast<long long>(rectangle.Y) + rectangle.Height)
+	{}
+
+bool is_empty () const
+	{return Left >= Right || Top >= Bottom;}
+};
+
+
+/*	A segment tree over the elementary intervals between sorted
+	horizontal edges that counts how many times each node interval is
+	covered and the length of it that is covered.
+*/
+class Coverage_Tree
+{
+public:
+
+explicit Coverage_Tree (const vector<long long>& edges)
+	:	Edges (edges),
+		Count (4 * edges.size (), 0),
+		Covered (4 * edges.size (), 0)
+	{}
+
+void add (long long left, long long right, int delta)
+	{
+	std::size_t
+		first = lower_bound (Edges.begin (), Edges.end (), left)
+			- Edges.begin (),
+		last = lower_bound (Edges.begin (), Edges.end (), right)
+			- Edges.begin ();
+	if (first < last)
+		update (1, 0, Edges.size () - 1, first, last, delta);
+	}
+
+long long covered () const
+	{return Covered[1];}
+
+private:
+
+//	The node covers the elementary intervals from low to high.
+void update (std::size_t node, std::size_t low, std::size_t high,
+	std::size_t first, std::size_t last, int delta)
+	{
+	if (last <= low || high <= first)
+		return;
+	if (first <= low && high <= last)
+		Count[node] += delta;
+	else
+		{
+		std::size_t
+			middle = (low + high) / 2;
+		update (2 * node, low, middle, first, last, delta);
+		update (2 * node + 1, middle, high, first, last, delta);
+		}
+	if (Count[node])
+		Covered[node] = Edges[high] - Edges[low];
+	else if (high - low == 1)
+		Covered[node] = 0;
+	else
+		Covered[node] = Covered[2 * node] + Covered[2 * node + 1];
+	}
+
+const vector<long long>
+	&Edges;
+vector<int>
+	Count;
+vector<long long>
+	Covered;
+};
+
+}	//	local namespace
+
+/*==============================================================================
+	Constructors
+*/
+Region::Region ()
+{}
+
+
+Region::Region
+	(
+	const Rectangle&	rectangle
+	)
+{
+Edges
+	edges (rectangle);
+if (! edges.is_empty ())
+	{
+	Span
+		span = {edges.Left, edges.Right};
+	append (edges.Top, edges.Bottom, &span, 1);
+	}
+}
+
+
+Region::Region
+	(
+	const std::vector<Rectangle>&	rectangles
+	)
+{
+vector<Edges>
+	edges;
+vector<long long>
+	rows;
+for (vector<Rectangle>::const_iterator
+		rectangle = rectangles.begin ();
+		rectangle != rectangles.end ();
+	  ++rectangle)
+	{
+	Edges
+		rectangle_edges (*rectangle);
+	if (rectangle_edges.is_empty ())
+		continue;
+	edges.push_back (rectangle_edges);
+	rows.push_back (rectangle_edges.Top);
+	rows.push_back (rectangle_edges.Bottom);
+	}
+sort (rows.begin (), rows.end ());
+rows.erase (unique (rows.begin (), rows.end ()), rows.end ());
+
+//	The Rectangles in order of their top and of their bottom edges.
+vector<const Edges*>
+	by_top,
+	by_bottom;
+for (vector<Edges>::const_iterator
+		rectangle = edges.begin ();
+		rectangle != edges.end ();
+	  ++rectangle)
+	{
+	by_top.push_back (&*rectangle);
+	by_bottom.push_back (&*rectangle);
+	}
+sort (by_top.begin (), by_top.end (),
+	[] (const Edges* first, const Edges* second)
+		{return first->Top < second->Top;});
+sort (by_bottom.begin (), by_bottom.end (),
+	[] (const Edges* first, const Edges* second)
+		{return first->Bottom < second->Bottom;});
+
+//	The spans of the Rectangles that cross the sweep line.
+multiset<pair<long long, long long> >
+	active;
+vector<Span>
+	spans;
+std::size_t
+	top = 0,
+	bottom = 0;
+for (std::size_t
+		row = 0;
+		row + 1 < rows.size ();
+	  ++row)
+	{
+	while (bottom < by_bottom.size () &&
+		   by_bottom[bottom]->Bottom == rows[row])
+		{
+		active.erase (active.find (make_pair
+			(by_bottom[bottom]->Left, by_bottom[bottom]->Right)));
+		++bottom;
+		}
+	while (top < by_top.size () &&
+		   by_top[top]->Top == rows[row])
+		{
+		active.insert (make_pair (by_top[top]->Left, by_top[top]->Right));
+		++top;
+		}
+	spans.clear ();
+	for (multiset<pair<long long, long long> >::const_iterator
+			span = active.begin ();
+			span != active.end ();
+		  ++span)
+		{
+		if (! spans.empty () &&
+			span->first <= spans.back ().Right)
+			spans.back ().Right = max (spans.back ().Right, span->second);
+		else
+			{
+			Span
+				next = {span->first, span->second};
+			spans.push_back (next);
+			}
+		}
+	append (rows[row], rows[row + 1], spans.data (), spans.size ());
+	}
+}
+
+/*==============================================================================
+	Accessors
+*/
+std::vector<Rectangle>
+Region::rectangles () const
+{
+vector<Rectangle>
+	rectangles;
+rectangles.reserve (Spans.size ());
+for (vector<Band>::const_iterator
+		band = Bands.begin ();
+		band != Bands.end ();
+	  ++band)
+	for (std::size_t
+			span = band->First;
+			span < band->First + band->Count;
+		  ++span)
+		rectangles.push_back (Rectangle
+			(static_cast<Coordinate_Type>(Spans[span].Left),
+			 static_cast<Coordinate_Type>(band->Top),
+			 static_cast<Dimensions_Type>(Spans[span].Right - Spans[span].Left),
+			 static_cast<Dimensions_Type>(band->Bottom - band->Top)));
+return rectangles;
+}
+
+
+Rectangle
+Region::bounds () const
+{
+if (Bands.empty ())
+	return Rectangle ();
+long long
+	left = numeric_limits<long long>::max (),
+	right = numeric_limits<long long>::min ();
+for (vector<Band>::const_iterator
+		band = Bands.begin ();
+		band != Bands.end ();
+	  ++band)
+	{
+	left = min (left, Spans[band->First].Left);
+	right = max (right, Spans[band->First + band->Count - 1].Right);
+	}
+return Rectangle
+	(static_cast<Coordinate_Type>(left),
+	 static_cast<Coordinate_Type>(Bands.front ().Top),
+	 static_cast<Dimensions_Type>(right - left),
+	 static_cast<Dimensions_Type>(Bands.back ().Bottom - Bands.front ().Top));
+}
+
+
+unsigned long long
+Region::area () const
+{
+unsigned long long
+	total = 0;
+for (vector<Band>::const_iterator
+		band = Bands.begin ();
+		band != Bands.end ();
+	  ++band)
+	{
+	unsigned long long
+		width = 0;
+	for (std::size_t
+			span = band->First;
+			span < band->First + band->Count;
+		  ++span)
+		width += Spans[span].Right - Spans[span].Left;
+	total += width * (band->Bottom - band->Top);
+	}
+return total;
+}
+
+
+unsigned long long
+Region::area
+	(
+	const std::vector<Rectangle>&	rectangles
+	)
+{
+struct Event
+{
+long long
+	Y,
+	Left,
+	Right;
+int
+	Delta;
+};
+vector<Event>
+	events;
+vector<long long>
+	columns;
+for (vector<Rectangle>::const_iterator
+		rectangle = rectangles.begin ();
+		rectangle != rectangles.end ();
+	  ++rectangle)
+	{
+	Edges
+		edges (*rectangle);
+	if (edges.is_empty ())
+		continue;
+	Event
+		top = {edges.Top, edges.Left, edges.Right, 1},
+		bottom = {edges.Bottom, edges.Left, edges.Right, -1};
+	events.push_back (top);
+	events.push_back (bottom);
+	columns.push_back (edges.Left);
+	columns.push_back (edges.Right);
+	}
+if (events.empty ())
+	return 0;
+sort (columns.begin (), columns.end ());
+columns.erase (unique (columns.begin (), columns.end ()), columns.end ());
+sort (events.begin (), events.end (),
+	[] (const Event& first, const Event& second)
+		{return first.Y < second.Y;});
+
+Coverage_Tree
+	coverage (columns);
+unsigned long long
+	total = 0;
+for (std::size_t
+		event = 0;
+		event < events.size ();
+	  ++event)
+	{
+	if (event)
+		total += static_cast<unsigned long long>(coverage.covered ())
+			* (events[event].Y - events[event - 1].Y);
+	coverage.add (events[event].Left, events[event].Right,
+		events[event].Delta);
+	}
+return total;
+}
+
+/*==============================================================================
+	Tests
+*/
+bool
+Region::contains
+	(
+	const Point_2D&	point
+	) const
+{
+std::size_t
+	band = band_below (point.Y);
+if (band == Bands.size () ||
+	Bands[band].Top > point.Y)
+	return false;
+const Span
+	*first = &Spans[Bands[band].First],
+	*last = first + Bands[band].Count,
+	*span = upper_bound (first, last, static_cast<long long>(point.X),
+		[] (long long x, const Span& span) {return x < span.Right;});
+return span != last && span->Left <= point.X;
+}
+
+
+bool
+Region::contains
+	(
+	const Rectangle&	rectangle
+	) const
+{
+Edges
+	edges (rectangle);
+if (edges.is_empty ())
+	return true;
+long long
+	y = edges.Top;
+for (std::size_t
+		band = band_below (y);
+		y < edges.Bottom;
+	  ++band)
+	{
+	if (band == Bands.size () ||
+		Bands[band].Top > y)
+		return false;
+	const Span
+		*first = &Spans[Bands[band].First],
+		*last = first + Bands[band].Count,
+		*span = upper_bound (first, last, edges.Left,
+			[] (long long x, const Span& span) {return x < span.Right;});
+	if (span == last ||
+		span->Left > edges.Left ||
+		span->Right < edges.Right)
+		return false;
+	y = Bands[band].Bottom;
+	}
+return true;
+}
+
+
+bool
+Region::overlaps
+	(
+	const Rectangle&	rectangle
+	) const
+{
+Edges
+	edges (rectangle);
+if (edges.is_empty ())
+	return false;
+for (std::size_t
+		band = band_below (edges.Top);
+		band < Bands.size () &&
+		Bands[band].Top < edges.Bottom;
+	  ++band)
+	{
+	const Span
+		*first = &Spans[Bands[band].First],
+		*last = first + Bands[band].Count,
+		*span = upper_bound (first, last, edges.Left,
+			[] (long long x, const Span& span) {return x < span.Right;});
+	if (span != last &&
+		span->Left < edges.Right)
+		return true;
+	}
+return false;
+}
+
+
+bool
+Region::operator==
+	(
+	const Region&	region
+	) const
+{
+if (Bands.size () != region.Bands.size () ||
+	Spans.size () != region.Spans.size ())
+	return false;
+for (std::size_t
+		band = 0;
+		band < Bands.size ();
+	  ++band)
+	if (Bands[band].Top != region.Bands[band].Top ||
+		Bands[band].Bottom != region.Bands[band].Bottom ||
+		Bands[band].Count != region.Bands[band].Count)
+		return false;
+for (std::size_t
+		span = 0;
+		span < Spans.size ();
+	  ++span)
+	if (Spans[span].Left != region.Spans[span].Left ||
+		Spans[span].Right != region.Spans[span].Right)
+		return false;
+return true;
+}
+
+/*==============================================================================
+	Manipulators
+*/
+Region&
+Region::operator|=
+	(
+	const Region&	region
+	)
+{
+Region
+	result;
+combine (*this, region, UNION, result);
+Bands.swap (result.Bands);
+Spans.swap (result.Spans);
+return *this;
+}
+
+
+Region&
+Region::operator|=
+	(
+	const Rectangle&	rectangle
+	)
+{
+Edges
+	edges (rectangle);
+if (edges.is_empty () ||
+	contains (rectangle))
+	return *this;
+
+/*	The bands that the Rectangle covers, and the bands next to them
+	which may be joined with new bands, are united with the Rectangle
+	and replace the original bands.
+*/
+std::size_t
+	first = band_below (edges.Top),
+	last = first;
+while (last < Bands.size () &&
+	   Bands[last].Top < edges.Bottom)
+	++last;
+if (first)
+	--first;
+if (last < Bands.size ())
+	++last;
+std::size_t
+	first_span = (first < Bands.size ()) ?
+		Bands[first].First : Spans.size (),
+	last_span = (last < Bands.size ()) ?
+		Bands[last].First : Spans.size ();
+
+Region
+	covered,
+	result;
+for (std::size_t
+		band = first;
+		band < last;
+	  ++band)
+	covered.append (Bands[band].Top, Bands[band].Bottom,
+		&Spans[Bands[band].First], Bands[band].Count);
+combine (covered, Region (rectangle), UNION, result);
+
+Spans.erase (Spans.begin () + first_span, Spans.begin () + last_span);
+Spans.insert (Spans.begin () + first_span,
+	result.Spans.begin (), result.Spans.end ());
+for (vector<Band>::iterator
+		band = result.Bands.begin ();
+		band != result.Bands.end ();
+	  ++band)
+	band->First += first_span;
+Bands.erase (Bands.begin () + first, Bands.begin () + last);
+Bands.insert (Bands.begin () + first,
+	result.Bands.begin (), result.Bands.end ());
+for (std::size_t
+		band = first + result.Bands.size ();
+		band < Bands.size ();
+	  ++band)
+	Bands[band].First =
+		Bands[band].First + result.Spans.size () - (last_span - first_span);
+return *this;
+}
+
+
+Region&
+Region::operator&=
+	(
+	const Region&	region
+	)
+{
+Region
+	result;
+combine (*this, region, INTERSECTION, result);
+Bands.swap (result.Bands);
+Spans.swap (result.Spans);
+return *this;
+}
+
+
+Region&
+Region::operator-=
+	(
+	const Region&	region
+	)
+{
+Region
+	result;
+combine (*this, region, DIFFERENCE, result);
+Bands.swap (result.Bands);
+Spans.swap (result.Spans);
+return *this;
+}
+
+
+Region&
+Region::clear ()
+{
+Bands.clear ();
+Spans.clear ();
+return *this;
+}
+
+/*==============================================================================
+	Helpers
+*/
+/*	Combines two Regions.
+
+	The bands of both Regions are merged in vertical order: between each
+	successive pair of band edges of either Region the spans of the band
+	of each Region there, if any, are merged by moving across their edges
+	in horizontal order and tracking whether the position is in each.
+*/
+void
+Region::combine
+	(
+	const Region&	first,
+	const Region&	second,
+	Operation		operation,
+	Region&			result
+	)
+{
+result.clear ();
+vector<Span>
+	spans;
+std::size_t
+	first_band = 0,
+	second_band = 0;
+long long
+	y = numeric_limits<long long>::min ();
+while (true)
+	{
+	const Band
+		*band_1 = (first_band < first.Bands.size ()) ?
+			&first.Bands[first_band] : NULL,
+		*band_2 = (second_band < second.Bands.size ()) ?
+			&second.Bands[second_band] : NULL;
+	if ((! band_1 && ! band_2) ||
+		(operation == INTERSECTION && (! band_1 || ! band_2)) ||
+		(operation == DIFFERENCE && ! band_1))
+		break;
+	bool
+		in_1 = band_1 && band_1->Top <= y,
+		in_2 = band_2 && band_2->Top <= y;
+	if (! in_1 && ! in_2)
+		{
+		//	Move to the next band.
+		y = band_1 ?
+			(band_2 ? min (band_1->Top, band_2->Top) : band_1->Top) :
+			band_2->Top;
+		continue;
+		}
+	long long
+		next = numeric_limits<long long>::max ();
+	if (band_1)
+		next = min (next, in_1 ? band_1->Bottom : band_1->Top);
+	if (band_2)
+		next = min (next, in_2 ? band_2->Bottom : band_2->Top);
+
+	//	Merge the spans.
+	const Span
+		*spans_1 = in_1 ? &first.Spans[band_1->First] : NULL,
+		*spans_2 = in_2 ? &second.Spans[band_2->First] : NULL;
+	std::size_t
+		edges_1 = in_1 ? 2 * band_1->Count : 0,
+		edges_2 = in_2 ? 2 * band_2->Count : 0,
+		edge_1 = 0,
+		edge_2 = 0;
+	bool
+		inside_1 = false,
+		inside_2 = false,
+		inside = false;
+	long long
+		left = 0;
+	spans.clear ();
+	while (edge_1 < edges_1 ||
+		   edge_2 < edges_2)
+		{
+		long long
+			x_1 = (edge_1 < edges_1) ? ((edge_1 & 1) ?
+				spans_1[edge_1 / 2].Right : spans_1[edge_1 / 2].Left) :
+				numeric_limits<long long>::max (),
+			x_2 = (edge_2 < edges_2) ? ((edge_2 & 1) ?
+				spans_2[edge_2 / 2].Right : spans_2[edge_2 / 2].Left) :
+				numeric_limits<long long>::max (),
+			x = min (x_1, x_2);
+		if (x_1 == x)
+			{
+			inside_1 = ! inside_1;
+			++edge_1;
+			}
+		if (x_2 == x)
+			{
+			inside_2 = ! inside_2;
+			++edge_2;
+			}
+		bool
+			now =
+				(operation == UNION) ? (inside_1 || inside_2) :
+				(operation == INTERSECTION) ? (inside_1 && inside_2) :
+				(inside_1 && ! inside_2);
+		if (now != inside)
+			{
+			if (now)
+				left = x;
+			else
+				{
+				Span
+					span = {left, x};
+				spans.push_back (span);
+				}
+			inside = now;
+			}
+		}
+	result.append (y, next, spans.data (), spans.size ());
+
+	y = next;
+	if (band_1 && band_1->Bottom <= y)
+		++first_band;
+	if (band_2 && band_2->Bottom <= y)
+		++second_band;
+	}
+}
+
+
+/*	Appends a band below the last band, joining it to the last band if
+	they touch and have the same spans.
+*/
+void
+Region::append
+	(
+	long long		top,
+	long long		bottom,
+	const Span*		spans,
+	std::size_t		count
+	)
+{
+if (! count)
+	return;
+if (! Bands.empty () &&
+	Bands.back ().Bottom == top &&
+	Bands.back ().Count == count)
+	{
+	const Span
+		*last = &Spans[Bands.back ().First];
+	std::size_t
+		span = 0;
+	while (span < count &&
+		   last[span].Left == spans[span].Left &&
+		   last[span].Right == spans[span].Right)
+		++span;
+	if (span == count)
+		{
+		Bands.back ().Bottom = bottom;
+		return;
+		}
+	}
+Band
+	band = {top, bottom, Spans.size (), count};
+Bands.push_back (band);
+Spans.insert (Spans.end (), spans, spans + count);
+}
+
+
+//	Finds the first band with a bottom edge below a vertical position.
+std::size_t
+Region::band_below
+	(
+	long long	y
+	) const
+{
+return upper_bound (Bands.begin (), Bands.end (), y,
+	[] (long long position, const Band& band)
+		{return position < band.Bottom;})
+	- Bands.begin ();
+}
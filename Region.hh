@@ -0,0 +1,326 @@
+/*	Region
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Region_
+#define _Region_
+
+#include	"Dimensions.hh"
+
+#include	<cstddef>
+#include	<vector>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Region
+*/
+/**	A <i>Region</i> is an area made of any number of Rectangles.
+
+	A Region is held as a sequence of horizontal bands in increasing
+	vertical order. Each band has a top and bottom edge and a sequence
+	of disjoint horizontal spans, each with a left and right edge, in
+	increasing horizontal order. The representation is canonical: spans
+	that touch are joined, and bands that touch and have the same spans
+	are joined, so a Region has only one representation and two Regions
+	are equal only if they cover the same pixels. The bands and spans are
+	each held in a single array.
+
+	Regions may be combined by union, intersection and difference; each
+	combination is a single merge of the bands of both Regions. A Region
+	built from many Rectangles at once is constructed with a sweep line
+	over the Rectangle edges. A Rectangle added to a Region with the
+	{@link operator|=(const Rectangle&) union operator} only changes the
+	bands it covers, and nothing is changed if the Rectangle is already
+	in the Region, so Regions built one Rectangle at a time - as for
+	tracking damaged areas of an image - remain efficient.
+
+	Edges are held as long long values, as in the Rectangle operators;
+	the Rectangles obtained from a Region must fit in the Rectangle
+	coordinate and dimension types.
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Rectangle
+*/
+class Region
+{
+public:
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/*==============================================================================
+	Constructors
+*/
+//!	Constructs an empty Region.
+Region ();
+
+/**	Constructs a Region from a Rectangle.
+
+	@param	rectangle	The Rectangle covered by the Region.
+*/
+explicit Region (const Rectangle& rectangle);
+
+/**	Constructs a Region from the union of Rectangles.
+
+	A sweep line moves down the horizontal edges of the Rectangles in
+	order; at each edge the spans of the Rectangles that cross the sweep
+	line are joined into a band.
+
+	@param	rectangles	The Rectangles covered by the Region.
+*/
+explicit Region (const std::vector<Rectangle>& rectangles);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Tests if the Region is empty.
+
+	@return	true if the Region covers no area; false otherwise.
+*/
+bool is_empty () const
+	{return Bands.empty ();}
+
+/**	Gets the number of bands.
+
+	@return	The number of bands in the Region.
+*/
+std::size_t bands () const
+	{return Bands.size ();}
+
+/**	Gets the number of Rectangles.
+
+	@return	The number of disjoint Rectangles - one for each span of
+		each band - that make up the Region.
+*/
+std::size_t size () const
+	{return Spans.size ();}
+
+/**	Gets the Rectangles.
+
+	@return	A vector of the disjoint Rectangles - one for each span of
+		each band - that make up the Region, in band order.
+*/
+std::vector<Rectangle> rectangles () const;
+
+/**	Gets the bounding Rectangle.
+
+	@return	The smallest Rectangle that contains the Region. This is an
+		empty Rectangle at 0,0 if the Region is empty.
+*/
+Rectangle bounds () const;
+
+/**	Gets the area.
+
+	@return	The number of pixels in the Region.
+*/
+unsigned long long area () const;
+
+/**	Gets the area of the union of Rectangles.
+
+	The area is found with a sweep line over the Rectangle edges and a
+	segment tree of the horizontal edges that counts how often each
+	segment is covered, in O(n log n) time for n Rectangles, without
+	constructing a Region.
+
+	@param	rectangles	The Rectangles.
+	@return	The number of pixels covered by any of the Rectangles.
+*/
+static unsigned long long area (const std::vector<Rectangle>& rectangles);
+
+/*==============================================================================
+	Tests
+*/
+/**	Tests if a pixel is in the Region.
+
+	@param	point	The position of the pixel.
+	@return	true if the pixel is in the Region; false otherwise.
+*/
+bool contains (const Point_2D& point) const;
+
+/**	Tests if a Rectangle is in the Region.
+
+	@param	rectangle	The Rectangle to be tested.
+	@return	true if every pixel of the Rectangle is in the Region; false
+		otherwise. An empty Rectangle is always contained.
+*/
+bool contains (const Rectangle& rectangle) const;
+
+/**	Tests if a Rectangle overlaps the Region.
+
+	@param	rectangle	The Rectangle to be tested.
+	@return	true if any pixel of the Rectangle is in the Region; false
+		otherwise.
+*/
+bool overlaps (const Rectangle& rectangle) const;
+
+/**	Tests if two Regions are equal.
+
+	@param	region	The Region to compare with this Region.
+	@return	true if both Regions cover the same pixels; false otherwise.
+*/
+bool operator== (const Region& region) const;
+
+/**	Tests if two Regions are not equal.
+
+	@param	region	The Region to compare with this Region.
+	@return	true if the Regions do not cover the same pixels; false
+		otherwise.
+*/
+bool operator!= (const Region& region) const
+	{return ! (*this == region);}
+
+/*==============================================================================
+	Manipulators
+*/
+/**	Takes the union with another Region.
+
+	@param	region	The Region to unite with this Region.
+	@return	This Region.
+*/
+Region& operator|= (const Region& region);
+
+/**	Adds a Rectangle.
+
+	Only the bands that the Rectangle covers, and their neighbors, are
+	changed. If the Rectangle is already in the Region nothing is done.
+
+	@param	rectangle	The Rectangle to add to this Region.
+	@return	This Region.
+*/
+Region& operator|= (const Rectangle& rectangle);
+
+/**	Takes the intersection with another Region.
+
+	@param	region	The Region to intersect with this Region.
+	@return	This Region.
+*/
+Region& operator&= (const Region& region);
+
+/**	Takes the intersection with a Rectangle.
+
+	@param	rectangle	The Rectangle to intersect with this Region.
+	@return	This Region.
+*/
+Region& operator&= (const Rectangle& rectangle)
+	{return *this &= Region (rectangle);}
+
+/**	Takes the difference with another Region.
+
+	@param	region	The Region to remove from this Region.
+	@return	This Region.
+*/
+Region& operator-= (const Region& region);
+
+/**	Takes the difference with a Rectangle.
+
+	@param	rectangle	The Rectangle to remove from this Region.
+	@return	This Region.
+*/
+Region& operator-= (const Rectangle& rectangle)
+	{return *this -= Region (rectangle);}
+
+/**	Removes everything from the Region.
+
+	@return	This Region.
+*/
+Region& clear ();
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+struct Span
+{
+long long
+	Left,
+	Right;
+};
+
+struct Band
+{
+long long
+	Top,
+	Bottom;
+//	The spans of the band in the Spans.
+std::size_t
+	First,
+	Count;
+};
+
+enum Operation
+	{
+	UNION,
+	INTERSECTION,
+	DIFFERENCE
+	};
+
+static void combine (const Region& first, const Region& second,
+	Operation operation, Region& result);
+void append (long long top, long long bottom,
+	const Span* spans, std::size_t count);
+std::size_t band_below (long long y) const;
+
+/*==============================================================================
+	Data
+*/
+std::vector<Band>
+	Bands;
+std::vector<Span>
+	Spans;
+
+};	//	class Region
+
+/*==============================================================================
+	Operators
+*/
+/**	Gets the union of two Regions.
+
+	@param	first	A Region.
+	@param	second	A Region.
+	@return	A Region covering both Regions.
+*/
+inline Region operator| (const Region& first, const Region& second)
+	{Region region (first); return region |= second;}
+
+/**	Gets the intersection of two Regions.
+
+	@param	first	A Region.
+	@param	second	A Region.
+	@return	A Region covering the pixels in both Regions.
+*/
+inline Region operator& (const Region& first, const Region& second)
+	{Region region (first); return region &= second;}
+
+/**	Gets the difference of two Regions.
+
+	@param	first	A Region.
+	@param	second	A Region.
+	@return	A Region covering the pixels of the first Region that are
+		not in the second Region.
+*/
+inline Region operator- (const Region& first, const Region& second)
+	{Region region (first); return region -= second;}
+
+}	//	namespace PIRL
+#endif
@@ -0,0 +1,562 @@
+/*	Static_Data_Block
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Static_Data_Block_
+#define _Static_Data_Block_
+
+#include	"Data_Block.hh"
+#include	"endian.hh"
+
+#include	<cstring>
+#include	<type_traits>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Static_Field
+*/
+/**	A <i>Static_Field</i> describes one element of a Static_Data_Block.
+
+	The element is described entirely at compile time: the application
+	type of its values, the number of values in the element (an array
+	count), and the size in bytes of each value in the data block.
+
+	Each field of a record must be a distinct type; this is how the field
+	is named when its value is accessed. The usual way to do this is to
+	derive an empty struct from a Static_Field:
+
+	<code>
+	struct Time_Tag : Static_Field<unsigned int> {};<br>
+	struct Samples  : Static_Field<short, 128> {};<br>
+	struct Counter  : Static_Field<int, 1, 3> {};
+	</code>
+
+	@param	T	The application data type of the element values.
+	@param	Count	The number of values in the element. A Count of
+		0 is taken to be 1.
+	@param	Value_Size	The size, in bytes, of each element value in
+		the data block. This may differ from sizeof (T) only for integer
+		types, in which case the value is promoted or downcast in the
+		same way as a Data_Block transfer; it may not be more than 8
+		bytes.
+	@author		Bradford Castalia, UA/PIRL
+	@see	Static_Data_Block
+*/
+template
+	<
+	typename			T,
+	Data_Block::Index	Count = 1,
+	Data_Block::Index	Value_Size = sizeof (T)
+	>
+struct Static_Field
+{
+//!	The application data type of the element values.
+typedef T	Value_Type;
+
+//!	The number of values in the element.
+static constexpr Data_Block::Index
+	COUNT		= Count ? Count : 1;
+
+//!	The size, in bytes, of each value in the data block.
+static constexpr Data_Block::Index
+	VALUE_SIZE	= Value_Size;
+
+//!	The size, in bytes, of the entire element.
+static constexpr Data_Block::Index
+	SIZE		= COUNT * VALUE_SIZE;
+
+static_assert (VALUE_SIZE == sizeof (T) ||
+	(std::is_integral<T>::value && VALUE_SIZE && VALUE_SIZE <= 8),
+	"A Static_Field value size must be the size of its type,"
+	" or 1 to 8 bytes for an integer type.");
+};
+
+/*=*****************************************************************************
+	Static_Data_Block
+*/
+/**	A <i>Static_Data_Block</i> manages access to a block of binary data
+	bytes having a structure that is fixed at compile time.
+
+	A Data_Block defines its structure at run time: element offsets and
+	array counts are held in lists, and every access looks them up.
+	When a record layout is known when the application is compiled the
+	Static_Data_Block offers the same byte order and alignment
+	independence without any run time structure. The structure is
+	described by a list of Static_Field types, one per element in
+	increasing offset order; every element offset, size and count is a
+	compile time constant. Accessing a field compiles to a load from a
+	fixed offset in the data block plus, when the data is not in native
+	order, a byte swap.
+
+	For example:
+
+	<code>
+	struct Time_Tag : Static_Field<unsigned int> {};<br>
+	struct Samples  : Static_Field<short, 128> {};<br>
+	typedef Static_Data_Block<Time_Tag, Samples> Record;<br>
+	<br>
+	Record record (buffer, Data_Block::MSB);<br>
+	unsigned int time = record.get<Time_Tag> ();<br>
+	short sample = record.get<Samples> (42);
+	</code>
+
+	As with a Data_Block the data storage area is owned by the user, not
+	the Static_Data_Block. The first element is always at offset zero;
+	the elements are contiguous.
+
+	An equivalent Data_Block, with the same data storage, structure and
+	data order, may be obtained for use with code that needs the run
+	time interface.
+
+	@param	Fields	The list of Static_Field types that describe the
+		elements of the data block, in offset order.
+	@author		Bradford Castalia, UA/PIRL
+	@see	Data_Block
+*/
+template<typename... Fields>
+class Static_Data_Block
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Element index, offset and array count values.
+typedef Data_Block::Index		Index;
+
+//!	Data order specification.
+typedef Data_Block::Data_Order	Data_Order;
+
+/*==============================================================================
+	Structure
+*/
+//!	The number of elements in the data block.
+static constexpr Index
+	ELEMENTS = sizeof... (Fields);
+
+private:
+
+static constexpr Index
+	SIZES[ELEMENTS + 1]		= {Fields::SIZE..., 0},
+	COUNTS[ELEMENTS + 1]	= {Fields::COUNT..., 0};
+
+template<typename Field, typename... List>
+struct Position
+	{static constexpr Index value = 0;};
+
+template<typename Field, typename First, typename... Rest>
+struct Position<Field, First, Rest...>
+	{
+	static constexpr Index value = std::is_same<Field, First>::value ?
+		0 : 1 + Position<Field, Rest...>::value;
+	};
+
+template<typename Field>
+static constexpr Index occurrences ()
+	{return (0 + ... + (std::is_same<Field, Fields>::value ? 1 : 0));}
+
+public:
+
+/**	Gets the offset of an element.
+
+	@param	element	The element index.
+	@return	The offset of the element from the beginning of the data
+		block. An element index of #ELEMENTS provides the
+		end-of-elements offset.
+*/
+static constexpr Index offset_of (Index element)
+	{
+	Index
+		offset = 0;
+	for (Index
+			index = 0;
+			index < element && index < ELEMENTS;
+		  ++index)
+		offset += SIZES[index];
+	return offset;
+	}
+
+/**	Gets the size of the data block.
+
+	@return	The end-of-elements offset.
+*/
+static constexpr Index size ()
+	{return offset_of (ELEMENTS);}
+
+/**	Gets the element index of a field.
+
+	@param	Field	The Static_Field type of the element.
+	@return	The index of the element.
+*/
+template<typename Field>
+static constexpr Index index_of ()
+	{
+	static_assert (occurrences<Field> () == 1,
+		"The field must occur exactly once in the Static_Data_Block.");
+	return Position<Field, Fields...>::value;
+	}
+
+/**	Gets the offset of a field.
+
+	@param	Field	The Static_Field type of the element.
+	@return	The offset of the element from the beginning of the data
+		block.
+*/
+template<typename Field>
+static constexpr Index offset_of ()
+	{return offset_of (index_of<Field> ());}
+
+/**	Gets the number of values in a field.
+
+	@param	Field	The Static_Field type of the element.
+	@return	The number of element values.
+*/
+template<typename Field>
+static constexpr Index count_of ()
+	{return Field::COUNT;}
+
+/**	Gets the list of element offsets.
+
+	@return	A vector of element offsets, including the final
+		end-of-elements offset, suitable for constructing a Data_Block.
+*/
+static Data_Block::Value_List element_offsets_list ()
+	{
+	Data_Block::Value_List
+		offsets (ELEMENTS + 1);
+	for (Index
+			element = 0;
+			element <= ELEMENTS;
+		  ++element)
+		offsets[element] = offset_of (element);
+	return offsets;
+	}
+
+/**	Gets the list of element array value counts.
+
+	@return	A vector of element array value counts suitable for
+		constructing a Data_Block.
+*/
+static Data_Block::Value_List array_counts_list ()
+	{return Data_Block::Value_List (COUNTS, COUNTS + ELEMENTS);}
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs a Static_Data_Block for a block of data.
+
+	@param	data	The address of the data block to be managed. This
+		may be NULL, in which case a data block must be
+		{@link data(void* const) provided} before any data is accessed.
+	@param	native_order	true if the data is in native host order;
+		false otherwise.
+*/
+explicit Static_Data_Block
+	(
+	void* const		data = NULL,
+	bool			native_order = true
+	)
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Native (native_order)
+	{}
+
+/**	Constructs a Static_Data_Block for a block of data having a
+	specified byte order.
+
+	@param	data	The address of the data block to be managed.
+	@param	order	A Data_Block::Data_Order value of either MSB or LSB.
+*/
+Static_Data_Block
+	(
+	void* const		data,
+	Data_Order		order
+	)
+	:	Block (reinterpret_cast<unsigned char*>(data)),
+		Native (order == Data_Block::native_order ())
+	{}
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the address of the data storage area.
+
+	@return	A pointer to the data storage block.
+*/
+unsigned char* data () const
+	{return Block;}
+
+/**	Sets the address of the data storage area.
+
+	@param	block	The address of the new data storage block.
+	@return	This Static_Data_Block.
+*/
+Static_Data_Block& data (void* const block)
+	{Block = reinterpret_cast<unsigned char*>(block); return *this;}
+
+/**	Tests if the data is specified in native order.
+
+	@return	true if the data is in native order; false otherwise.
+*/
+bool native () const
+	{return Native;}
+
+/**	Sets whether the data is in native order.
+
+	@param	native_order	true if the data is to be treated as in
+		host native data order; false otherwise.
+	@return	This Static_Data_Block.
+*/
+Static_Data_Block& native (bool native_order)
+	{Native = native_order; return *this;}
+
+/**	Gets the data ordering.
+
+	@return	A Data_Order value of either MSB or LSB.
+*/
+Data_Order data_order () const
+	{
+	return (Native == host_is_high_endian ()) ?
+		Data_Block::MSB : Data_Block::LSB;
+	}
+
+/**	Sets the data ordering.
+
+	@param	order	A Data_Order value of either MSB or LSB.
+	@return	This Static_Data_Block.
+*/
+Static_Data_Block& data_order (Data_Order order)
+	{Native = (order == Data_Block::native_order ()); return *this;}
+
+/**	Gets an equivalent Data_Block.
+
+	The Data_Block will have the same data storage area, element
+	structure and data order as this Static_Data_Block.
+
+	@return	A Data_Block.
+*/
+Data_Block data_block () const
+	{
+	return Data_Block (Block,
+		element_offsets_list (), array_counts_list (), Native);
+	}
+
+/*==============================================================================
+	I/O
+*/
+/**	Gets a field value from the data block.
+
+	<b>N.B.</b>: No limits checking is done; the array value index must
+	be less than the field's count.
+
+	@param	Field	The Static_Field type of the element.
+	@param	value	A reference to a variable that will receive the
+		value.
+	@param	index	An array element value index.
+	@return	This Static_Data_Block.
+*/
+template<typename Field>
+const Static_Data_Block&
+get
+	(
+	typename Field::Value_Type&	value,
+	const Index					index = 0
+	) const
+	{
+	value = load<Field>
+		(Block + offset_of<Field> () + (Field::VALUE_SIZE * index));
+	return *this;
+	}
+
+/**	Gets a field value from the data block.
+
+	@param	Field	The Static_Field type of the element.
+	@param	index	An array element value index.
+	@return	The field value.
+	@see	get(typename Field::Value_Type&, const Index)const
+*/
+template<typename Field>
+typename Field::Value_Type get (const Index index = 0) const
+	{
+	return load<Field>
+		(Block + offset_of<Field> () + (Field::VALUE_SIZE * index));
+	}
+
+/**	Gets the values of an array field from the data block.
+
+	@param	Field	The Static_Field type of the element.
+	@param	array	A pointer to an array of values to receive the data.
+	@param	count	The number of values to transfer. If this value is
+		0, or larger than the field count, all of the field values will
+		be transferred.
+	@return	This Static_Data_Block.
+*/
+template<typename Field>
+const Static_Data_Block&
+get
+	(
+	typename Field::Value_Type*	array,
+	Index						count = 0
+	) const
+	{
+	if (! count || count > Field::COUNT)
+		count = Field::COUNT;
+	const unsigned char
+		*source = Block + offset_of<Field> ();
+	if (Native &&
+		Field::VALUE_SIZE == sizeof (typename Field::Value_Type))
+		std::memcpy (array, source, count * Field::VALUE_SIZE);
+	else
+		while (count--)
+			{
+			*array++ = load<Field> (source);
+			source += Field::VALUE_SIZE;
+			}
+	return *this;
+	}
+
+/**	Puts a field value into the data block.
+
+	<b>N.B.</b>: No limits checking is done; the array value index must
+	be less than the field's count.
+
+	@param	Field	The Static_Field type of the element.
+	@param	value	The value to be put.
+	@param	index	An array element value index.
+	@return	This Static_Data_Block.
+*/
+template<typename Field>
+Static_Data_Block&
+put
+	(
+	const typename Field::Value_Type&	value,
+	const Index							index = 0
+	)
+	{
+	store<Field>
+		(Block + offset_of<Field> () + (Field::VALUE_SIZE * index), value);
+	return *this;
+	}
+
+/**	Puts the values of an array field into the data block.
+
+	@param	Field	The Static_Field type of the element.
+	@param	array	A pointer to an array of values to be put.
+	@param	count	The number of values to transfer. If this value is
+		0, or larger than the field count, all of the field values will
+		be transferred.
+	@return	This Static_Data_Block.
+*/
+template<typename Field>
+Static_Data_Block&
+put
+	(
+	const typename Field::Value_Type*	array,
+	Index								count = 0
+	)
+	{
+	if (! count || count > Field::COUNT)
+		count = Field::COUNT;
+	unsigned char
+		*destination = Block + offset_of<Field> ();
+	if (Native &&
+		Field::VALUE_SIZE == sizeof (typename Field::Value_Type))
+		std::memcpy (destination, array, count * Field::VALUE_SIZE);
+	else
+		while (count--)
+			{
+			store<Field> (destination, *array++);
+			destination += Field::VALUE_SIZE;
+			}
+	return *this;
+	}
+
+/*..............................................................................
+	Value movers
+*/
+private:
+
+template<typename Field>
+typename Field::Value_Type load (const unsigned char* source) const
+	{
+	typedef typename Field::Value_Type	T;
+	if constexpr (Field::VALUE_SIZE == sizeof (T))
+		{
+		T
+			value;
+		std::memcpy (&value, source, sizeof (T));
+		return Native ? value : reversed (value);
+		}
+	else
+		{
+		//	Assemble the integer value from its data order bytes.
+		const bool
+			MSB_first = (Native == host_is_high_endian ());
+		uint64_t
+			value = 0;
+		for (Index
+				count = 0;
+				count < Field::VALUE_SIZE;
+			  ++count)
+			value = (value << 8) | source
+				[MSB_first ? count : (Field::VALUE_SIZE - 1 - count)];
+		return static_cast<T>(value);
+		}
+	}
+
+template<typename Field>
+void store (unsigned char* destination, typename Field::Value_Type value)
+	{
+	typedef typename Field::Value_Type	T;
+	if constexpr (Field::VALUE_SIZE == sizeof (T))
+		{
+		if (! Native)
+			value = reversed (value);
+		std::memcpy (destination, &value, sizeof (T));
+		}
+	else
+		{
+		const bool
+			MSB_first = (Native == host_is_high_endian ());
+		uint64_t
+			bits = static_cast<uint64_t>(value);
+		for (Index
+				count = Field::VALUE_SIZE;
+				count--;
+				bits >>= 8)
+			destination
+				[MSB_first ? count : (Field::VALUE_SIZE - 1 - count)] =
+				static_cast<unsigned char>(bits);
+		}
+	}
+
+/*==============================================================================
+	Data members
+*/
+//!	Pointer to the data block storage area (may be NULL).
+unsigned char*
+	Block;
+
+//!	Data value bytes are in native host order flag.
+bool
+	Native;
+
+};	//	class Static_Data_Block
+
+}	//	namespace PIRL
+#endif
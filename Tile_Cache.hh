@@ -0,0 +1,700 @@
+/*	Tile_Cache
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Tile_Cache_
+#define _Tile_Cache_
+
+#include	"Dimensions.hh"
+#include	"Hash_Map.hh"
+#include	"Reference_Counted_Pointer.hh"
+#include	"Region.hh"
+
+#include	<cstddef>
+#include	<algorithm>
+#include	<limits>
+#include	<mutex>
+#include	<vector>
+
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Tile_Cache
+*/
+/**	A <i>Tile_Cache</i> holds decoded image tiles, keyed by their Cube
+	footprint and first band, within a memory budget.
+
+	Each tile is held by a Reference_Counted_Pointer and has a size in
+	bytes given when it is cached. When adding a tile would exceed the
+	budget the least recently used tiles are evicted. An evicted tile is
+	only released from the cache: a tile that has been handed out stays
+	alive until the last Reference_Counted_Pointer to it is destroyed,
+	and is not counted against the budget after it is evicted.
+
+	The cache is divided into a power of two number of shards, each with
+	its own lock, an equal part of the budget, a Hash_Map index and a
+	least recently used list. A tile belongs to the shard selected by
+	bits of its key hash, so lookups of different tiles from different
+	threads rarely contend for a lock. The eviction order is least
+	recently used within each shard, which approximates that order for
+	the whole cache; a tile larger than the budget of a shard is not
+	cached.
+
+	Tiles are found by their exact key, or all the cached tiles that
+	overlap an area may be {@link overlapping(const Rectangle&, Region*)
+	collected} - with the part of the area that they do not cover - so
+	only the missing parts of a requested area need to be decoded.
+
+	<code>
+	Tile_Cache<Data_Block> decoded (256 << 20);<br>
+	Tile_Cache<Data_Block>::Tile_Pointer<br>
+		&nbsp;&nbsp;&nbsp;&nbsp;block = decoded.load (tile, tile.Band, decoder);
+	</code>
+
+	<b>N.B.</b>: All operations are thread safe. Access to the tiles
+	themselves is not synchronized.
+
+	@param	T	The type of the tiles.
+	@author		Bradford Castalia, UA/PIRL
+	@see	Hash_Map
+	@see	Reference_Counted_Pointer
+*/
+template<typename T>
+class Tile_Cache
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	The type of the tiles.
+typedef T								Tile_Type;
+
+//!	A reference counted pointer to a tile.
+typedef Reference_Counted_Pointer<T>	Tile_Pointer;
+
+//!	A cached tile with its key.
+struct Entry
+{
+//!	The footprint of the tile; the Depth is the number of bands.
+Cube
+	Volume;
+
+//!	The number of the first band of the tile.
+Dimensions_Type
+	Band;
+
+//!	The tile.
+Tile_Pointer
+	Tile;
+};
+
+//!	Cache activity counts and contents.
+struct Statistics
+{
+//!	Lookups that found a tile.
+unsigned long long
+	Hits;
+
+//!	Lookups that did not find a tile.
+unsigned long long
+	Misses;
+
+//!	Tiles added to the cache.
+unsigned long long
+	Insertions;
+
+//!	Tiles evicted to stay within the budget.
+unsigned long long
+	Evictions;
+
+//!	The number of cached tiles.
+std::size_t
+	Tiles;
+
+//!	The total size, in bytes, of the cached tiles.
+std::size_t
+	Bytes;
+};
+
+/*==============================================================================
+	Constants
+*/
+//!	The default number of shards.
+static constexpr unsigned int
+	DEFAULT_SHARDS	= 16;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs an empty Tile_Cache.
+
+	@param	capacity	The memory budget, in bytes, for the cached tiles.
+	@param	shards	The number of independently locked shards. This is
+		increased to a power of two; zero selects the DEFAULT_SHARDS.
+		Each shard has an equal part of the capacity, so there should
+		be few enough shards for each part to hold many tiles.
+*/
+explicit Tile_Cache
+	(
+	std::size_t		capacity,
+	unsigned int	shards = DEFAULT_SHARDS
+	)
+	:	Capacity (capacity),
+		Shards (shard_count (shards)),
+		Shard_Capacity (capacity / shard_count (shards))
+	{}
+
+private:
+//	Copying disallowed:
+Tile_Cache (const Tile_Cache&);
+Tile_Cache& operator= (const Tile_Cache&);
+
+/*==============================================================================
+	Accessors
+*/
+public:
+/**	Gets the memory budget.
+
+	@return	The capacity, in bytes, for the cached tiles.
+*/
+std::size_t capacity () const
+	{return Capacity;}
+
+/**	Gets the number of shards.
+
+	@return	The number of independently locked shards.
+*/
+unsigned int shards () const
+	{return static_cast<unsigned int>(Shards.size ());}
+
+/**	Gets the cache statistics.
+
+	The counts of each shard are consistent; the shards are read in turn
+	so the totals are not a single snapshot while the cache is in use.
+
+	@return	The Statistics totals of all the shards.
+*/
+Statistics statistics () const
+	{
+	Statistics
+		totals = Statistics ();
+	for (std::size_t
+			index = 0;
+			index < Shards.size ();
+		  ++index)
+		{
+		const Shard&
+			shard = Shards[index];
+		std::lock_guard<std::mutex>
+			guard (shard.Lock);
+		totals.Hits			+= shard.Counts.Hits;
+		totals.Misses		+= shard.Counts.Misses;
+		totals.Insertions	+= shard.Counts.Insertions;
+		totals.Evictions	+= shard.Counts.Evictions;
+		totals.Tiles		+= shard.Index.size ();
+		totals.Bytes		+= shard.Bytes;
+		}
+	return totals;
+	}
+
+/**	Resets the activity counts of the statistics to zero.
+
+	@return	This Tile_Cache.
+*/
+Tile_Cache& reset_statistics ()
+	{
+	for (std::size_t
+			index = 0;
+			index < Shards.size ();
+		  ++index)
+		{
+		Shard&
+			shard = Shards[index];
+		std::lock_guard<std::mutex>
+			guard (shard.Lock);
+		shard.Counts = Statistics ();
+		}
+	return *this;
+	}
+
+/*==============================================================================
+	Lookup
+*/
+/**	Finds a cached tile.
+
+	A tile that is found becomes the most recently used tile of its
+	shard.
+
+	@param	volume	The footprint of the tile.
+	@param	band	The number of the first band of the tile.
+	@return	A Tile_Pointer to the tile, or a Tile_Pointer to NULL if the
+		tile is not cached.
+*/
+Tile_Pointer find
+	(
+	const Cube&		volume,
+	Dimensions_Type	band = 0
+	)
+	{
+	Key
+		key (volume, band);
+	std::size_t
+		hash = Key_Hash () (key);
+	Shard&
+		shard = shard_of (hash);
+	std::lock_guard<std::mutex>
+		guard (shard.Lock);
+	const std::size_t*
+		node = shard.Index.find (key);
+	if (! node)
+		{
+		++shard.Counts.Misses;
+		return Tile_Pointer ();
+		}
+	++shard.Counts.Hits;
+	shard.touch (*node);
+	return shard.Nodes[*node].Tile;
+	}
+
+/**	Finds a cached tile or loads it.
+
+	When the tile is not cached the loader is called, without any lock
+	held, and the tile it provides is cached. If another thread cached
+	the same tile while it was being loaded the tile already cached is
+	kept and returned.
+
+	@param	volume	The footprint of the tile.
+	@param	band	The number of the first band of the tile.
+	@param	loader	A function, or function object, that is called with
+		the volume, the band and a reference to a std::size_t. It returns
+		a Tile_Pointer to the loaded tile and sets the size of the tile,
+		in bytes. Any exception it throws is passed to the caller.
+	@return	A Tile_Pointer to the tile. This is NULL if the loader
+		provided a NULL tile, which is not cached.
+*/
+template<typename Loader>
+Tile_Pointer load
+	(
+	const Cube&		volume,
+	Dimensions_Type	band,
+	Loader			loader
+	)
+	{
+	Tile_Pointer
+		tile (find (volume, band));
+	if (! tile)
+		{
+		std::size_t
+			bytes = 0;
+		Tile_Pointer
+			loaded (loader (volume, band, bytes));
+		if (loaded)
+			tile = store (Key (volume, band), loaded, bytes, false);
+		}
+	return tile;
+	}
+
+/**	Collects the cached tiles that overlap an area.
+
+	Tiles of any bands are collected. Each tile collected becomes the
+	most recently used tile of its shard; the lookup statistics are not
+	changed.
+
+	@param	area	The Rectangle to be covered.
+	@param	uncovered	If not NULL, the Region is set to the part of the
+		area that is not covered by the collected tiles.
+	@return	The Entry of each collected tile, in order of their Volume
+		and then Band.
+*/
+std::vector<Entry> overlapping
+	(
+	const Rectangle&	area,
+	Region*				uncovered = NULL
+	)
+	{return collect (area, 0, 0, uncovered);}
+
+/**	Collects the cached tiles that overlap a volume.
+
+	A tile overlaps the volume if its footprint overlaps the volume
+	area and it has at least one of the volume bands. Each tile
+	collected becomes the most recently used tile of its shard; the
+	lookup statistics are not changed.
+
+	@param	volume	The Cube to be covered; its Depth is the number of
+		bands.
+	@param	band	The number of the first band of the volume.
+	@param	uncovered	If not NULL, the Region is set to the part of the
+		volume area that is not covered by collected tiles that have all
+		of the volume bands.
+	@return	The Entry of each collected tile, in order of their Volume
+		and then Band.
+*/
+std::vector<Entry> overlapping
+	(
+	const Cube&		volume,
+	Dimensions_Type	band,
+	Region*			uncovered = NULL
+	)
+	{return collect (volume, band, volume.Depth, uncovered);}
+
+/*==============================================================================
+	Manipulators
+*/
+/**	Caches a tile.
+
+	A tile already cached with the same key is replaced. Least recently
+	used tiles of the shard are evicted until the tile fits in its
+	budget.
+
+	@param	volume	The footprint of the tile; its Depth is the number
+		of bands.
+	@param	band	The number of the first band of the tile.
+	@param	tile	A Tile_Pointer to the tile.
+	@param	bytes	The size of the tile in bytes.
+	@return	true if the tile was cached; false if it is larger than the
+		budget of a shard.
+*/
+bool insert
+	(
+	const Cube&			volume,
+	Dimensions_Type		band,
+	const Tile_Pointer&	tile,
+	std::size_t			bytes
+	)
+	{
+	if (bytes > Shard_Capacity)
+		return false;
+	store (Key (volume, band), tile, bytes, true);
+	return true;
+	}
+
+/**	Removes a tile from the cache.
+
+	@param	volume	The footprint of the tile.
+	@param	band	The number of the first band of the tile.
+	@return	true if the tile was removed; false if it was not cached.
+*/
+bool erase
+	(
+	const Cube&		volume,
+	Dimensions_Type	band = 0
+	)
+	{
+	Key
+		key (volume, band);
+	Shard&
+		shard = shard_of (Key_Hash () (key));
+	std::lock_guard<std::mutex>
+		guard (shard.Lock);
+	const std::size_t*
+		node = shard.Index.find (key);
+	if (! node)
+		return false;
+	shard.remove (*node);
+	return true;
+	}
+
+/**	Removes all tiles from the cache.
+
+	The statistics are not changed.
+
+	@return	This Tile_Cache.
+*/
+Tile_Cache& clear ()
+	{
+	for (std::size_t
+			index = 0;
+			index < Shards.size ();
+		  ++index)
+		{
+		Shard&
+			shard = Shards[index];
+		std::lock_guard<std::mutex>
+			guard (shard.Lock);
+		while (shard.Oldest != NONE)
+			shard.remove (shard.Oldest);
+		}
+	return *this;
+	}
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+static constexpr std::size_t
+	NONE	= static_cast<std::size_t>(-1);
+
+struct Key
+{
+Cube
+	Volume;
+Dimensions_Type
+	Band;
+
+Key ()
+	:	Band (0)
+	{}
+
+Key (const Cube& volume, Dimensions_Type band)
+	:	Volume (volume),
+		Band (band)
+	{}
+
+bool operator== (const Key& key) const
+	{return Band == key.Band && Volume == key.Volume;}
+};
+
+struct Key_Hash
+{
+std::size_t operator() (const Key& key) const
+	{return static_cast<std::size_t>
+		(Hash_Mix (key.Volume.hash () * HASH_SPREAD ^ key.Band));}
+};
+
+//	A cached tile in a least recently used list.
+struct Node
+{
+Key
+	Tile_Key;
+Tile_Pointer
+	Tile;
+std::size_t
+	Bytes,
+	Newer,
+	Older;
+};
+
+struct alignas (64) Shard
+{
+mutable std::mutex
+	Lock;
+Hash_Map<Key, std::size_t, Key_Hash>
+	Index;
+//	The Index values are Nodes indices; unused Nodes are in Free.
+std::vector<Node>
+	Nodes;
+std::vector<std::size_t>
+	Free;
+std::size_t
+	Newest,
+	Oldest,
+	Bytes;
+Statistics
+	Counts;
+
+Shard ()
+	:	Newest (NONE),
+		Oldest (NONE),
+		Bytes (0),
+		Counts ()
+	{}
+
+void unlink (std::size_t node)
+	{
+	Node&
+		entry = Nodes[node];
+	if (entry.Newer == NONE)
+		Newest = entry.Older;
+	else
+		Nodes[entry.Newer].Older = entry.Older;
+	if (entry.Older == NONE)
+		Oldest = entry.Newer;
+	else
+		Nodes[entry.Older].Newer = entry.Newer;
+	}
+
+void link (std::size_t node)
+	{
+	Nodes[node].Newer = NONE;
+	Nodes[node].Older = Newest;
+	if (Newest == NONE)
+		Oldest = node;
+	else
+		Nodes[Newest].Newer = node;
+	Newest = node;
+	}
+
+void touch (std::size_t node)
+	{
+	if (node != Newest)
+		{
+		unlink (node);
+		link (node);
+		}
+	}
+
+void remove (std::size_t node)
+	{
+	unlink (node);
+	Index.erase (Nodes[node].Tile_Key);
+	Bytes -= Nodes[node].Bytes;
+	Nodes[node].Tile = Tile_Pointer ();
+	Free.push_back (node);
+	}
+};
+
+static std::size_t shard_count (unsigned int shards)
+	{
+	std::size_t
+		count = 1;
+	while (count < (shards ? shards : DEFAULT_SHARDS))
+		count <<= 1;
+	return count;
+	}
+
+//	The Hash_Map slots use the low bits of the hash; shards use others.
+Shard& shard_of (std::size_t hash)
+	{return Shards[(hash >> (std::numeric_limits<std::size_t>::digits / 2))
+		& (Shards.size () - 1)];}
+
+Tile_Pointer store
+	(
+	const Key&			key,
+	const Tile_Pointer&	tile,
+	std::size_t			bytes,
+	bool				replace
+	)
+	{
+	if (bytes > Shard_Capacity)
+		return tile;
+	Shard&
+		shard = shard_of (Key_Hash () (key));
+	std::lock_guard<std::mutex>
+		guard (shard.Lock);
+	const std::size_t*
+		found = shard.Index.find (key);
+	if (found)
+		{
+		std::size_t
+			node = *found;
+		if (! replace)
+			{
+			shard.touch (node);
+			return shard.Nodes[node].Tile;
+			}
+		shard.remove (node);
+		}
+	while (shard.Bytes + bytes > Shard_Capacity)
+		{
+		shard.remove (shard.Oldest);
+		++shard.Counts.Evictions;
+		}
+	std::size_t
+		node;
+	if (shard.Free.empty ())
+		{
+		node = shard.Nodes.size ();
+		shard.Nodes.push_back (Node ());
+		}
+	else
+		{
+		node = shard.Free.back ();
+		shard.Free.pop_back ();
+		}
+	Node&
+		entry = shard.Nodes[node];
+	entry.Tile_Key = key;
+	entry.Tile = tile;
+	entry.Bytes = bytes;
+	shard.link (node);
+	shard.Index[key] = node;
+	shard.Bytes += bytes;
+	++shard.Counts.Insertions;
+	return tile;
+	}
+
+std::vector<Entry> collect
+	(
+	const Rectangle&	area,
+	Dimensions_Type		band,
+	Dimensions_Type		bands,
+	Region*				uncovered
+	)
+	{
+	std::vector<Entry>
+		entries;
+	std::vector<Rectangle>
+		covering;
+	for (std::size_t
+			index = 0;
+			index < Shards.size ();
+		  ++index)
+		{
+		Shard&
+			shard = Shards[index];
+		std::lock_guard<std::mutex>
+			guard (shard.Lock);
+		std::vector<std::size_t>
+			found;
+		for (std::size_t
+				node = shard.Newest;
+				node != NONE;
+				node = shard.Nodes[node].Older)
+			{
+			const Key&
+				key = shard.Nodes[node].Tile_Key;
+			Rectangle
+				overlap (static_cast<const Rectangle&>(key.Volume));
+			overlap &= area;
+			if (overlap.is_empty () ||
+				(bands &&
+					(key.Band >= band + bands ||
+					 key.Band + key.Volume.Depth <= band)))
+				continue;
+			found.push_back (node);
+			Entry
+				entry = {key.Volume, key.Band, shard.Nodes[node].Tile};
+			entries.push_back (entry);
+			if (! bands ||
+				(key.Band <= band &&
+				 key.Band + key.Volume.Depth >= band + bands))
+				covering.push_back (overlap);
+			}
+		for (std::size_t
+				node = found.size ();
+				node-- > 0;)
+			shard.touch (found[node]);
+		}
+	std::sort (entries.begin (), entries.end (), entry_precedes);
+	if (uncovered)
+		*uncovered = Region (area) - Region (covering);
+	return entries;
+	}
+
+static bool entry_precedes (const Entry& first, const Entry& second)
+	{return first.Volume < second.Volume ||
+		(first.Volume == second.Volume && first.Band < second.Band);}
+
+/*==============================================================================
+	Data
+*/
+std::size_t
+	Capacity;
+
+std::vector<Shard>
+	Shards;
+
+std::size_t
+	Shard_Capacity;
+
+};	//	class Tile_Cache
+
+}	//	namespace PIRL
+#endif
@@ -0,0 +1,307 @@
+/*	Tiles
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Tiles.hh"
+using namespace PIRL;
+
+#include	<vector>
+using std::vector;
+
+#include	<utility>
+using std::pair;
+
+#include	<algorithm>
+using std::sort;
+using std::max;
+
+#include	<cstdint>
+
+#include	<sstream>
+using std::ostringstream;
+using std::endl;
+
+#include	<stdexcept>
+using std::invalid_argument;
+using std::out_of_range;
+
+#if defined (__unix__) || defined (__APPLE__)
+#include	<unistd.h>
+#endif
+
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Tiles::ID =
+		"PIRL::Tiles ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+#ifndef TILES_DEFAULT_CACHE_SIZE
+#define TILES_DEFAULT_CACHE_SIZE	262144
+#endif
+const std::size_t
+	Tiles::DEFAULT_CACHE_SIZE		= TILES_DEFAULT_CACHE_SIZE;
+
+namespace
+{
+//	Spreads the low 32 bits of a value to the even bits of the result.
+inline std::uint64_t
+spread
+	(
+	std::uint64_t	value
+	)
+{
+value &= 0xFFFFFFFFULL;
+value = (value | (value << 16)) & 0x0000FFFF0000FFFFULL;
+value = (value | (value <<  8)) & 0x00FF00FF00FF00FFULL;
+value = (value | (value <<  4)) & 0x0F0F0F0F0F0F0F0FULL;
+value = (value | (value <<  2)) & 0x3333333333333333ULL;
+value = (value | (value <<  1)) & 0x5555555555555555ULL;
+return value;
+}
+
+//	The Morton (Z order) curve distance of a grid cell.
+inline std::uint64_t
+morton
+	(
+	std::uint64_t	column,
+	std::uint64_t	row
+	)
+{return spread (column) | (spread (row) << 1);}
+
+/*	The Hilbert curve distance of a grid cell.
+
+	The side is the power of two side of the square grid that contains
+	the curve.
+*/
+std::uint64_t
+hilbert
+	(
+	std::uint64_t	side,
+	std::uint64_t	column,
+	std::uint64_t	row
+	)
+{
+std::uint64_t
+	distance = 0;
+for (std::uint64_t
+		half = side >> 1;
+		half;
+		half >>= 1)
+	{
+	std::uint64_t
+		right = (column & half) ? 1 : 0,
+		lower = (row & half) ? 1 : 0;
+	distance += half * half * ((3 * right) ^ lower);
+	if (! lower)
+		{
+		//	Rotate the quadrant.
+		if (right)
+			{
+			column = side - 1 - column;
+			row = side - 1 - row;
+			}
+		std::uint64_t
+			swap = column;
+		column = row;
+		row = swap;
+		}
+	}
+return distance;
+}
+
+}	//	local namespace
+
+/*==============================================================================
+	Constructors
+*/
+Tiles::Tiles
+	(
+	const Rectangle&	area,
+	const Size_2D&		tile_size,
+	Order				order
+	)
+	:	Area (area),
+		Tile_Size (tile_size),
+		Tile_Depth (1),
+		Traversal (order)
+{grid ();}
+
+
+Tiles::Tiles
+	(
+	const Cube&			volume,
+	const Size_2D&		tile_size,
+	Dimensions_Type		tile_depth,
+	Order				order
+	)
+	:	Area (volume),
+		Tile_Size (tile_size),
+		Tile_Depth (tile_depth ? tile_depth : volume.Depth),
+		Traversal (order)
+{grid ();}
+
+/*==============================================================================
+	Tiles
+*/
+Tiles::Tile
+Tiles::operator[]
+	(
+	size_type	position
+	) const
+{
+size_type
+	cells = static_cast<size_type>(Columns) * Rows,
+	cell = position % cells;
+if (! Cells.empty ())
+	cell = Cells[cell];
+return tile
+	(static_cast<Dimensions_Type>(cell % Columns),
+	 static_cast<Dimensions_Type>(cell / Columns),
+	 static_cast<Dimensions_Type>(position / cells));
+}
+
+
+Tiles::Tile
+Tiles::tile
+	(
+	Dimensions_Type	column,
+	Dimensions_Type	row,
+	Dimensions_Type	band
+	) const
+{
+if (column >= Columns ||
+	row >= Rows ||
+	band >= Bands)
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't get tile " << column << ',' << row << ',' << band
+				<< " of a " << Columns << 'x' << Rows << 'x' << Bands
+				<< " tile grid.";
+	throw out_of_range (message.str ());
+	}
+Dimensions_Type
+	first_band = band * Tile_Depth;
+Cube
+	piece
+		(static_cast<Coordinate_Type>
+			(Area.X + static_cast<long long>(column) * Tile_Size.Width),
+		 static_cast<Coordinate_Type>
+			(Area.Y + static_cast<long long>(row) * Tile_Size.Height),
+		 Tile_Size.Width, Tile_Size.Height, Tile_Depth),
+	remaining
+		(Area.X, Area.Y, Area.Width, Area.Height, Area.Depth - first_band);
+piece &= remaining;
+return Tile (piece, first_band);
+}
+
+/*==============================================================================
+	Tile size
+*/
+Size_2D
+Tiles::suggested_size
+	(
+	std::size_t		pixel_bytes,
+	std::size_t		cache_size,
+	Dimensions_Type	depth
+	)
+{
+if (! cache_size)
+	{
+	#if defined (_SC_LEVEL2_CACHE_SIZE)
+	long
+		level_2 = sysconf (_SC_LEVEL2_CACHE_SIZE);
+	if (level_2 > 0)
+		cache_size = static_cast<std::size_t>(level_2);
+	else
+	#endif
+		cache_size = DEFAULT_CACHE_SIZE;
+	}
+std::size_t
+	pixels = (cache_size / 2)
+		/ (max (pixel_bytes, std::size_t (1))
+			* max (depth, Dimensions_Type (1)));
+Dimensions_Type
+	side = 1;
+while (static_cast<std::size_t>(side) * 2 * side * 2 <= pixels &&
+		side < (Dimensions_Type (1) << 15))
+	side *= 2;
+return Size_2D (side);
+}
+
+/*==============================================================================
+	Helpers
+*/
+void
+Tiles::grid ()
+{
+if (Tile_Size.is_empty ())
+	{
+	ostringstream
+		message;
+	message << ID << endl
+			<< "Can't tile with an empty " << Tile_Size << " tile size.";
+	throw invalid_argument (message.str ());
+	}
+if (Area.is_empty ())
+	{
+	Columns =
+	Rows =
+	Bands = 0;
+	return;
+	}
+Columns = Area.Width  / Tile_Size.Width  + (Area.Width  % Tile_Size.Width  ? 1 : 0);
+Rows    = Area.Height / Tile_Size.Height + (Area.Height % Tile_Size.Height ? 1 : 0);
+Bands   = Area.Depth  / Tile_Depth       + (Area.Depth  % Tile_Depth       ? 1 : 0);
+
+Cells.clear ();
+if (Traversal == ROW_MAJOR ||
+	(Columns == 1 && Rows == 1))
+	return;
+
+//	Sort the grid cells by their distance along the curve.
+std::uint64_t
+	side = 1;
+while (side < Columns ||
+	   side < Rows)
+	side <<= 1;
+vector<pair<std::uint64_t, size_type> >
+	keys;
+keys.reserve (static_cast<size_type>(Columns) * Rows);
+for (Dimensions_Type
+		row = 0;
+		row < Rows;
+	  ++row)
+	for (Dimensions_Type
+			column = 0;
+			column < Columns;
+		  ++column)
+		keys.push_back (pair<std::uint64_t, size_type>
+			((Traversal == MORTON) ?
+				morton (column, row) : hilbert (side, column, row),
+			 static_cast<size_type>(row) * Columns + column));
+sort (keys.begin (), keys.end ());
+Cells.resize (keys.size ());
+for (size_type
+		cell = 0;
+		cell < keys.size ();
+	  ++cell)
+	Cells[cell] = keys[cell].second;
+}
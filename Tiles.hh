@@ -0,0 +1,389 @@
+/*	Tiles
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Tiles_
+#define _Tiles_
+
+#include	"Dimensions.hh"
+
+#include	<cstddef>
+#include	<iterator>
+#include	<vector>
+
+
+namespace PIRL
+{
+/*=****************************************************************************
+	Tiles
+*/
+/**	<i>Tiles</i> decomposes a Rectangle or Cube into a sequence of tiles.
+
+	The area is divided into a grid of tiles of a fixed Size_2D starting
+	at the area position; a Cube is also divided into bands of a fixed
+	depth. The tiles at the right, bottom and last band edges are
+	clipped - using the Cube intersection operator - to the area, so
+	every element of the area is in exactly one tile.
+
+	The tiles of each band are visited in a traversal Order:
+	ROW_MAJOR visits the tiles across each row of the grid; MORTON (Z
+	order) and HILBERT visit the tiles along a space filling curve so
+	that successive tiles are near each other, which improves the cache
+	locality of processing that reads the neighbors of a tile. The bands
+	are visited in increasing order.
+
+	The Tiles are a random access sequence: the tile at any position in
+	the traversal order is obtained in constant time, so a parallel loop
+	can partition the sequence by position:
+
+	<code>
+	Tiles tiles (image, Tiles::suggested_size (sizeof (float)),
+		Tiles::HILBERT);<br>
+	parallel_for (tiles.size (), 1, threads,<br>
+		[&tiles] (unsigned int, std::size_t first, std::size_t end)<br>
+		{for (std::size_t index = first; index < end; ++index)<br>
+			process (tiles[index]);});
+	</code>
+
+	@author		Bradford Castalia, UA/PIRL
+	@see	Cube
+*/
+class Tiles
+{
+public:
+/*==============================================================================
+	Types
+*/
+//!	Tile sequence position.
+typedef std::size_t		size_type;
+
+/**	A <i>Tile</i> is a Cube in the tiled area with the number of its
+	first band.
+
+	The Depth of the tile is the number of bands it contains.
+*/
+struct Tile
+:	public Cube
+{
+//!	The number of the first band of the tile.
+Dimensions_Type
+	Band;
+
+//!	Constructs an empty Tile.
+Tile ()
+	:	Band (0)
+	{}
+
+/**	Constructs a Tile from a Cube and the number of its first band.
+
+	@param	cube	The Cube of the tile.
+	@param	band	The number of the first band of the tile.
+*/
+Tile (const Cube& cube, Dimensions_Type band)
+	:	Cube (cube),
+		Band (band)
+	{}
+};
+
+//!	Tile traversal order.
+enum Order
+	{
+	ROW_MAJOR,
+	MORTON,
+	HILBERT
+	};
+
+/**	A <i>const_iterator</i> steps through the Tiles.
+
+	The iterator produces each Tile by value, so it is an input
+	iterator, though it may also be moved by any offset.
+*/
+class const_iterator
+{
+public:
+typedef std::input_iterator_tag	iterator_category;
+typedef Tile					value_type;
+typedef std::ptrdiff_t			difference_type;
+typedef const Tile*				pointer;
+typedef Tile					reference;
+
+const_iterator ()
+	:	Source (NULL),
+		Position (0)
+	{}
+
+const_iterator (const Tiles* tiles, size_type position)
+	:	Source (tiles),
+		Position (position)
+	{}
+
+Tile operator* () const
+	{return (*Source)[Position];}
+Tile operator[] (difference_type offset) const
+	{return (*Source)[Position + offset];}
+
+const_iterator& operator++ ()
+	{++Position; return *this;}
+const_iterator operator++ (int)
+	{const_iterator iterator (*this); ++Position; return iterator;}
+const_iterator& operator-- ()
+	{--Position; return *this;}
+const_iterator operator-- (int)
+	{const_iterator iterator (*this); --Position; return iterator;}
+const_iterator& operator+= (difference_type offset)
+	{Position += offset; return *this;}
+const_iterator& operator-= (difference_type offset)
+	{Position -= offset; return *this;}
+const_iterator operator+ (difference_type offset) const
+	{return const_iterator (Source, Position + offset);}
+friend const_iterator operator+
+	(difference_type offset, const const_iterator& iterator)
+	{return iterator + offset;}
+const_iterator operator- (difference_type offset) const
+	{return const_iterator (Source, Position - offset);}
+difference_type operator- (const const_iterator& iterator) const
+	{return difference_type (Position) - difference_type (iterator.Position);}
+
+bool operator== (const const_iterator& iterator) const
+	{return Position == iterator.Position && Source == iterator.Source;}
+bool operator!= (const const_iterator& iterator) const
+	{return ! (*this == iterator);}
+bool operator< (const const_iterator& iterator) const
+	{return Position < iterator.Position;}
+bool operator> (const const_iterator& iterator) const
+	{return Position > iterator.Position;}
+bool operator<= (const const_iterator& iterator) const
+	{return Position <= iterator.Position;}
+bool operator>= (const const_iterator& iterator) const
+	{return Position >= iterator.Position;}
+
+private:
+const Tiles
+	*Source;
+size_type
+	Position;
+};
+
+/*==============================================================================
+	Constants
+*/
+//!	Class identification name with source code version and date.
+static const char* const
+	ID;
+
+/**	The cache size, in bytes, used to suggest a tile size when the
+	size of the level 2 cache can not be determined.
+
+	This is the value of the TILES_DEFAULT_CACHE_SIZE macro, which may
+	be defined when the library is built; the default is 256 KiB.
+*/
+static const std::size_t
+	DEFAULT_CACHE_SIZE;
+
+/*==============================================================================
+	Constructors
+*/
+/**	Constructs Tiles for a Rectangle.
+
+	Each tile has a Depth of one band.
+
+	@param	area	The Rectangle to be tiled.
+	@param	tile_size	The size of each tile.
+	@param	order	The traversal Order of the tiles.
+	@throws	std::invalid_argument	If the tile size is empty.
+*/
+Tiles
+	(
+	const Rectangle&	area,
+	const Size_2D&		tile_size,
+	Order				order = ROW_MAJOR
+	);
+
+/**	Constructs Tiles for a Cube.
+
+	@param	volume	The Cube to be tiled.
+	@param	tile_size	The size of each tile.
+	@param	tile_depth	The number of bands in each tile. If zero all
+		the bands of the volume are in each tile.
+	@param	order	The traversal Order of the tiles in each band.
+	@throws	std::invalid_argument	If the tile size is empty.
+*/
+Tiles
+	(
+	const Cube&			volume,
+	const Size_2D&		tile_size,
+	Dimensions_Type		tile_depth = 0,
+	Order				order = ROW_MAJOR
+	);
+
+/*==============================================================================
+	Accessors
+*/
+/**	Gets the tiled area.
+
+	@return	The Cube that is tiled. For a Rectangle the Depth is one.
+*/
+const Cube& area () const
+	{return Area;}
+
+/**	Gets the tile size.
+
+	@return	The Size_2D of the unclipped tiles.
+*/
+const Size_2D& tile_size () const
+	{return Tile_Size;}
+
+/**	Gets the tile depth.
+
+	@return	The number of bands of the unclipped tiles.
+*/
+Dimensions_Type tile_depth () const
+	{return Tile_Depth;}
+
+/**	Gets the traversal order.
+
+	@return	The Order of the tiles in each band.
+*/
+Order order () const
+	{return Traversal;}
+
+/**	Gets the number of tile columns.
+
+	@return	The number of tiles across the area.
+*/
+Dimensions_Type columns () const
+	{return Columns;}
+
+/**	Gets the number of tile rows.
+
+	@return	The number of tiles down the area.
+*/
+Dimensions_Type rows () const
+	{return Rows;}
+
+/**	Gets the number of tile bands.
+
+	@return	The number of tiles through the depth of the area.
+*/
+Dimensions_Type bands () const
+	{return Bands;}
+
+/**	Gets the number of tiles.
+
+	@return	The number of tiles. This is zero if the area is empty.
+*/
+size_type size () const
+	{return static_cast<size_type>(Columns) * Rows * Bands;}
+
+/**	Tests if there are no tiles.
+
+	@return	true if the size is zero; false otherwise.
+*/
+bool empty () const
+	{return ! size ();}
+
+/*==============================================================================
+	Tiles
+*/
+/**	Gets a tile.
+
+	@param	position	The position of the tile in the traversal order.
+		This must be less than the {@link size() size}.
+	@return	The Tile, clipped to the area.
+*/
+Tile operator[] (size_type position) const;
+
+/**	Gets a tile at a grid location.
+
+	@param	column	The grid column of the tile.
+	@param	row		The grid row of the tile.
+	@param	band	The grid band of the tile.
+	@return	The Tile, clipped to the area.
+	@throws	std::out_of_range	If the location is not in the grid.
+*/
+Tile tile
+	(
+	Dimensions_Type	column,
+	Dimensions_Type	row,
+	Dimensions_Type	band = 0
+	) const;
+
+//!	Gets an iterator at the first tile.
+const_iterator begin () const
+	{return const_iterator (this, 0);}
+
+//!	Gets an iterator after the last tile.
+const_iterator end () const
+	{return const_iterator (this, size ());}
+
+/*==============================================================================
+	Tile size
+*/
+/**	Suggests a tile size that fits in the level 2 cache.
+
+	The suggested tile is square with a side that is a power of two -
+	which suits the MORTON and HILBERT orders - such that a tile of
+	pixels occupies no more than half of the cache; the other half is
+	left for the output of the processing and its other data.
+
+	@param	pixel_bytes	The number of bytes of each pixel of one band.
+	@param	cache_size	The number of cache bytes. If zero the size of
+		the level 2 cache of the host system is used, or the
+		DEFAULT_CACHE_SIZE if that can not be determined.
+	@param	depth	The number of bands in each tile.
+	@return	The suggested Size_2D. This is at least 1x1.
+*/
+static Size_2D suggested_size
+	(
+	std::size_t		pixel_bytes,
+	std::size_t		cache_size = 0,
+	Dimensions_Type	depth = 1
+	);
+
+/*==============================================================================
+	Helpers
+*/
+private:
+
+void grid ();
+
+/*==============================================================================
+	Data
+*/
+Cube
+	Area;
+Size_2D
+	Tile_Size;
+Dimensions_Type
+	Tile_Depth;
+Order
+	Traversal;
+
+Dimensions_Type
+	Columns,
+	Rows,
+	Bands;
+
+//	Grid cell indices (row * Columns + column) in traversal order.
+std::vector<size_type>
+	Cells;
+
+};	//	class Tiles
+
+}	//	namespace PIRL
+#endif
@@ -0,0 +1,542 @@
+/*	Value_Conversion - Converts non-IEEE floating point data.
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#include	"Value_Conversion.hh"
+
+#include	<cstring>
+using std::memcpy;
+
+#include	<cfloat>
+#include	<stdint.h>
+
+namespace PIRL
+{
+/*==============================================================================
+	Constants:
+*/
+const char* const
+	Value_Conversion_ID =
+		"PIRL::Value_Conversion ($Revision: 1.1 $ $Date: 2026/10/18 $)";
+
+/*==============================================================================
+	Helpers
+*/
+/*..............................................................................
+	Host value bits.
+*/
+static inline uint32_t
+float_bits (float value)
+{
+uint32_t
+	bits;
+memcpy (&bits, &value, sizeof (bits));
+return bits;
+}
+
+static inline float
+bits_float (uint32_t bits)
+{
+float
+	value;
+memcpy (&value, &bits, sizeof (value));
+return value;
+}
+
+static inline uint64_t
+double_bits (double value)
+{
+uint64_t
+	bits;
+memcpy (&bits, &value, sizeof (bits));
+return bits;
+}
+
+static inline double
+bits_double (uint64_t bits)
+{
+double
+	value;
+memcpy (&value, &bits, sizeof (value));
+return value;
+}
+
+/*..............................................................................
+	Encoded data bytes.
+
+	The data bytes are assembled into, and disassembled from, host words
+	so the host byte order is irrelevant.
+*/
+//	VAX: little-endian 16-bit words, most significant word first.
+static inline uint32_t
+VAX_bits_32 (const unsigned char* data)
+{
+return
+	((uint32_t)data[1] << 24) |
+	((uint32_t)data[0] << 16) |
+	((uint32_t)data[3] << 8)  |
+	 (uint32_t)data[2];
+}
+
+static inline uint64_t
+VAX_bits_64 (const unsigned char* data)
+{return ((uint64_t)VAX_bits_32 (data) << 32) | VAX_bits_32 (data + 4);}
+
+static inline void
+VAX_data_32 (uint32_t bits, unsigned char* data)
+{
+data[0] = (unsigned char)(bits >> 16);
+data[1] = (unsigned char)(bits >> 24);
+data[2] = (unsigned char)(bits);
+data[3] = (unsigned char)(bits >> 8);
+}
+
+static inline void
+VAX_data_64 (uint64_t bits, unsigned char* data)
+{
+VAX_data_32 ((uint32_t)(bits >> 32), data);
+VAX_data_32 ((uint32_t)bits, data + 4);
+}
+
+//	IBM: big-endian.
+static inline uint32_t
+IBM_bits_32 (const unsigned char* data)
+{
+return
+	((uint32_t)data[0] << 24) |
+	((uint32_t)data[1] << 16) |
+	((uint32_t)data[2] << 8)  |
+	 (uint32_t)data[3];
+}
+
+static inline uint64_t
+IBM_bits_64 (const unsigned char* data)
+{return ((uint64_t)IBM_bits_32 (data) << 32) | IBM_bits_32 (data + 4);}
+
+static inline void
+IBM_data_32 (uint32_t bits, unsigned char* data)
+{
+data[0] = (unsigned char)(bits >> 24);
+data[1] = (unsigned char)(bits >> 16);
+data[2] = (unsigned char)(bits >> 8);
+data[3] = (unsigned char)(bits);
+}
+
+static inline void
+IBM_data_64 (uint64_t bits, unsigned char* data)
+{
+IBM_data_32 ((uint32_t)(bits >> 32), data);
+IBM_data_32 ((uint32_t)bits, data + 4);
+}
+
+/*..............................................................................
+	Encoding conversions.
+
+	Each computes every alternative result and selects one with bit
+	masks rather than branches so the batch loops that use them can be
+	vectorized.
+*/
+//	All bits set if the condition is true; no bits set otherwise.
+static inline uint32_t
+mask_32 (bool condition)
+{return (uint32_t)0 - (uint32_t)condition;}
+
+static inline uint64_t
+mask_64 (bool condition)
+{return (uint64_t)0 - (uint64_t)condition;}
+
+/*
+	The VAX F-floating fields are laid out like the IEEE single precision
+	fields, but the exponent bias is 128 and the hidden bit is to the
+	right of the binary point: the VAX value is the IEEE interpretation
+	of the same bits times 2**-2. Decrementing the exponent field by 2
+	is exact except for the smallest exponents which produce IEEE
+	denormals.
+*/
+static inline float
+VAX_F_to_float (uint32_t bits)
+{
+uint32_t
+	exponent = (bits >> 23) & 0xFF,
+	normal = bits - 0x01000000,
+	small = float_bits (bits_float (bits) * 0.25f);
+return bits_float
+	((normal & mask_32 (exponent > 2)) |
+	 (small  & mask_32 (exponent - 1 < 2)));
+}
+
+static inline uint32_t
+float_to_VAX_F (float value)
+{
+uint32_t
+	bits = float_bits (value),
+	sign = bits & 0x80000000,
+	exponent = (bits >> 23) & 0xFF,
+	//	IEEE denormals are partly within the VAX range.
+	scaled = float_bits (value * 4.0f),
+	small = scaled & mask_32 ((scaled & 0x7F800000) != 0),
+	normal = bits + 0x01000000,
+	overflow = sign | 0x7FFFFFFF;
+return
+	(overflow & mask_32 (exponent >= 254)) |
+	(normal   & mask_32 (exponent - 1 < 253)) |
+	(small    & mask_32 (exponent == 0));
+}
+
+/*
+	The VAX D-floating exponent is 8 bits with a bias of 128 and a
+	hidden bit to the right of the binary point; the fraction is 55
+	bits. The IEEE double exponent bias is 1023, so the exponent field
+	is offset by 1023 - 128 - 1 = 894. The fraction is rounded to 52
+	bits, with any carry propagating into the exponent.
+*/
+static inline double
+VAX_D_to_double (uint64_t bits)
+{
+uint64_t
+	exponent = (bits >> 55) & 0xFF,
+	ieee = (bits & 0x8000000000000000ULL) |
+		(((exponent + 894) << 52) +
+		 (((bits & 0x007FFFFFFFFFFFFFULL) + 4) >> 3));
+return bits_double (ieee & mask_64 (exponent != 0));
+}
+
+static inline uint64_t
+double_to_VAX_D (double value)
+{
+uint64_t
+	bits = double_bits (value),
+	sign = bits & 0x8000000000000000ULL,
+	//	Offset so that the VAX exponent range is 1-255.
+	exponent = ((bits >> 52) & 0x7FF) - 894,
+	normal = sign | (exponent << 55) |
+		((bits & 0x000FFFFFFFFFFFFFULL) << 3),
+	overflow = sign | 0x7FFFFFFFFFFFFFFFULL;
+return
+	(overflow & mask_64 ((int64_t)exponent > 255)) |
+	(normal   & mask_64 (exponent - 1 < 255));
+}
+
+/*
+	An IBM value is its fraction, taken as an integer, times
+	16**(exponent - 64) * 2**-fraction_bits. The power of 2 scale is
+	constructed directly as the bits of an IEEE double.
+*/
+static inline double
+IBM_single_to_double (uint32_t bits)
+{
+double
+	scale = bits_double
+		((uint64_t)(((bits >> 24) & 0x7F) * 4 + 743) << 52),
+	magnitude = (double)(int32_t)(bits & 0x00FFFFFF) * scale;
+return bits_double
+	(double_bits (magnitude) | ((uint64_t)(bits & 0x80000000) << 32));
+}
+
+static inline float
+IBM_single_to_float (uint32_t bits)
+{
+double
+	value = IBM_single_to_double (bits);
+value = value >  FLT_MAX ?  FLT_MAX : value;
+value = value < -FLT_MAX ? -FLT_MAX : value;
+return (float)value;
+}
+
+static inline double
+IBM_double_to_double (uint64_t bits)
+{
+double
+	scale = bits_double ((((bits >> 56) & 0x7F) * 4 + 711) << 52),
+	magnitude =
+		(double)(int64_t)(bits & 0x00FFFFFFFFFFFFFFULL) * scale;
+return bits_double
+	(double_bits (magnitude) | (bits & 0x8000000000000000ULL));
+}
+
+/*
+	The IEEE value is (fraction / 2**fraction_bits) * 2**power. The
+	base 16 exponent is the power rounded up to a multiple of 4, and the
+	fraction is shifted right by the difference (0-3 bits).
+*/
+static inline uint32_t
+float_to_IBM_single (float value)
+{
+uint32_t
+	bits = float_bits (value),
+	sign = bits & 0x80000000,
+	exponent = (bits >> 23) & 0xFF,
+	fraction = (bits & 0x007FFFFF) | (mask_32 (exponent != 0) & 0x00800000);
+int32_t
+	power = (int32_t)(exponent + (exponent == 0)) - 126,
+	hex = (power + 131) / 4 - 32,
+	shift = hex * 4 - power;
+fraction = (fraction + ((1U << shift) >> 1)) >> shift;
+return
+	((sign | 0x7FFFFFFF) & mask_32 (exponent == 255)) |
+	((sign | ((uint32_t)(hex + 64) << 24) | fraction) &
+		mask_32 (exponent != 255 && fraction != 0));
+}
+
+static inline uint64_t
+double_to_IBM_double (double value)
+{
+uint64_t
+	bits = double_bits (value),
+	sign = bits & 0x8000000000000000ULL,
+	exponent = (bits >> 52) & 0x7FF,
+	fraction = (bits & 0x000FFFFFFFFFFFFFULL) | 0x0010000000000000ULL;
+int64_t
+	power = (int64_t)exponent - 1022,
+	hex = (power + 1027) / 4 - 256,
+	shift = hex * 4 - power,
+	ibm_exponent = hex + 64;
+fraction <<= 3 - shift;
+return
+	((sign | 0x7FFFFFFFFFFFFFFFULL) & mask_64 (ibm_exponent > 127)) |
+	((sign | ((uint64_t)ibm_exponent << 56) | fraction) &
+		mask_64 (exponent != 0 && ibm_exponent >= 0 && ibm_exponent <= 127));
+}
+
+/*..............................................................................
+	Batch loops.
+*/
+/*
+	When the encoded values are contiguous the stride is the constant
+	value size, which allows the compiler to vectorize the loop.
+*/
+template<std::size_t Size, typename Value,
+	Value (*Convert)(const unsigned char*)>
+static inline void
+decode
+	(
+	const unsigned char*	data,
+	Value*					values,
+	std::size_t				count,
+	std::size_t				stride
+	)
+{
+std::size_t
+	index;
+if (stride == Size)
+	for (index = 0;
+		 index < count;
+	   ++index)
+		values[index] = Convert (data + index * Size);
+else
+	for (index = 0;
+		 index < count;
+	   ++index)
+		values[index] = Convert (data + index * stride);
+}
+
+
+template<std::size_t Size, typename Value,
+	void (*Convert)(Value, unsigned char*)>
+static inline void
+encode
+	(
+	const Value*	values,
+	unsigned char*	data,
+	std::size_t		count,
+	std::size_t		stride
+	)
+{
+std::size_t
+	index;
+if (stride == Size)
+	for (index = 0;
+		 index < count;
+	   ++index)
+		Convert (values[index], data + index * Size);
+else
+	for (index = 0;
+		 index < count;
+	   ++index)
+		Convert (values[index], data + index * stride);
+}
+
+/*==============================================================================
+	Single values
+*/
+float
+VAX_real_to_IEEE
+	(
+	const unsigned char*	data
+	)
+{return VAX_F_to_float (VAX_bits_32 (data));}
+
+
+double
+VAX_double_to_IEEE
+	(
+	const unsigned char*	data
+	)
+{return VAX_D_to_double (VAX_bits_64 (data));}
+
+
+float
+IBM_real_to_IEEE
+	(
+	const unsigned char*	data
+	)
+{return IBM_single_to_float (IBM_bits_32 (data));}
+
+
+double
+IBM_double_to_IEEE
+	(
+	const unsigned char*	data
+	)
+{return IBM_double_to_double (IBM_bits_64 (data));}
+
+
+void
+IEEE_to_VAX_real
+	(
+	float			value,
+	unsigned char*	data
+	)
+{VAX_data_32 (float_to_VAX_F (value), data);}
+
+
+void
+IEEE_to_VAX_double
+	(
+	double			value,
+	unsigned char*	data
+	)
+{VAX_data_64 (double_to_VAX_D (value), data);}
+
+
+void
+IEEE_to_IBM_real
+	(
+	float			value,
+	unsigned char*	data
+	)
+{IBM_data_32 (float_to_IBM_single (value), data);}
+
+
+void
+IEEE_to_IBM_double
+	(
+	double			value,
+	unsigned char*	data
+	)
+{IBM_data_64 (double_to_IBM_double (value), data);}
+
+/*==============================================================================
+	Batch conversion
+*/
+void
+VAX_real_to_IEEE
+	(
+	const unsigned char*	data,
+	float*					values,
+	std::size_t				count,
+	std::size_t				stride
+	)
+{decode<REAL_VALUE_SIZE, float, VAX_real_to_IEEE>
+	(data, values, count, stride);}
+
+
+void
+VAX_double_to_IEEE
+	(
+	const unsigned char*	data,
+	double*					values,
+	std::size_t				count,
+	std::size_t				stride
+	)
+{decode<DOUBLE_VALUE_SIZE, double, VAX_double_to_IEEE>
+	(data, values, count, stride);}
+
+
+void
+IBM_real_to_IEEE
+	(
+	const unsigned char*	data,
+	float*					values,
+	std::size_t				count,
+	std::size_t				stride
+	)
+{decode<REAL_VALUE_SIZE, float, IBM_real_to_IEEE>
+	(data, values, count, stride);}
+
+
+void
+IBM_double_to_IEEE
+	(
+	const unsigned char*	data,
+	double*					values,
+	std::size_t				count,
+	std::size_t				stride
+	)
+{decode<DOUBLE_VALUE_SIZE, double, IBM_double_to_IEEE>
+	(data, values, count, stride);}
+
+
+void
+IEEE_to_VAX_real
+	(
+	const float*	values,
+	unsigned char*	data,
+	std::size_t		count,
+	std::size_t		stride
+	)
+{encode<REAL_VALUE_SIZE, float, IEEE_to_VAX_real>
+	(values, data, count, stride);}
+
+
+void
+IEEE_to_VAX_double
+	(
+	const double*	values,
+	unsigned char*	data,
+	std::size_t		count,
+	std::size_t		stride
+	)
+{encode<DOUBLE_VALUE_SIZE, double, IEEE_to_VAX_double>
+	(values, data, count, stride);}
+
+
+void
+IEEE_to_IBM_real
+	(
+	const float*	values,
+	unsigned char*	data,
+	std::size_t		count,
+	std::size_t		stride
+	)
+{encode<REAL_VALUE_SIZE, float, IEEE_to_IBM_real>
+	(values, data, count, stride);}
+
+
+void
+IEEE_to_IBM_double
+	(
+	const double*	values,
+	unsigned char*	data,
+	std::size_t		count,
+	std::size_t		stride
+	)
+{encode<DOUBLE_VALUE_SIZE, double, IEEE_to_IBM_double>
+	(values, data, count, stride);}
+
+}	//	namespace PIRL
@@ -0,0 +1,718 @@
+/*	Value_Conversion - Converts non-IEEE floating point data.
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the
+Planetary Image Research Laboratory, Lunar and Planetary Laboratory at
+the University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+#ifndef _Value_Conversion_
+#define _Value_Conversion_
+
+#include	"endian.hh"
+
+#include	<cstddef>
+#include	<cstring>
+#include	<stdint.h>
+#include	<limits>
+#include	<type_traits>
+
+namespace PIRL
+{
+/*=*****************************************************************************
+	Value_Conversion
+*/
+/**	Conversion between host values and the data value encodings of
+	binary data blocks.
+
+	<h4>Floating point</h4>
+
+	The VAX and IBM floating point data encodings are converted to and
+	from IEEE 754 host values.
+
+	The encoded data are sequences of bytes in the order defined by
+	each encoding, independent of the host system byte order:
+
+<dl>
+<dt>VAX real
+	<dd>VAX F-floating; 4 bytes, two little-endian 16-bit words with
+	the sign, 8-bit excess-128 exponent and high fraction bits in the
+	first word.
+<dt>VAX double
+	<dd>VAX D-floating; 8 bytes, four little-endian 16-bit words with
+	the sign, 8-bit excess-128 exponent and high fraction bits in the
+	first word.
+<dt>IBM real
+	<dd>IBM System/360 single precision hexadecimal floating point; 4
+	big-endian bytes with the sign, 7-bit excess-64 base 16 exponent and
+	24-bit fraction.
+<dt>IBM double
+	<dd>IBM System/360 double precision hexadecimal floating point; 8
+	big-endian bytes with the sign, 7-bit excess-64 base 16 exponent and
+	56-bit fraction.
+</dl>
+
+	Values that can not be represented in the destination encoding are
+	clamped: overflow produces the largest magnitude value of the same
+	sign, and underflow produces zero. IEEE infinities and NaNs are
+	treated as overflow. VAX reserved operands (negative zero) are
+	converted to zero.
+
+	The batch conversions process a column of values that may be
+	interleaved with other data - such as a field of successive
+	fixed length records - by specifying the stride between encoded
+	values. Their loops are written as branch-free bit manipulation of
+	whole words so that an optimizing compiler can vectorize them for
+	the host SIMD instruction set. This is most effective for contiguous
+	values, where the stride is the value size.
+
+	@author		Bradford Castalia, UA/PIRL
+*/
+
+//!	Value_Conversion identification name with source code version and date.
+extern const char* const
+	Value_Conversion_ID;
+
+//!	The size, in bytes, of a VAX real and IBM real value.
+const std::size_t
+	REAL_VALUE_SIZE		= 4;
+//!	The size, in bytes, of a VAX double and IBM double value.
+const std::size_t
+	DOUBLE_VALUE_SIZE	= 8;
+
+/*==============================================================================
+	Single values
+*/
+/**	Converts a VAX real value to IEEE.
+
+	@param	data	A pointer to the first of 4 bytes of VAX F-floating
+		data.
+	@return	The IEEE float value.
+*/
+float VAX_real_to_IEEE (const unsigned char* data);
+
+/**	Converts a VAX double value to IEEE.
+
+	The 55-bit VAX fraction is rounded to the 52-bit IEEE fraction.
+
+	@param	data	A pointer to the first of 8 bytes of VAX D-floating
+		data.
+	@return	The IEEE double value.
+*/
+double VAX_double_to_IEEE (const unsigned char* data);
+
+/**	Converts an IBM real value to IEEE.
+
+	@param	data	A pointer to the first of 4 bytes of IBM single
+		precision data.
+	@return	The IEEE float value.
+*/
+float IBM_real_to_IEEE (const unsigned char* data);
+
+/**	Converts an IBM double value to IEEE.
+
+	The 56-bit IBM fraction is rounded to the IEEE precision.
+
+	@param	data	A pointer to the first of 8 bytes of IBM double
+		precision data.
+	@return	The IEEE double value.
+*/
+double IBM_double_to_IEEE (const unsigned char* data);
+
+/**	Converts an IEEE value to VAX real.
+
+	@param	value	The IEEE float value.
+	@param	data	A pointer to storage for 4 bytes of VAX F-floating
+		data.
+*/
+void IEEE_to_VAX_real (float value, unsigned char* data);
+
+/**	Converts an IEEE value to VAX double.
+
+	@param	value	The IEEE double value.
+	@param	data	A pointer to storage for 8 bytes of VAX D-floating
+		data.
+*/
+void IEEE_to_VAX_double (double value, unsigned char* data);
+
+/**	Converts an IEEE value to IBM real.
+
+	@param	value	The IEEE float value.
+	@param	data	A pointer to storage for 4 bytes of IBM single
+		precision data.
+*/
+void IEEE_to_IBM_real (float value, unsigned char* data);
+
+/**	Converts an IEEE value to IBM double.
+
+	@param	value	The IEEE double value.
+	@param	data	A pointer to storage for 8 bytes of IBM double
+		precision data.
+*/
+void IEEE_to_IBM_double (double value, unsigned char* data);
+
+/*==============================================================================
+	Batch conversion
+*/
+/**	Converts a column of VAX real values to IEEE.
+
+	@param	data	A pointer to the first byte of the first encoded
+		value.
+	@param	values	A pointer to an array of at least count values that
+		will receive the converted values.
+	@param	count	The number of values to convert.
+	@param	stride	The number of bytes from the start of one encoded
+		value to the start of the next.
+*/
+void VAX_real_to_IEEE (const unsigned char* data, float* values,
+	std::size_t count, std::size_t stride = REAL_VALUE_SIZE);
+
+/**	Converts a column of VAX double values to IEEE.
+
+	@see VAX_real_to_IEEE(const unsigned char*, float*, std::size_t, std::size_t)
+*/
+void VAX_double_to_IEEE (const unsigned char* data, double* values,
+	std::size_t count, std::size_t stride = DOUBLE_VALUE_SIZE);
+
+/**	Converts a column of IBM real values to IEEE.
+
+	@see VAX_real_to_IEEE(const unsigned char*, float*, std::size_t, std::size_t)
+*/
+void IBM_real_to_IEEE (const unsigned char* data, float* values,
+	std::size_t count, std::size_t stride = REAL_VALUE_SIZE);
+
+/**	Converts a column of IBM double values to IEEE.
+
+	@see VAX_real_to_IEEE(const unsigned char*, float*, std::size_t, std::size_t)
+*/
+void IBM_double_to_IEEE (const unsigned char* data, double* values,
+	std::size_t count, std::size_t stride = DOUBLE_VALUE_SIZE);
+
+/**	Converts an array of IEEE values to a column of VAX real values.
+
+	@param	values	A pointer to an array of at least count values to
+		be converted.
+	@param	data	A pointer to the first byte of storage for the first
+		encoded value.
+	@param	count	The number of values to convert.
+	@param	stride	The number of bytes from the start of one encoded
+		value to the start of the next.
+*/
+void IEEE_to_VAX_real (const float* values, unsigned char* data,
+	std::size_t count, std::size_t stride = REAL_VALUE_SIZE);
+
+/**	Converts an array of IEEE values to a column of VAX double values.
+
+	@see IEEE_to_VAX_real(const float*, unsigned char*, std::size_t, std::size_t)
+*/
+void IEEE_to_VAX_double (const double* values, unsigned char* data,
+	std::size_t count, std::size_t stride = DOUBLE_VALUE_SIZE);
+
+/**	Converts an array of IEEE values to a column of IBM real values.
+
+	@see IEEE_to_VAX_real(const float*, unsigned char*, std::size_t, std::size_t)
+*/
+void IEEE_to_IBM_real (const float* values, unsigned char* data,
+	std::size_t count, std::size_t stride = REAL_VALUE_SIZE);
+
+/**	Converts an array of IEEE values to a column of IBM double values.
+
+	@see IEEE_to_VAX_real(const float*, unsigned char*, std::size_t, std::size_t)
+*/
+void IEEE_to_IBM_double (const double* values, unsigned char* data,
+	std::size_t count, std::size_t stride = DOUBLE_VALUE_SIZE);
+
+/*==============================================================================
+	Integer conversion
+*/
+/**	Converts a value to another arithmetic type, clamped to the range of
+	the destination type.
+
+	@param	T	The destination type.
+	@param	S	The source type.
+	@param	value	The value to be converted.
+	@return	The converted value. An integer value outside the range of an
+		integer destination type is the nearest limit of the type. A
+		floating point NaN converted to an integer type is zero.
+*/
+template<typename T, typename S>
+inline T
+saturated_value
+	(
+	S	value
+	)
+{
+if constexpr (std::is_floating_point<T>::value)
+	return static_cast<T>(value);
+else if constexpr (std::is_floating_point<S>::value)
+	{
+	//	The limits are powers of 2 that are exact in floating point.
+	const S
+		low  = static_cast<S>(std::numeric_limits<T>::min ()),
+		high = static_cast<S>
+			(T (1) << (std::numeric_limits<T>::digits - 1)) * 2;
+	return (value != value) ? T (0) :
+		(value <= low ? std::numeric_limits<T>::min () :
+		(value >= high ? std::numeric_limits<T>::max () :
+			static_cast<T>(value)));
+	}
+else
+	{
+	if constexpr (std::is_signed<S>::value)
+		{
+		if (value < 0)
+			{
+			if constexpr (std::is_signed<T>::value)
+				return ((intmax_t)value < (intmax_t)std::numeric_limits<T>::min ()) ?
+					std::numeric_limits<T>::min () : static_cast<T>(value);
+			else
+				return T (0);
+			}
+		}
+	return ((uintmax_t)value > (uintmax_t)std::numeric_limits<T>::max ()) ?
+		std::numeric_limits<T>::max () : static_cast<T>(value);
+	}
+}
+
+/**	Converts a value to another arithmetic type.
+
+	Integer values are converted as by a static_cast: an integer
+	destination that is narrower than the source receives the low order
+	bits of the value. A floating point value converted to an integer
+	type is {@link saturated_value(S) saturated}.
+
+	@param	T	The destination type.
+	@param	S	The source type.
+	@param	value	The value to be converted.
+	@return	The converted value.
+*/
+template<typename T, typename S>
+inline T
+converted_value
+	(
+	S	value
+	)
+{
+if constexpr (std::is_floating_point<S>::value &&
+			! std::is_floating_point<T>::value)
+	return saturated_value<T> (value);
+else
+	return static_cast<T>(value);
+}
+
+/*..............................................................................
+	Integer data access.
+*/
+//!	Gets an integer from data that may be in reversed byte order.
+template<typename S, bool Reversed>
+inline S
+integer_data
+	(
+	const unsigned char*	data
+	)
+{
+S
+	integer;
+std::memcpy (&integer, data, sizeof (S));
+return Reversed ? reversed (integer) : integer;
+}
+
+//!	Puts an integer into data in possibly reversed byte order.
+template<typename S, bool Reversed>
+inline void
+integer_data
+	(
+	S				integer,
+	unsigned char*	data
+	)
+{
+if (Reversed)
+	integer = reversed (integer);
+std::memcpy (data, &integer, sizeof (S));
+}
+
+/**	Gets an integer of any size from 1 to 8 bytes.
+
+	@param	data	A pointer to the first data byte.
+	@param	size	The number of data bytes.
+	@param	MSB_first	true if the most significant byte is first.
+	@param	is_signed	true if the data is to be sign extended.
+	@return	The integer bits, sign extended for signed data.
+*/
+inline uint64_t
+integer_bits
+	(
+	const unsigned char*	data,
+	std::size_t				size,
+	bool					MSB_first,
+	bool					is_signed
+	)
+{
+uint64_t
+	bits = 0;
+for (std::size_t
+		index = 0;
+		index < size;
+	  ++index)
+	bits |= (uint64_t)data[MSB_first ? index : (size - 1 - index)]
+		<< ((size - 1 - index) * 8);
+if (is_signed &&
+	size < 8)
+	{
+	uint64_t
+		sign = (uint64_t)1 << (size * 8 - 1);
+	bits = (bits ^ sign) - sign;
+	}
+return bits;
+}
+
+/**	Puts the low order bytes of an integer.
+
+	@param	bits	The integer bits.
+	@param	data	A pointer to the first data byte.
+	@param	size	The number of data bytes.
+	@param	MSB_first	true if the most significant byte is first.
+*/
+inline void
+integer_bits
+	(
+	uint64_t		bits,
+	unsigned char*	data,
+	std::size_t		size,
+	bool			MSB_first
+	)
+{
+for (std::size_t
+		index = 0;
+		index < size;
+	  ++index)
+	data[MSB_first ? (size - 1 - index) : index] =
+		(unsigned char)(bits >> (index * 8));
+}
+
+/*..............................................................................
+	Integer loops.
+*/
+//	A constant stride allows the loop to be vectorized.
+template<typename T, typename S, bool Reversed, bool Saturate>
+void
+integers_to_values_loop
+	(
+	const unsigned char*	data,
+	T*						values,
+	std::size_t				count,
+	std::size_t				stride
+	)
+{
+std::size_t
+	index;
+if (stride == sizeof (S))
+	for (index = 0;
+		 index < count;
+	   ++index)
+		values[index] = Saturate ?
+			saturated_value<T> (integer_data<S, Reversed> (data + index * sizeof (S))) :
+			converted_value<T> (integer_data<S, Reversed> (data + index * sizeof (S)));
+else
+	for (index = 0;
+		 index < count;
+	   ++index)
+		values[index] = Saturate ?
+			saturated_value<T> (integer_data<S, Reversed> (data + index * stride)) :
+			converted_value<T> (integer_data<S, Reversed> (data + index * stride));
+}
+
+
+template<typename T, typename S>
+void
+integers_to_values_sized
+	(
+	const unsigned char*	data,
+	T*						values,
+	std::size_t				count,
+	std::size_t				stride,
+	bool					reversed_order,
+	bool					saturate
+	)
+{
+if (reversed_order)
+	{
+	if (saturate)
+		integers_to_values_loop<T, S, true, true> (data, values, count, stride);
+	else
+		integers_to_values_loop<T, S, true, false> (data, values, count, stride);
+	}
+else
+	{
+	if (saturate)
+		integers_to_values_loop<T, S, false, true> (data, values, count, stride);
+	else
+		integers_to_values_loop<T, S, false, false> (data, values, count, stride);
+	}
+}
+
+
+template<typename T, typename D, bool Reversed, bool Saturate>
+void
+values_to_integers_loop
+	(
+	const T*		values,
+	unsigned char*	data,
+	std::size_t		count,
+	std::size_t		stride
+	)
+{
+std::size_t
+	index;
+if (stride == sizeof (D))
+	for (index = 0;
+		 index < count;
+	   ++index)
+		integer_data<D, Reversed> (Saturate ?
+			saturated_value<D> (values[index]) :
+			converted_value<D> (values[index]),
+			data + index * sizeof (D));
+else
+	for (index = 0;
+		 index < count;
+	   ++index)
+		integer_data<D, Reversed> (Saturate ?
+			saturated_value<D> (values[index]) :
+			converted_value<D> (values[index]),
+			data + index * stride);
+}
+
+
+template<typename T, typename D>
+void
+values_to_integers_sized
+	(
+	const T*		values,
+	unsigned char*	data,
+	std::size_t		count,
+	std::size_t		stride,
+	bool			reversed_order,
+	bool			saturate
+	)
+{
+if (reversed_order)
+	{
+	if (saturate)
+		values_to_integers_loop<T, D, true, true> (values, data, count, stride);
+	else
+		values_to_integers_loop<T, D, true, false> (values, data, count, stride);
+	}
+else
+	{
+	if (saturate)
+		values_to_integers_loop<T, D, false, true> (values, data, count, stride);
+	else
+		values_to_integers_loop<T, D, false, false> (values, data, count, stride);
+	}
+}
+
+/*..............................................................................
+	Integer batch conversion.
+*/
+/**	Converts a column of integer data values to host values.
+
+	@param	T	The host value type. This must be an arithmetic type.
+	@param	data	A pointer to the first byte of the first data value.
+	@param	size	The size, in bytes, of each data value. This must be
+		from 1 to 8.
+	@param	is_signed	true if the data values are signed and are to be
+		sign extended; false if they are unsigned.
+	@param	reversed_order	true if the data values are in the reverse of
+		the host byte order; false if they are in host order.
+	@param	values	A pointer to an array of at least count values that
+		will receive the converted values.
+	@param	count	The number of values to convert.
+	@param	saturate	true if integer values that are out of the range
+		of T are to be clamped to the nearest limit; false if only the
+		low order bytes of the values are to be kept.
+	@param	stride	The number of bytes from the start of one data value
+		to the start of the next. If zero the data values are contiguous.
+*/
+template<typename T>
+void
+integers_to_values
+	(
+	const unsigned char*	data,
+	std::size_t				size,
+	bool					is_signed,
+	bool					reversed_order,
+	T*						values,
+	std::size_t				count,
+	bool					saturate = false,
+	std::size_t				stride = 0
+	)
+{
+if (! stride)
+	stride = size;
+switch (size)
+	{
+	case 1:
+		if (is_signed)
+			integers_to_values_sized<T, int8_t>
+				(data, values, count, stride, false, saturate);
+		else
+			integers_to_values_sized<T, uint8_t>
+				(data, values, count, stride, false, saturate);
+		return;
+	case 2:
+		if (is_signed)
+			integers_to_values_sized<T, int16_t>
+				(data, values, count, stride, reversed_order, saturate);
+		else
+			integers_to_values_sized<T, uint16_t>
+				(data, values, count, stride, reversed_order, saturate);
+		return;
+	case 4:
+		if (is_signed)
+			integers_to_values_sized<T, int32_t>
+				(data, values, count, stride, reversed_order, saturate);
+		else
+			integers_to_values_sized<T, uint32_t>
+				(data, values, count, stride, reversed_order, saturate);
+		return;
+	case 8:
+		if (is_signed)
+			integers_to_values_sized<T, int64_t>
+				(data, values, count, stride, reversed_order, saturate);
+		else
+			integers_to_values_sized<T, uint64_t>
+				(data, values, count, stride, reversed_order, saturate);
+		return;
+	}
+
+bool
+	MSB_first = host_is_high_endian () != reversed_order;
+for (std::size_t
+		index = 0;
+		index < count;
+	  ++index, data += stride)
+	{
+	uint64_t
+		bits = integer_bits (data, size, MSB_first, is_signed);
+	if (is_signed)
+		values[index] = saturate ?
+			saturated_value<T> ((int64_t)bits) :
+			converted_value<T> ((int64_t)bits);
+	else
+		values[index] = saturate ?
+			saturated_value<T> (bits) :
+			converted_value<T> (bits);
+	}
+}
+
+/**	Converts an array of host values to a column of integer data values.
+
+	@param	T	The host value type. This must be an arithmetic type.
+	@param	values	A pointer to an array of at least count values to be
+		converted.
+	@param	data	A pointer to the first byte of storage for the first
+		data value.
+	@param	size	The size, in bytes, of each data value. This must be
+		from 1 to 8.
+	@param	is_signed	true if the data values are signed; false if they
+		are unsigned.
+	@param	reversed_order	true if the data values are to be in the
+		reverse of the host byte order; false for host order.
+	@param	count	The number of values to convert.
+	@param	saturate	true if values that are out of the range of the
+		data values are to be clamped to the nearest limit; false if
+		only the low order bytes of the values are to be kept. Floating
+		point values are always saturated.
+	@param	stride	The number of bytes from the start of one data value
+		to the start of the next. If zero the data values are contiguous.
+*/
+template<typename T>
+void
+values_to_integers
+	(
+	const T*		values,
+	unsigned char*	data,
+	std::size_t		size,
+	bool			is_signed,
+	bool			reversed_order,
+	std::size_t		count,
+	bool			saturate = false,
+	std::size_t		stride = 0
+	)
+{
+if (! stride)
+	stride = size;
+switch (size)
+	{
+	case 1:
+		if (is_signed)
+			values_to_integers_sized<T, int8_t>
+				(values, data, count, stride, false, saturate);
+		else
+			values_to_integers_sized<T, uint8_t>
+				(values, data, count, stride, false, saturate);
+		return;
+	case 2:
+		if (is_signed)
+			values_to_integers_sized<T, int16_t>
+				(values, data, count, stride, reversed_order, saturate);
+		else
+			values_to_integers_sized<T, uint16_t>
+				(values, data, count, stride, reversed_order, saturate);
+		return;
+	case 4:
+		if (is_signed)
+			values_to_integers_sized<T, int32_t>
+				(values, data, count, stride, reversed_order, saturate);
+		else
+			values_to_integers_sized<T, uint32_t>
+				(values, data, count, stride, reversed_order, saturate);
+		return;
+	case 8:
+		if (is_signed)
+			values_to_integers_sized<T, int64_t>
+				(values, data, count, stride, reversed_order, saturate);
+		else
+			values_to_integers_sized<T, uint64_t>
+				(values, data, count, stride, reversed_order, saturate);
+		return;
+	}
+
+//	The limits of the data values.
+int
+	bits = (int)size * 8;
+int64_t
+	minimum = is_signed ? -((int64_t)1 << (bits - 1)) : 0,
+	maximum = is_signed ?
+		(((int64_t)1 << (bits - 1)) - 1) : (((int64_t)1 << bits) - 1);
+bool
+	MSB_first = host_is_high_endian () != reversed_order;
+for (std::size_t
+		index = 0;
+		index < count;
+	  ++index, data += stride)
+	{
+	int64_t
+		integer = (saturate || std::is_floating_point<T>::value) ?
+			saturated_value<int64_t> (values[index]) :
+			converted_value<int64_t> (values[index]);
+	if (saturate || std::is_floating_point<T>::value)
+		integer = (integer < minimum) ? minimum :
+			((integer > maximum) ? maximum : integer);
+	integer_bits ((uint64_t)integer, data, size, MSB_first);
+	}
+}
+
+}	//	namespace PIRL
+#endif
@@ -19,6 +19,7 @@ You should have received a copy of the GNU Lesser General Public License
 along with this library; if not, write to the Free Software Foundation,
 Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
 */
+#include	"endian.hh"
 
 namespace PIRL
 {
@@ -90,6 +91,33 @@ while (data < (end -= size))
 }
 
 
+/*	Swaps the bytes of each value in registers.
+
+	The values are accessed by memcpy, so no alignment is required, and
+	the loop can be vectorized by an optimizing compiler.
+*/
+template<typename T>
+static void
+swap_values
+	(
+	unsigned char*			data,
+	const unsigned int		groups
+	)
+{
+T
+	value;
+for (unsigned int
+		index = 0;
+		index < groups;
+	  ++index)
+	{
+	std::memcpy (&value, data + (index * sizeof (T)), sizeof (T));
+	value = reversed (value);
+	std::memcpy (data + (index * sizeof (T)), &value, sizeof (T));
+	}
+}
+
+
 void
 swap_bytes
 	(
@@ -100,8 +128,21 @@ swap_bytes
 {
 if (! data)
 	return;
-if (size < 1)
-	return;
+switch (size)
+	{
+	case 0:
+	case 1:
+		return;
+	case 2:
+		swap_values<uint16_t> (data, groups);
+		return;
+	case 4:
+		swap_values<uint32_t> (data, groups);
+		return;
+	case 8:
+		swap_values<uint64_t> (data, groups);
+		return;
+	}
 register unsigned char
 	datum,
 	*end = data + (groups * size),
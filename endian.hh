@@ -22,6 +22,9 @@ Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
 #ifndef _endian_h
 #define _endian_h
 
+#include	<cstring>
+#include	<stdint.h>
+
 namespace PIRL
 {
 /**	Tests if the host system is high-endian.
@@ -184,6 +187,102 @@ return value;
 //!	Backwards compatibility with obsolete name.
 #define LSB_value	LSB_native
 
+/**	Reverses the bytes of a 16-bit value.
+
+	The shift and mask form is recognized by optimizing compilers which
+	will reduce it to a single byte swap instruction where one is
+	available.
+
+	@param	value	The value to be reversed.
+	@return	The value with its bytes in reverse order.
+*/
+inline uint16_t reversed_16 (uint16_t value)
+	{return (uint16_t)((value << 8) | (value >> 8));}
+
+/**	Reverses the bytes of a 32-bit value.
+
+	@param	value	The value to be reversed.
+	@return	The value with its bytes in reverse order.
+	@see	reversed_16(uint16_t)
+*/
+inline uint32_t reversed_32 (uint32_t value)
+	{
+	return
+		 (value << 24) |
+		((value <<  8) & 0x00FF0000U) |
+		((value >>  8) & 0x0000FF00U) |
+		 (value >> 24);
+	}
+
+/**	Reverses the bytes of a 64-bit value.
+
+	@param	value	The value to be reversed.
+	@return	The value with its bytes in reverse order.
+	@see	reversed_16(uint16_t)
+*/
+inline uint64_t reversed_64 (uint64_t value)
+	{
+	return
+		((uint64_t)reversed_32 ((uint32_t)value) << 32) |
+		 (uint64_t)reversed_32 ((uint32_t)(value >> 32));
+	}
+
+/**	Gets a copy of a value with its bytes reversed.
+
+	Unlike the MSB_native and LSB_native functions the value is not
+	modified; the reordered copy is returned. Values of 2, 4 and 8 bytes
+	are reversed in registers; values of any other size are reordered
+	byte by byte.
+
+	@param	value	A datum of any primitive type.
+	@return	A copy of the value with its bytes in reverse order.
+	@see	reorder_bytes(unsigned char*, const unsigned long)
+*/
+template<typename T>
+T
+reversed
+	(
+	T	value
+	)
+{
+switch (sizeof (T))
+	{
+	case 2:
+		{
+		uint16_t
+			bits;
+		std::memcpy (&bits, &value, 2);
+		bits = reversed_16 (bits);
+		std::memcpy (&value, &bits, 2);
+		break;
+		}
+	case 4:
+		{
+		uint32_t
+			bits;
+		std::memcpy (&bits, &value, 4);
+		bits = reversed_32 (bits);
+		std::memcpy (&value, &bits, 4);
+		break;
+		}
+	case 8:
+		{
+		uint64_t
+			bits;
+		std::memcpy (&bits, &value, 8);
+		bits = reversed_64 (bits);
+		std::memcpy (&value, &bits, 8);
+		break;
+		}
+	case 1:
+		break;
+	default:
+		reorder_bytes
+			(reinterpret_cast<unsigned char*>(&value), sizeof (T));
+	}
+return value;
+}
+
 
 }   //  PIRL namespace
 #endif
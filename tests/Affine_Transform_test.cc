@@ -0,0 +1,236 @@
+/*	Affine_Transform_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Affine_Transform.hh"
+#include "Rectangle_Set.hh"
+using namespace PIRL;
+
+const int
+	POINTS	= 100000;
+
+//	A deterministic pseudo-random sequence.
+unsigned int
+	Seed = 1357;
+
+int
+random_value
+	(
+	int		limit
+	)
+{
+Seed = Seed * 1103515245 + 12345;
+return (int)((Seed >> 8) % (unsigned int)limit);
+}
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Affine_Transform test" << endl
+	 << "    " << Affine_Transform::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	index;
+
+vector<Point_2D>
+	points;
+for (index = 0;
+	 index < POINTS;
+   ++index)
+	points.push_back (Point_2D
+		(random_value (20000) - 10000, random_value (20000) - 10000));
+
+cout << endl << "--- Rounding" << endl;
+vector<double>
+	numbers;
+for (index = -400;
+	 index <= 400;
+   ++index)
+	numbers.push_back (index / 8.0);
+vector<Coordinate_Type>
+	values (numbers.size ());
+Affine_Transform::round (numbers.data (), values.data (), numbers.size ());
+passed = true;
+for (index = 0;
+	 index < (int)numbers.size ();
+   ++index)
+	if (values[index] != Round (numbers[index]))
+		passed = false;
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "rounding is the same as Round" << endl;
+
+const double
+	extremes[] =
+		{
+		1e300,
+		-1e300,
+		numeric_limits<double>::infinity (),
+		numeric_limits<double>::quiet_NaN ()
+		};
+Coordinate_Type
+	saturated[4];
+Affine_Transform::round (extremes, saturated, 4);
+++Tests_Total;
+if ((passed = (saturated[0] == numeric_limits<Coordinate_Type>::max () &&
+			   saturated[1] == numeric_limits<Coordinate_Type>::min () &&
+			   saturated[2] == numeric_limits<Coordinate_Type>::max () &&
+			   saturated[3] == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "out of range values are saturated" << endl;
+
+cout << endl << "--- Transforms" << endl;
+Affine_Transform
+	scaling;
+scaling.scale (1.37);
+vector<Point_2D>
+	scaled (points);
+scaling.transform (scaled);
+passed = true;
+for (index = 0;
+	 index < POINTS;
+   ++index)
+	{
+	Point_2D
+		point (points[index]);
+	point *= 1.37;
+	if (scaled[index] != point)
+		passed = false;
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "scaling is the same as Point_2D multiplication" << endl;
+
+Affine_Transform
+	transform;
+transform.scale (2.5, 0.75).rotate (0.3).translate (17.25, -4.5);
+const double
+	cosine = cos (0.3),
+	sine = sin (0.3);
+vector<Point_2D>
+	transformed (points.size ());
+transform.transform (points.data (), transformed.data (), points.size ());
+passed = true;
+for (index = 0;
+	 index < POINTS;
+   ++index)
+	{
+	double
+		x = points[index].X * 2.5,
+		y = points[index].Y * 0.75;
+	Point_2D
+		expected
+			(Round (cosine * x - sine * y + 17.25),
+			 Round (sine * x + cosine * y - 4.5));
+	//	The composed coefficients may differ in the last bit.
+	if (abs (transformed[index].X - expected.X) > 1 ||
+		abs (transformed[index].Y - expected.Y) > 1 ||
+		transform (points[index]) != transformed[index])
+		passed = false;
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "scale, rotate and translate" << endl;
+
+Affine_Transform
+	composed (transform);
+composed.then (Affine_Transform ().translate (-17.25, 4.5));
+++Tests_Total;
+if ((passed = (Affine_Transform ().scale (2.0).then
+					(Affine_Transform ().translate (3.0, 4.0)) ==
+				Affine_Transform (2.0, 0.0, 3.0, 0.0, 2.0, 4.0) &&
+			   fabs (composed.offset_x ()) < 1e-9 &&
+			   fabs (composed.offset_y ()) < 1e-9 &&
+			   Affine_Transform () (Point_2D (5, -6)) == Point_2D (5, -6))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "composition" << endl;
+
+cout << endl << "--- Coordinate columns" << endl;
+Rectangle_Set
+	set;
+for (index = 0;
+	 index < POINTS;
+   ++index)
+	set.push_back (Rectangle (points[index], Size_2D (1, 1)));
+transform.transform (set.x (), set.y (), set.size ());
+passed = true;
+for (index = 0;
+	 index < POINTS;
+   ++index)
+	if (set.x ()[index] != transformed[index].X ||
+		set.y ()[index] != transformed[index].Y)
+		passed = false;
+vector<Point_2D>
+	in_place (points);
+transform.transform (in_place);
+if (in_place != transformed)
+	passed = false;
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "coordinate columns and in place points" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,211 @@
+/*	Bit_Field_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Bit_Field.hh"
+using namespace PIRL;
+
+enum
+	{
+	STATUS,
+	COUNTERS,
+	TIME
+	};
+
+//	A 2-byte status word, a 3-byte counters word and an 8-byte time.
+static const Data_Block::Index
+	sizes[] = {2, 3, 8, 0};
+
+const int
+	RECORD_SIZE	= 13,
+	RECORDS		= 1001;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Bit_Field test" << endl
+	 << "    " << Bit_Field::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	record;
+
+Bit_Field
+	mode (STATUS, 0, 4),
+	offset (STATUS, 4, 7, true),
+	valid (STATUS, 15, 1),
+	counter (COUNTERS, 10, 12);
+Data_Block
+	layout;
+layout.element_sizes (sizes);
+unsigned char
+	data[RECORD_SIZE] = {0};
+layout.data (data);
+
+cout << endl << "--- Scalar" << endl;
+layout.data_order (Data_Block::MSB);
+mode.put (layout, 0xA);
+offset.put (layout, -3);
+valid.put (layout, 1);
+counter.put (layout, 0xABC);
+++Tests_Total;
+if ((passed = (data[0] == 0x87 &&
+			   data[1] == 0xDA &&
+			   data[2] == 0x2A &&
+			   data[3] == 0xF0 &&
+			   data[4] == 0x00 &&
+			   mode.get<int> (layout) == 0xA &&
+			   offset.get<int> (layout) == -3 &&
+			   valid.get<bool> (layout) &&
+			   counter.get<unsigned int> (layout) == 0xABC)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "MSB put and get" << endl;
+
+for (record = 0;
+	 record < RECORD_SIZE;
+   ++record)
+	data[record] = 0;
+layout.data_order (Data_Block::LSB);
+mode.put (layout, 0xA);
+offset.put (layout, -3);
+valid.put (layout, 1);
+counter.put (layout, 0xABC);
+++Tests_Total;
+if ((passed = (data[0] == 0xDA &&
+			   data[1] == 0x87 &&
+			   data[2] == 0x00 &&
+			   data[3] == 0xF0 &&
+			   data[4] == 0x2A &&
+			   offset.get<int> (layout) == -3 &&
+			   counter.get<unsigned int> (layout) == 0xABC)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "LSB put and get" << endl;
+
+offset.put (layout, 0x1F);
+++Tests_Total;
+if ((passed = (mode.get<int> (layout) == 0xA &&
+			   offset.get<int> (layout) == 0x1F &&
+			   valid.get<int> (layout) == 1)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "put changes only the field bits" << endl;
+
+cout << endl << "--- Gather" << endl;
+layout.data_order (Data_Block::MSB);
+vector<unsigned char>
+	records (RECORDS * RECORD_SIZE, 0);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&records[record * RECORD_SIZE]);
+	mode.put (layout, record);
+	offset.put (layout, (record % 128) - 64);
+	counter.put (layout, record * 3);
+	}
+vector<int>
+	modes (RECORDS),
+	offsets (RECORDS);
+vector<unsigned short>
+	counters (RECORDS);
+mode.gather (&modes[0], layout, &records[0], RECORDS, RECORD_SIZE);
+offset.gather (&offsets[0], layout, &records[0], RECORDS, RECORD_SIZE);
+counter.gather (&counters[0], layout, &records[0], RECORDS, RECORD_SIZE);
+passed = true;
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	if (modes[record] != (record & 0xF) ||
+		offsets[record] != (record % 128) - 64 ||
+		counters[record] != ((record * 3) & 0xFFF))
+		passed = false;
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "gather unsigned and signed fields from records" << endl;
+
+cout << endl << "--- Invalid fields" << endl;
+++Tests_Total;
+try
+	{
+	Bit_Field
+		field (STATUS, 60, 8);
+	passed = false;
+	}
+catch (invalid_argument&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "a field beyond 64 bits throws invalid_argument" << endl;
+
+++Tests_Total;
+try
+	{
+	Bit_Field
+		field (STATUS, 12, 8);
+	field.get<int> (layout);
+	passed = false;
+	}
+catch (out_of_range&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "a field beyond the element value throws out_of_range" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,203 @@
+/*	Data_Block_Editor_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <stdexcept>
+using namespace std;
+
+#include "Data_Block_Editor.hh"
+using namespace PIRL;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Data_Block_Editor test" << endl
+	 << "    " << Data_Block_Editor::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0;
+Data_Block_Editor::Index
+	index;
+
+cout << endl << "--- Build" << endl;
+Data_Block_Editor
+	editor;
+editor.base_offset (8);
+for (index = 0;
+	 index < 1000;
+   ++index)
+	editor.insert_element (editor.elements (), 4);
+editor.insert_element (10, 12, 3);
+
+++Tests_Total;
+if ((passed = (editor.elements () == 1001 &&
+			   editor.size () == 8 + 4012 &&
+			   editor.offset_of (10) == 48 &&
+			   editor.offset_of (11) == 60 &&
+			   editor.count_of (10) == 3)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "1001 elements, size = " << editor.size ()
+	 << ", offset_of (11) = " << editor.offset_of (11) << endl;
+
+++Tests_Total;
+if ((passed = (editor.index_of (60) == 11 &&
+			   editor.index_of (61) == Data_Block::NO_INDEX &&
+			   editor.index_of (4) == Data_Block::NO_INDEX)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "index_of (60) = " << editor.index_of (60) << " - 11" << endl;
+
+cout << endl << "--- Edit" << endl;
+editor.delete_element (0);
+++Tests_Total;
+if ((passed = (editor.elements () == 1000 &&
+			   editor.offset_of (9) == 44 &&
+			   editor.size () == 8 + 4008)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "delete_element (0): offset_of (9) = " << editor.offset_of (9)
+	 << " - 44" << endl;
+
+++Tests_Total;
+if ((passed = (editor.size_of (9, 8) == true &&
+			   editor.count_of (9) == 1 &&
+			   editor.offset_of (10) == 52)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "size_of (9, 8): count reset, offset_of (10) = "
+	 << editor.offset_of (10) << " - 52" << endl;
+
+++Tests_Total;
+try
+	{
+	editor.count_of (9, 3);
+	passed = false;
+	}
+catch (length_error&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "count_of (9, 3) throws length_error" << endl;
+
+cout << endl << "--- Conversion" << endl;
+Data_Block
+	block;
+editor.structure (block);
+Data_Block::Value_List
+	offsets = block.element_offsets_list ();
+++Tests_Total;
+if ((passed = (block.elements () == editor.elements () &&
+			   block.size () == editor.size () &&
+			   offsets == editor.element_offsets_list () &&
+			   block.array_counts_list () == editor.array_counts_list ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "Data_Block structure matches" << endl;
+
+Data_Block_Editor
+	copy (block);
+++Tests_Total;
+if ((passed = (copy.base_offset () == 8 &&
+			   copy.element_offsets_list () == offsets &&
+			   copy.array_counts_list () == block.array_counts_list ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "Data_Block_Editor from Data_Block" << endl;
+
+cout << endl << "--- Value formats" << endl;
+static const Data_Block::Index
+	format_sizes[] = {4, 4, 0};
+Data_Block
+	format_block;
+format_block.element_sizes (format_sizes);
+format_block.value_format (0, Data_Block::IBM_REAL);
+Data_Block_Editor
+	format_editor (format_block);
+format_editor.insert_element (0, 2);
+format_editor.structure (format_block);
+++Tests_Total;
+if ((passed = (format_block.elements () == 3 &&
+			   format_block.value_format (0) == Data_Block::UNSPECIFIED_FORMAT &&
+			   format_block.value_format (1) == Data_Block::IBM_REAL &&
+			   format_block.value_format (2) == Data_Block::UNSPECIFIED_FORMAT)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "insert_element: the value format stays with its element" << endl;
+
+format_editor.delete_element (0).value_format (1, Data_Block::VAX_REAL);
+format_editor.structure (format_block);
+++Tests_Total;
+if ((passed = (format_block.elements () == 2 &&
+			   format_block.value_format (0) == Data_Block::IBM_REAL &&
+			   format_block.value_format (1) == Data_Block::VAX_REAL)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "delete_element: the value format stays with its element" << endl;
+
+format_editor.size_of (0, 6);
+format_editor.structure (format_block);
+++Tests_Total;
+try
+	{
+	format_editor.value_format (0, Data_Block::IBM_REAL);
+	passed = false;
+	}
+catch (length_error&)
+	{passed = true;}
+if ((passed = (passed &&
+			   format_block.value_format (0) == Data_Block::UNSPECIFIED_FORMAT &&
+			   format_block.value_format (1) == Data_Block::VAX_REAL)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "a resized element drops a format it no longer fits" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
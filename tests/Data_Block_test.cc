@@ -756,6 +756,213 @@ cout << (passed ? "PASS: " : "FAIL: ")
 	 << "block.count_of (" << number << ") = " << index << " - 2" << endl;
 
 
+cout << endl << "--- Shared structure copy" << endl;
+{
+Data_Block
+	view (block);
+++Tests_Total;
+if (passed = (view.element_offsets_list () == block.element_offsets_list () &&
+			  view.array_counts_list () == block.array_counts_list ()))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "copy has the same structure" << endl;
+
+number = block.elements ();
+index = block.size ();
+view.delete_element (0);
+++Tests_Total;
+if (passed = (view.elements () == (number - 1) &&
+			  block.elements () == number &&
+			  block.size () == index))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "view.delete_element (0): view.elements () = " << view.elements ()
+	 << " - " << (number - 1) << ", block.elements () = " << block.elements ()
+	 << " - " << number << endl;
+
+view = block;
+view.count_of (INT_ARRAY, 1);
+++Tests_Total;
+if (passed = (view.count_of (INT_ARRAY) == 1 &&
+			  block.count_of (INT_ARRAY) == indexed_counts[0][1]))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "view.count_of (" << INT_ARRAY << ", 1): block.count_of ("
+	 << INT_ARRAY << ") = " << block.count_of (INT_ARRAY)
+	 << " - " << indexed_counts[0][1] << endl;
+}
+
+cout << endl << "--- Bulk array transfer" << endl;
+{
+static const Data_Block::Index
+	array_sizes[] = {64, 0};
+unsigned char
+	array_data[64];
+int
+	ints[16],
+	copies[16];
+short
+	shorts[16];
+long long
+	longs[16];
+for (index = 0;
+	 index < 16;
+	 index++)
+	ints[index] = (index << 24) | (index << 16) | 0xFF00 | index;
+Data_Block
+	array_block;
+array_block.element_sizes (array_sizes);
+array_block.count_of (0, 16);
+array_block.data (array_data);
+array_block.data_order (Data_Block::MSB);
+array_block.put (ints, 0);
+array_block.get (copies, 0);
+array_block.get (shorts, 0);
+array_block.get (longs, 0);
+++Tests_Total;
+passed = (array_data[4] == 1 && array_data[7] == 1);
+for (index = 0;
+	 index < 16;
+	 index++)
+	if (copies[index] != ints[index] ||
+		shorts[index] != (short)ints[index] ||
+		longs[index] != (long long)(unsigned int)ints[index])
+		passed = false;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "MSB array put/get as int, short and long long" << endl;
+}
+
+cout << endl << "--- Gather from records" << endl;
+{
+//	Eight 6-byte MSB records: a 4-byte int and a 2-byte signed integer.
+static const Data_Block::Index
+	record_sizes[] = {4, 2, 0};
+unsigned char
+	records[48];
+int
+	numbers[8];
+short
+	offsets[8];
+float
+	reals[8];
+Data_Block
+	record_block;
+record_block.element_sizes (record_sizes);
+record_block.data_order (Data_Block::MSB);
+record_block.value_format (1, Data_Block::SIGNED_INTEGER);
+for (index = 0;
+	 index < 8;
+	 index++)
+	{
+	int
+		number = index * 1000;
+	short
+		offset = -(short)index;
+	record_block.data (records + index * 6);
+	record_block.put (number, 0);
+	record_block.put (offset, 1);
+	}
+record_block.gather (numbers, 0, records, 8, 6);
+record_block.gather (offsets, 1, records, 8, 6);
+record_block.gather (reals, 1, records, 8, 6);
+++Tests_Total;
+passed = true;
+for (index = 0;
+	 index < 8;
+	 index++)
+	if (numbers[index] != (int)index * 1000 ||
+		offsets[index] != -(int)index ||
+		reals[index] != -(float)index)
+		passed = false;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "gather int, short and float from MSB records" << endl;
+}
+
+cout << endl << "--- Element lookup" << endl;
+{
+static const Data_Block::Index
+	lookup_sizes[] = {4, 2, 8, 0};
+Data_Block
+	lookup_block;
+lookup_block.element_sizes (lookup_sizes);
+++Tests_Total;
+if ((passed = (lookup_block.index_of (4) == 1 &&
+			   lookup_block.index_of (5) == Data_Block::NO_INDEX &&
+			   lookup_block.index_of (14) == Data_Block::NO_INDEX &&
+			   lookup_block.element_containing (0) == 0 &&
+			   lookup_block.element_containing (5) == 1 &&
+			   lookup_block.element_containing (13) == 2 &&
+			   lookup_block.element_containing (14) == Data_Block::NO_INDEX)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "index_of and element_containing" << endl;
+
+Data_Block
+	shared_block (lookup_block);
+shared_block.size_of (1, 4);
+++Tests_Total;
+if ((passed = (shared_block.element_containing (7) == 1 &&
+			   shared_block.index_of (8) == 2 &&
+			   lookup_block.element_containing (7) == 2 &&
+			   lookup_block.index_of (6) == 2)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "lookup follows structure changes" << endl;
+
+static const Data_Block::Index
+	large_sizes[] = {8, 5000, 4, 0};
+lookup_block.element_sizes (large_sizes);
+++Tests_Total;
+if ((passed = (lookup_block.index_of (5008) == 2 &&
+			   lookup_block.index_of (5009) == Data_Block::NO_INDEX &&
+			   lookup_block.element_containing (7) == 0 &&
+			   lookup_block.element_containing (5007) == 1 &&
+			   lookup_block.element_containing (5011) == 2 &&
+			   lookup_block.element_containing (5012) == Data_Block::NO_INDEX)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "lookup beyond the table limit" << endl;
+}
+
+cout << endl << "--- Value formats follow relocated elements" << endl;
+{
+static const Data_Block::Index
+	format_sizes[] = {4, 4, 4, 4, 0};
+Data_Block
+	format_block;
+format_block.element_sizes (format_sizes);
+format_block.value_format (0, Data_Block::VAX_REAL);
+format_block.value_format (3, Data_Block::IBM_REAL);
+//	Element 0 moves up to offset 10: offsets 4, 8, 10, 12.
+format_block.offset_of (0, 10);
+++Tests_Total;
+if ((passed = (format_block.offset_of (2) == 10 &&
+			   format_block.value_format (0) == Data_Block::UNSPECIFIED_FORMAT &&
+			   format_block.value_format (1) == Data_Block::UNSPECIFIED_FORMAT &&
+			   format_block.value_format (2) == Data_Block::VAX_REAL &&
+			   format_block.value_format (3) == Data_Block::IBM_REAL)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "offset_of moving an element up carries its value format" << endl;
+
+//	Element 3 moves down to offset 2: offsets 2, 4, 8, 10.
+format_block.offset_of (3, 2);
+++Tests_Total;
+if ((passed = (format_block.offset_of (0) == 2 &&
+			   format_block.value_format (0) == Data_Block::IBM_REAL &&
+			   format_block.value_format (1) == Data_Block::UNSPECIFIED_FORMAT &&
+			   format_block.value_format (2) == Data_Block::UNSPECIFIED_FORMAT &&
+			   format_block.value_format (3) == Data_Block::VAX_REAL)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "offset_of moving an element down carries its value format" << endl;
+}
+
+
 Done (Tests_Total, Tests_Passed);
 }
 
@@ -29,9 +29,36 @@ using namespace idaeim;
 #include 	<iomanip>
 #include	<cstdlib>
 #include	<stdexcept>
+#include	<type_traits>
+#include	<limits>
 using namespace std;
 
 
+//	Geometry computed at compile time.
+static_assert (is_trivially_copyable<Point_2D>::value &&
+			   is_trivially_copyable<Size_2D>::value &&
+			   is_trivially_copyable<Rectangle>::value &&
+			   is_trivially_copyable<Cube>::value,
+	"Dimensions types are trivially copyable");
+
+constexpr Rectangle
+	DETECTOR (0, 0, 1024, 1024),
+	VIEW = (DETECTOR & Rectangle (-8, 512, 64, 1024)) + Point_2D (2, 3);
+static_assert (VIEW == Rectangle (2, 515, 56, 512),
+	"constexpr Rectangle operators");
+
+constexpr Cube
+	TILE = Cube (Size_2D (256)) / 2.0;
+static_assert (TILE.volume () == 128 * 128 &&
+			   (TILE | Cube (100, 100, 100, 100, 3)).depth () == 3,
+	"constexpr Cube operators");
+
+static_assert (Point_2D (1, 0) < Point_2D (0, 1) &&
+			   Rectangle (0, 0, 2, 5) < Rectangle (0, 0, 3, 1) &&
+			   TILE.hash () != Cube (TILE).depth (2).hash (),
+	"constexpr ordering and hashing");
+
+
 int
 main
 	(
@@ -441,6 +468,21 @@ expected_cube = Cube (0, 2, 21, 30, 40);
 checker.check (listing.str (),
 	expected_cube, cube);
 
+cube   = Cube (0, 5, 15, 25, 35);
+listing.str ("");
+listing << "cube " << cube << " | " << cube_1;
+expected_cube = Cube (0, 2, 21, 30, 40);
+checker.check (listing.str (),
+	expected_cube, cube | cube_1);
+
+size = Size_2D (10, 20);
+size /= 0.0;
+expected_size = Size_2D (numeric_limits<Dimensions_Type>::max ());
+listing.str ("");
+listing << "size " << Size_2D (10, 20) << " / 0.0";
+checker.check (listing.str (),
+	expected_size, size);
+
 
 cout << endl
 	 << "Checks: " << checker.Checks_Total << endl
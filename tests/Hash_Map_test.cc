@@ -0,0 +1,339 @@
+/*	Hash_Map_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <stdexcept>
+using namespace std;
+
+#include "Hash_Map.hh"
+using namespace PIRL;
+
+//	A deterministic pseudo-random sequence.
+unsigned int
+	Seed = 1357;
+
+int
+random_value
+	(
+	int		limit
+	)
+{
+Seed = Seed * 1103515245 + 12345;
+return (int)((Seed >> 8) % (unsigned int)limit);
+}
+
+
+Cube
+random_cube ()
+{
+return Cube (random_value (64) - 32, random_value (64) - 32,
+	random_value (4), random_value (4), random_value (3));
+}
+
+
+//	The Morton code of a point, with each Y bit above the X bit.
+unsigned long long
+morton_code
+	(
+	const Point_2D&	point
+	)
+{
+unsigned long long
+	x = (unsigned int)point.X ^ 0x80000000U,
+	y = (unsigned int)point.Y ^ 0x80000000U,
+	code = 0;
+for (int
+		bit = 0;
+		bit < 32;
+	  ++bit)
+	code |=
+		(((x >> bit) & 1) << (2 * bit)) |
+		(((y >> bit) & 1) << (2 * bit + 1));
+return code;
+}
+
+
+//	The reference ordering of a Cube.
+bool
+cube_precedes
+	(
+	const Cube&	first,
+	const Cube&	second
+	)
+{
+unsigned long long
+	first_code = morton_code (first),
+	second_code = morton_code (second);
+if (first_code != second_code)
+	return first_code < second_code;
+if (first.Width != second.Width)
+	return first.Width < second.Width;
+if (first.Height != second.Height)
+	return first.Height < second.Height;
+return first.Depth < second.Depth;
+}
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Hash_Map test" << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	index;
+
+cout << endl << "--- Ordering" << endl;
+passed = true;
+for (index = 0;
+	 index < 10000;
+   ++index)
+	{
+	Point_2D
+		first (random_value (1 << 20) - (1 << 19),
+			random_value (1 << 20) - (1 << 19)),
+		second (first.X + random_value (64) - 32,
+			first.Y + random_value (64) - 32);
+	if ((first < second) != (morton_code (first) < morton_code (second)) ||
+		(second < first) != (morton_code (second) < morton_code (first)))
+		passed = false;
+	}
+++Tests_Total;
+if ((passed = (passed &&
+			   Point_2D (-1, 0) < Point_2D (0, 0) &&
+			   Point_2D (1, 0) < Point_2D (0, 1) &&
+			   ! (Point_2D (3, 3) < Point_2D (3, 3)))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "Point_2D Morton order" << endl;
+
+vector<Cube>
+	cubes,
+	sorted;
+for (index = 0;
+	 index < 2000;
+   ++index)
+	cubes.push_back (random_cube ());
+sorted = cubes;
+sort (sorted.begin (), sorted.end ());
+sort (cubes.begin (), cubes.end (), cube_precedes);
+set<Rectangle>
+	rectangles (cubes.begin (), cubes.end ());
+++Tests_Total;
+if ((passed = (sorted == cubes &&
+			   Rectangle (0, 0, 2, 5) < Rectangle (0, 0, 3, 1) &&
+			   rectangles.size () < cubes.size ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "Rectangle and Cube position then size order" << endl;
+
+cout << endl << "--- Hashing" << endl;
+//	The tiles of a large image differ in only a few low bits.
+vector<size_t>
+	hashes;
+vector<int>
+	bit_counts (64, 0);
+for (int
+		y = 0;
+		y < 256;
+	  ++y)
+	for (int
+			x = 0;
+			x < 256;
+		  ++x)
+		{
+		size_t
+			hash = std::hash<Rectangle> () (Rectangle (x * 256, y * 256, 256, 256));
+		hashes.push_back (hash);
+		for (int
+				bit = 0;
+				bit < 64;
+			  ++bit)
+			bit_counts[bit] += (int)((hash >> bit) & 1);
+		}
+sort (hashes.begin (), hashes.end ());
+passed = adjacent_find (hashes.begin (), hashes.end ()) == hashes.end ();
+for (int
+		bit = 0;
+		bit < 64;
+	  ++bit)
+	if (bit_counts[bit] < 32768 - 1024 ||
+		bit_counts[bit] > 32768 + 1024)
+		passed = false;
+++Tests_Total;
+if ((passed = (passed &&
+			   std::hash<Cube> () (Cube (1, 2, 3, 4, 5)) ==
+			   	Cube (1, 2, 3, 4, 5).hash () &&
+			   std::hash<Cube> () (Cube (1, 2, 3, 4, 5)) !=
+			   	std::hash<Cube> () (Cube (1, 2, 3, 4, 6)) &&
+			   std::hash<Point_2D> () (Point_2D (1, 2)) !=
+			   	std::hash<Point_2D> () (Point_2D (2, 1)))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "tile hashes are distinct with balanced bits" << endl;
+
+cout << endl << "--- Map" << endl;
+Hash_Map<Cube, int>
+	map;
+std::map<Cube, int>
+	reference;
+passed = true;
+for (index = 0;
+	 index < 20000;
+   ++index)
+	{
+	Cube
+		cube = random_cube ();
+	switch (random_value (4))
+		{
+		case 0:
+			if (map.erase (cube) != (reference.erase (cube) != 0))
+				passed = false;
+			break;
+		case 1:
+			if (map.insert (cube, index) !=
+				reference.insert (make_pair (cube, index)).second)
+				passed = false;
+			break;
+		default:
+			map[cube] = index;
+			reference[cube] = index;
+		}
+	}
+for (std::map<Cube, int>::const_iterator
+		entry = reference.begin ();
+		entry != reference.end ();
+	  ++entry)
+	{
+	const int*
+		value = map.find (entry->first);
+	if (! value ||
+		*value != entry->second)
+		passed = false;
+	}
+int
+	visited = 0;
+map.for_each ([&] (const Cube& cube, int value)
+	{
+	if (reference.count (cube) &&
+		reference[cube] == value)
+		++visited;
+	});
+++Tests_Total;
+if ((passed = (passed &&
+			   map.size () == reference.size () &&
+			   visited == (int)reference.size () &&
+			   ! map.contains (Cube (1000, 1000, 1, 1, 1)) &&
+			   map.size () * 100 <= map.capacity () * 75)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "random insertions and erasures agree with std::map" << endl;
+
+Hash_Map<Rectangle, int>
+	tiles (1000);
+size_t
+	capacity = tiles.capacity ();
+for (index = 0;
+	 index < 1000;
+   ++index)
+	tiles[Rectangle (index * 64, 0, 64, 64)] = index;
+passed = tiles.capacity () == capacity;
+for (index = 0;
+	 index < 1000;
+	 index += 2)
+	tiles.erase (Rectangle (index * 64, 0, 64, 64));
+for (index = 0;
+	 index < 1000;
+   ++index)
+	{
+	const int*
+		value = tiles.find (Rectangle (index * 64, 0, 64, 64));
+	if ((index % 2) ? (! value || *value != index) : (value != NULL))
+		passed = false;
+	}
+++Tests_Total;
+if ((passed = (passed &&
+			   tiles.size () == 500 &&
+			   tiles.clear ().empty () &&
+			   ! tiles.find (Rectangle (64, 0, 64, 64)) &&
+			   tiles.capacity () == capacity &&
+			   Hash_Map<Point_2D, int> ().capacity () == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "reserve, erase and clear" << endl;
+
+//	Twelve entries are the most a minimum capacity table holds.
+Hash_Map<Point_2D, int>
+	full;
+for (index = 0;
+	 index < 12;
+   ++index)
+	full[Point_2D (index, index)] = index;
+capacity = full.capacity ();
+for (index = 0;
+	 index < 12;
+   ++index)
+	++full[Point_2D (index, index)];
+passed = full.capacity () == capacity;
+full[Point_2D (12, 12)] = 12;
+++Tests_Total;
+if ((passed = (passed &&
+			   capacity == Hash_Map<Point_2D, int>::MINIMUM_CAPACITY &&
+			   full.capacity () == 2 * capacity &&
+			   full.size () == 13 &&
+			   *full.find (Point_2D (11, 11)) == 12)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "existing keys of a full table do not enlarge it" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
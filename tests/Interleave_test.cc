@@ -0,0 +1,261 @@
+/*	Interleave_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Interleave.hh"
+using namespace PIRL;
+
+typedef vector<unsigned char>	Pixels;
+
+const char* const
+	NAMES[] = {"BSQ", "BIL", "BIP"};
+
+/*	Fills an image with pixels whose bytes identify the pixel.
+
+	Each byte is a function of the sample, line, band and byte number of
+	the pixel.
+*/
+unsigned char
+pixel_byte
+	(
+	size_t		sample,
+	size_t		line,
+	size_t		band,
+	size_t		byte
+	)
+{
+return (unsigned char)(sample * 7 + line * 31 + band * 101 + byte * 53);
+}
+
+
+Pixels
+image
+	(
+	const Cube&					cube,
+	Interleave::Organization	organization,
+	unsigned int				pixel_bytes,
+	bool						reversed = false
+	)
+{
+Pixels
+	pixels ((size_t)cube.Width * cube.Height * cube.Depth * pixel_bytes);
+for (size_t
+		band = 0;
+		band < cube.Depth;
+	  ++band)
+	for (size_t
+			line = 0;
+			line < cube.Height;
+		  ++line)
+		for (size_t
+				sample = 0;
+				sample < cube.Width;
+			  ++sample)
+			{
+			size_t
+				index = Interleave::pixel_index
+					(cube, organization, sample, line, band) * pixel_bytes;
+			for (size_t
+					byte = 0;
+					byte < pixel_bytes;
+				  ++byte)
+				pixels[index + (reversed ? pixel_bytes - 1 - byte : byte)] =
+					pixel_byte (sample, line, band, byte);
+			}
+return pixels;
+}
+
+
+//	Tests every conversion of a cube, out of place and in place.
+bool
+conversions
+	(
+	const Cube&		cube,
+	unsigned int	pixel_bytes,
+	bool			reverse,
+	bool			in_place,
+	unsigned int	threads = 0
+	)
+{
+for (int
+		from = Interleave::BSQ;
+		from <= Interleave::BIP;
+	  ++from)
+	{
+	Interleave::Organization
+		source = (Interleave::Organization)from;
+	Pixels
+		original = image (cube, source, pixel_bytes);
+	for (int
+			to = Interleave::BSQ;
+			to <= Interleave::BIP;
+		  ++to)
+		{
+		Interleave::Organization
+			target = (Interleave::Organization)to;
+		Interleave
+			interleave (cube, pixel_bytes, source, target, reverse);
+		interleave.threads (threads);
+		Pixels
+			expected = image (cube, target, pixel_bytes, reverse),
+			pixels;
+		if (in_place)
+			{
+			pixels = original;
+			interleave.transpose (pixels.data ());
+			}
+		else
+			{
+			pixels.resize (interleave.size ());
+			interleave.transpose (original.data (), pixels.data ());
+			}
+		if (pixels != expected)
+			{
+			cout << "    " << NAMES[from] << " to " << NAMES[to]
+				 << " of " << cube << " with " << pixel_bytes
+				 << " byte pixels failed" << endl;
+			return false;
+			}
+		}
+	}
+return true;
+}
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Interleave test" << endl
+	 << "    " << Interleave::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0;
+
+//	Odd dimensions, with partial tiles.
+Cube
+	cube (0, 0, 37, 23, 5),
+	thin (0, 0, 300, 2, 3),
+	large (0, 0, 517, 263, 4);
+
+cout << endl << "--- Out of place" << endl;
+++Tests_Total;
+if ((passed = (conversions (cube, 2, false, false) &&
+			   conversions (cube, 1, false, false) &&
+			   conversions (cube, 8, false, false) &&
+			   conversions (thin, 4, false, false))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "all conversions of register sized pixels" << endl;
+
+++Tests_Total;
+if ((passed = (conversions (cube, 3, false, false) &&
+			   conversions (thin, 6, false, false))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "all conversions of odd sized pixels" << endl;
+
+++Tests_Total;
+if ((passed = (conversions (cube, 2, true, false) &&
+			   conversions (cube, 4, true, false) &&
+			   conversions (cube, 3, true, false))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "byte reversal during conversion" << endl;
+
+++Tests_Total;
+if ((passed = (conversions (large, 4, false, false, 4) &&
+			   conversions (large, 2, true, false, 3))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "multithreaded conversions" << endl;
+
+cout << endl << "--- In place" << endl;
+++Tests_Total;
+if ((passed = (conversions (cube, 2, false, true) &&
+			   conversions (cube, 3, false, true) &&
+			   conversions (thin, 4, false, true))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "all conversions in place" << endl;
+
+++Tests_Total;
+if ((passed = (conversions (cube, 4, true, true) &&
+			   conversions (large, 2, true, true, 4))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "byte reversal and threads in place" << endl;
+
+Interleave
+	interleave (cube, 2, Interleave::BSQ, Interleave::BIP);
+++Tests_Total;
+if ((passed = (interleave.scratch_size () < interleave.size () &&
+			   Interleave (cube, 2, Interleave::BIL, Interleave::BIL)
+					.scratch_size () == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "scratch storage is less than the image size" << endl;
+
+cout << endl << "--- Arguments" << endl;
+try
+	{
+	Interleave (cube, 0, Interleave::BSQ, Interleave::BIL);
+	passed = false;
+	}
+catch (invalid_argument&) {passed = true;}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "zero byte pixels are rejected" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
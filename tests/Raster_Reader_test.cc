@@ -0,0 +1,297 @@
+/*	Raster_Reader_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Raster_Reader.hh"
+using namespace PIRL;
+
+const char
+	*test_file = "Raster_Reader.test";
+
+const int
+	HEADER_BYTES	= 100;
+
+const Cube
+	IMAGE (0, 0, 37, 23, 5);
+
+typedef vector<unsigned short>	Pixels;
+
+
+//	The value of a pixel identifies its position.
+unsigned short
+pixel_value
+	(
+	unsigned int	sample,
+	unsigned int	line,
+	unsigned int	band
+	)
+{return (unsigned short)(sample + 64 * line + 4096 * band);}
+
+
+//	Writes the image, after a header, in an organization and byte order.
+void
+write_image
+	(
+	Interleave::Organization	organization,
+	Binary_IO::Data_Order		data_order
+	)
+{
+vector<unsigned char>
+	bytes (HEADER_BYTES + IMAGE.area () * IMAGE.Depth * 2, 0xFF);
+for (unsigned int
+		band = 0;
+		band < IMAGE.Depth;
+	  ++band)
+	for (unsigned int
+			line = 0;
+			line < IMAGE.Height;
+		  ++line)
+		for (unsigned int
+				sample = 0;
+				sample < IMAGE.Width;
+			  ++sample)
+			{
+			unsigned short
+				value = pixel_value (sample, line, band);
+			size_t
+				index = HEADER_BYTES + 2 * Interleave::pixel_index
+					(IMAGE, organization, sample, line, band);
+			bytes[index]     = (data_order == Binary_IO::MSB) ?
+				(value >> 8) : (value & 0xFF);
+			bytes[index + 1] = (data_order == Binary_IO::MSB) ?
+				(value & 0xFF) : (value >> 8);
+			}
+ofstream
+	file (test_file, ios::binary | ios::trunc);
+file.write ((const char*)bytes.data (), bytes.size ());
+}
+
+
+//	The expected pixels of a window in an organization.
+Pixels
+expected
+	(
+	const Cube&					window,
+	unsigned int				first_band,
+	Interleave::Organization	organization
+	)
+{
+Pixels
+	pixels (window.area () * window.Depth);
+for (unsigned int
+		band = 0;
+		band < window.Depth;
+	  ++band)
+	for (unsigned int
+			line = 0;
+			line < window.Height;
+		  ++line)
+		for (unsigned int
+				sample = 0;
+				sample < window.Width;
+			  ++sample)
+			pixels[Interleave::pixel_index
+				(window, organization, sample, line, band)]
+				= pixel_value (window.X + sample, window.Y + line,
+					first_band + band);
+return pixels;
+}
+
+
+//	Reads a window and compares it with the expected pixels.
+bool
+read_matches
+	(
+	const Raster_Reader&		reader,
+	const Cube&					window,
+	unsigned int				band,
+	Interleave::Organization	organization
+	)
+{
+Pixels
+	pixels (window.area () * window.Depth, 0);
+reader.read (window, band, pixels.data (), organization);
+return pixels == expected (window, band, organization);
+}
+
+
+unsigned long long
+range_bytes
+	(
+	const vector<Raster_Reader::Byte_Range>&	ranges
+	)
+{
+unsigned long long
+	bytes = 0;
+for (size_t
+		index = 0;
+		index < ranges.size ();
+	  ++index)
+	bytes += ranges[index].Bytes;
+return bytes;
+}
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+remove (test_file);
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Raster_Reader test" << endl
+	 << "    " << Raster_Reader::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0;
+
+const Cube
+	window (5, 3, 11, 7, 2),
+	whole_lines (0, 3, 37, 7, 2),
+	pixel (36, 22, 1, 1, 1);
+
+cout << endl << "--- Read" << endl;
+write_image (Interleave::BSQ, Binary_IO::MSB);
+{
+Raster_Reader
+	reader (test_file, IMAGE, 2, Binary_IO::MSB, Interleave::BSQ,
+		HEADER_BYTES);
+++Tests_Total;
+if ((passed = (read_matches (reader, window, 1, Interleave::BSQ) &&
+			   read_matches (reader, window, 3, Interleave::BIP) &&
+			   read_matches (reader, whole_lines, 0, Interleave::BIL) &&
+			   read_matches (reader, pixel, 4, Interleave::BSQ) &&
+			   read_matches (reader, IMAGE, 0, Interleave::BSQ))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "BSQ MSB windows" << endl;
+}
+
+write_image (Interleave::BIL, Binary_IO::LSB);
+{
+Raster_Reader
+	reader (test_file, IMAGE, 2, Binary_IO::LSB, Interleave::BIL,
+		HEADER_BYTES);
+++Tests_Total;
+if ((passed = (read_matches (reader, window, 1, Interleave::BIL) &&
+			   read_matches (reader, window, 2, Interleave::BSQ) &&
+			   read_matches (reader, whole_lines, 3, Interleave::BIP))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "BIL LSB windows" << endl;
+}
+
+write_image (Interleave::BIP, Binary_IO::MSB);
+Raster_Reader
+	reader (test_file, IMAGE, 2, Binary_IO::MSB, Interleave::BIP,
+		HEADER_BYTES);
+++Tests_Total;
+if ((passed = (read_matches (reader, window, 1, Interleave::BIP) &&
+			   read_matches (reader, window, 3, Interleave::BSQ) &&
+			   read_matches (reader.maximum_gap (0), window, 1, Interleave::BIL) &&
+			   read_matches (reader, IMAGE, 0, Interleave::BIP))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "BIP MSB windows, with and without gap coalescing" << endl;
+
+cout << endl << "--- Ranges" << endl;
+//	Without gaps only the window bytes are read.
+vector<Raster_Reader::Byte_Range>
+	exact = reader.ranges (window, 1),
+	whole = reader.ranges (Cube (0, 3, 37, 7, 5));
+reader.maximum_gap (Raster_Reader::DEFAULT_MAXIMUM_GAP);
+vector<Raster_Reader::Byte_Range>
+	coalesced = reader.ranges (window, 1);
+++Tests_Total;
+if ((passed = (exact.size () == window.area () &&
+			   range_bytes (exact) == reader.size (window) &&
+			   exact[0].Offset == HEADER_BYTES + ((3 * 37 + 5) * 5 + 1) * 2 &&
+			   whole.size () == 1 &&
+			   whole[0].Bytes == 37 * 7 * 5 * 2 &&
+			   coalesced.size () == 1 &&
+			   coalesced[0].Offset == exact[0].Offset &&
+			   coalesced[0].Offset + coalesced[0].Bytes
+			   	== exact.back ().Offset + exact.back ().Bytes)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "segments are joined and coalesced into ranges" << endl;
+
+cout << endl << "--- Errors" << endl;
+int
+	errors = 0;
+try {reader.ranges (Cube (30, 0, 8, 1, 1));}
+catch (out_of_range&) {++errors;}
+try {reader.ranges (window, 4);}
+catch (out_of_range&) {++errors;}
+try {Raster_Reader ("No.such.file", IMAGE, 2, Binary_IO::MSB,
+		Interleave::BSQ);}
+catch (runtime_error&) {++errors;}
+try {Raster_Reader (test_file, IMAGE, 0, Binary_IO::MSB, Interleave::BSQ);}
+catch (invalid_argument&) {++errors;}
+try
+	{
+	Pixels
+		pixels (IMAGE.area () * IMAGE.Depth);
+	Raster_Reader (test_file, IMAGE, 2, Binary_IO::MSB, Interleave::BSQ,
+		HEADER_BYTES + 1).read (IMAGE, 0, pixels.data ());
+	}
+catch (runtime_error&) {++errors;}
+++Tests_Total;
+if ((passed = (errors == 5 &&
+			   reader.ranges (Cube (1, 1, 0, 0, 0)).empty ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "windows outside the image, unreadable files and short files"
+	 << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	remove (test_file);
+	exit (-1);
+	}
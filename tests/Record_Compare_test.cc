@@ -0,0 +1,263 @@
+/*	Record_Compare_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <set>
+#include <stdexcept>
+using namespace std;
+
+#include "Record_Compare.hh"
+using namespace PIRL;
+
+enum
+	{
+	ORBIT,
+	TIME,
+	SEQUENCE
+	};
+
+static const Data_Block::Index
+	sizes[] = {4, 8, 2, 0};
+
+//	Each record has two bytes of padding.
+const int
+	RECORD_SIZE	= 16,
+	RECORDS		= 200003;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Record_Compare test" << endl
+	 << "    " << Record_Compare::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	record;
+
+Data_Block
+	layout;
+layout.element_sizes (sizes);
+layout.data_order (Data_Block::MSB);
+vector<unsigned char>
+	original (RECORDS * RECORD_SIZE, 0);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&original[record * RECORD_SIZE]);
+	int
+		orbit = record / 100;
+	double
+		time = record / 8.0;
+	unsigned short
+		sequence = (unsigned short)record;
+	layout.put (orbit, ORBIT);
+	layout.put (time, TIME);
+	layout.put (sequence, SEQUENCE);
+	}
+
+//	Change the time of every 97th record and the padding of every 5th.
+vector<unsigned char>
+	changed (original);
+Record_Scan::Selection
+	expected ((RECORDS + 63) / 64, 0);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&changed[record * RECORD_SIZE]);
+	if (record % 97 == 0)
+		{
+		double
+			time = -1.0;
+		layout.put (time, TIME);
+		expected[record / 64] |= Record_Scan::Selection_Word (1) << (record % 64);
+		}
+	if (record % 5 == 0)
+		changed[record * RECORD_SIZE + 15] = 0xFF;
+	}
+
+Record_Compare
+	compare (layout, RECORD_SIZE);
+compare.threads (1);
+
+cout << endl << "--- Differences" << endl;
+++Tests_Total;
+if ((passed = (compare.differing (&original[0], &changed[0], RECORDS)
+		== expected)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "records with changed elements differ, padding is skipped" << endl;
+
+compare.threads (4);
+++Tests_Total;
+if ((passed = (compare.differing (&original[0], &changed[0], RECORDS)
+		== expected)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "4 thread differing records match" << endl;
+
+Data_Block::Value_List
+	elements = compare.differences (&original[97 * RECORD_SIZE],
+		&changed[97 * RECORD_SIZE]);
+++Tests_Total;
+if ((passed = (elements.size () == 1 &&
+			   elements[0] == TIME &&
+			   compare.differences (&original[5 * RECORD_SIZE],
+					&changed[5 * RECORD_SIZE]).empty ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "differing elements" << endl;
+
+compare.ignore (TIME);
+++Tests_Total;
+if ((passed = (! compare.selected (TIME) &&
+			   compare.equal (&original[97 * RECORD_SIZE],
+					&changed[97 * RECORD_SIZE]) &&
+			   Record_Scan::count (compare.differing
+					(&original[0], &changed[0], RECORDS)) == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "ignored elements are not compared" << endl;
+compare.select_all ();
+
+cout << endl << "--- Hashes" << endl;
+vector<Record_Compare::Hash>
+	hashes (RECORDS),
+	changed_hashes (RECORDS);
+compare.hash (&original[0], RECORDS, &hashes[0]);
+compare.hash (&changed[0], RECORDS, &changed_hashes[0]);
+set<Record_Compare::Hash>
+	unique (hashes.begin (), hashes.end ());
+passed = (unique.size () == RECORDS);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	if (hashes[record] != compare.hash (&original[record * RECORD_SIZE]) ||
+		(hashes[record] == changed_hashes[record]) ==
+			Record_Scan::selected (expected, record))
+		passed = false;
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "hashes are distinct and change only with selected elements" << endl;
+
+++Tests_Total;
+if ((passed = (compare.hash (&original[0], 1) != hashes[0])))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "seeded hash" << endl;
+
+cout << endl << "--- Data order" << endl;
+//	Record 97 in LSB order.
+Data_Block
+	lsb_layout;
+lsb_layout.element_sizes (sizes);
+lsb_layout.data_order (Data_Block::LSB);
+vector<unsigned char>
+	lsb_record (RECORD_SIZE, 0);
+lsb_layout.data (&lsb_record[0]);
+{
+int
+	orbit = 97 / 100;
+double
+	time = 97 / 8.0;
+unsigned short
+	sequence = 97;
+lsb_layout.put (orbit, ORBIT);
+lsb_layout.put (time, TIME);
+lsb_layout.put (sequence, SEQUENCE);
+}
+Record_Compare
+	lsb_compare (lsb_layout, RECORD_SIZE);
+++Tests_Total;
+if ((passed = (lsb_record != vector<unsigned char> (&original[97 * RECORD_SIZE],
+					&original[98 * RECORD_SIZE]) &&
+			   lsb_compare.hash (&lsb_record[0]) == hashes[97] &&
+			   lsb_compare.hash (&lsb_record[0], 1)
+			   	== compare.hash (&original[97 * RECORD_SIZE], 1))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "a record has the same hash in MSB and LSB order" << endl;
+
+elements = compare.differences (&changed[97 * RECORD_SIZE], &lsb_record[0],
+	Data_Block::LSB);
+++Tests_Total;
+if ((passed = (compare.equal (&original[97 * RECORD_SIZE], &lsb_record[0],
+					Data_Block::LSB) &&
+			   ! compare.equal (&original[97 * RECORD_SIZE], &lsb_record[0]) &&
+			   lsb_compare.differences (&lsb_record[0],
+					&original[97 * RECORD_SIZE], Data_Block::MSB).empty () &&
+			   elements.size () == 1 &&
+			   elements[0] == TIME &&
+			   Record_Scan::count (compare.differing
+					(&original[97 * RECORD_SIZE], &lsb_record[0], 1,
+					Data_Block::LSB)) == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "records in different data orders are compared by value" << endl;
+
+cout << endl << "--- Invalid elements" << endl;
+++Tests_Total;
+try
+	{
+	compare.select (3);
+	passed = false;
+	}
+catch (out_of_range&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "select (3) throws out_of_range" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,190 @@
+/*	Record_File_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstdio>
+#include <stdexcept>
+using namespace std;
+
+#include "Record_File.hh"
+using namespace PIRL;
+
+enum
+	{
+	NUMBER,
+	VALUE
+	};
+
+static const Data_Block::Index
+	sizes[] = {4, 2, 0};
+
+const char
+	*test_file = "Record_File.test";
+
+const int
+	HEADER_SIZE	= 10,
+	RECORD_SIZE	= 8,
+	RECORDS		= 1000;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+remove (test_file);
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Record_File test" << endl
+	 << "    " << Record_File::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	record;
+
+//	Write an MSB test file: header, records, and a partial record.
+Data_Block
+	layout;
+layout.element_sizes (sizes);
+layout.data_order (Data_Block::MSB);
+unsigned char
+	buffer[RECORD_SIZE] = {0};
+ofstream
+	file (test_file, ios::binary);
+file.write ("HEADER....", HEADER_SIZE);
+layout.data (buffer);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	short
+		value = record * 3;
+	layout.put (record, NUMBER);
+	layout.put (value, VALUE);
+	file.write ((char*)buffer, RECORD_SIZE);
+	}
+file.write ((char*)buffer, RECORD_SIZE / 2);
+file.close ();
+
+cout << endl << "--- Mapping" << endl;
+Record_File
+	table (test_file, layout, HEADER_SIZE, RECORD_SIZE);
+++Tests_Total;
+if ((passed = (table.records () == RECORDS &&
+			   table.record_size () == RECORD_SIZE &&
+			   table.file_size () ==
+			   		HEADER_SIZE + (RECORDS * RECORD_SIZE) + RECORD_SIZE / 2)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "table.records () = " << table.records () << " - " << RECORDS << endl;
+
+cout << endl << "--- Random access" << endl;
+Data_Block
+	view = table.record (731);
+++Tests_Total;
+if ((passed = (view.get<int> (NUMBER) == 731 &&
+			   view.get<short> (VALUE) == 731 * 3 &&
+			   view.data () == table.record_data (731))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "record (731) = " << view.get<int> (NUMBER)
+	 << ", " << view.get<short> (VALUE) << " - 731, " << (731 * 3) << endl;
+
+++Tests_Total;
+try
+	{
+	table.record (RECORDS);
+	passed = false;
+	}
+catch (out_of_range&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "record (" << RECORDS << ") throws out_of_range" << endl;
+
+cout << endl << "--- Iteration" << endl;
+table.prefetch (0, RECORDS);
+long
+	total = 0,
+	expected = 0;
+for (Record_File::const_iterator
+		entry = table.begin ();
+		entry != table.end ();
+	  ++entry)
+	total += (*entry).get<short> (VALUE);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	expected += (short)(record * 3);
+++Tests_Total;
+if ((passed = (total == expected &&
+			   table.end () - table.begin () == RECORDS)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "sum of values = " << total << " - " << expected << endl;
+
+cout << endl << "--- Writable" << endl;
+{
+Record_File
+	writable (test_file, layout, HEADER_SIZE, RECORD_SIZE, true);
+record = -1;
+writable[5].put (record, NUMBER);
+}
+{
+Record_File
+	reread (test_file, layout, HEADER_SIZE, RECORD_SIZE);
+++Tests_Total;
+if ((passed = (reread[5].get<int> (NUMBER) == -1 &&
+			   reread[6].get<int> (NUMBER) == 6)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "written record (5) = " << reread[5].get<int> (NUMBER) << " - -1"
+	 << endl;
+}
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	remove (test_file);
+	exit (-1);
+	}
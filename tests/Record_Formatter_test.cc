@@ -0,0 +1,224 @@
+/*	Record_Formatter_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Record_Formatter.hh"
+using namespace PIRL;
+
+enum
+	{
+	ORBIT,
+	TIME,
+	GAIN,
+	FLAGS
+	};
+
+static const Data_Block::Index
+	sizes[] = {4, 8, 4, 1, 0};
+
+const int
+	RECORD_SIZE	= 17,
+	RECORDS		= 100003;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Record_Formatter test" << endl
+	 << "    " << Record_Formatter::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	record;
+char
+	line[128];
+
+//	MSB records with a signed orbit, a time, a pair of gains and flags.
+Data_Block
+	layout;
+layout.element_sizes (sizes);
+layout.count_of (GAIN, 2);
+layout.data_order (Data_Block::MSB);
+vector<unsigned char>
+	buffer (RECORDS * RECORD_SIZE);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&buffer[record * RECORD_SIZE]);
+	int
+		orbit = (record % 2000) - 1000;
+	double
+		time = (record % 4000) / 4.0;
+	short
+		gains[2] = {(short)(record % 300), (short)-(record % 7)};
+	unsigned char
+		flags = (unsigned char)record;
+	layout.put (orbit, ORBIT);
+	layout.put (time, TIME);
+	layout.put (gains, GAIN);
+	layout.put (flags, FLAGS);
+	}
+
+Record_Formatter
+	formatter (&buffer[0], RECORDS, layout, RECORD_SIZE);
+formatter.threads (1);
+
+cout << endl << "--- CSV" << endl;
+formatter
+	.field<int> (ORBIT)
+	.field<double> (TIME)
+	.field<short> (GAIN);
+string
+	expected;
+for (record = 0;
+	 record < 1000;
+   ++record)
+	{
+	snprintf (line, sizeof (line), "%d,%g,%d,%d\n",
+		(record % 2000) - 1000, (record % 4000) / 4.0,
+		record % 300, -(record % 7));
+	expected += line;
+	}
+++Tests_Total;
+if ((passed = (formatter.fields () == 4 &&
+			   formatter.text (0, 1000) == expected)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "shortest int, double and short array fields" << endl;
+if (! passed)
+	cout << formatter.text (0, 3);
+
+cout << endl << "--- TSV" << endl;
+formatter.clear ()
+	.delimiter ('\t')
+	.field<double> (TIME, Record_Formatter::FIXED, 3)
+	.field<unsigned int> (FLAGS, Record_Formatter::HEXADECIMAL);
+expected.clear ();
+for (record = 500;
+	 record < 600;
+   ++record)
+	{
+	snprintf (line, sizeof (line), "%.3f\t%x\n",
+		(record % 4000) / 4.0, record & 0xFF);
+	expected += line;
+	}
+++Tests_Total;
+if ((passed = (formatter.text (500, 100) == expected)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "fixed precision double and hexadecimal byte fields" << endl;
+if (! passed)
+	cout << formatter.text (500, 3);
+
+cout << endl << "--- Buffer" << endl;
+formatter.clear ()
+	.delimiter (',')
+	.field<int> (ORBIT);
+char
+	text[16];
+Record_Formatter::Record_Index
+	formatted;
+std::size_t
+	length = formatter.format (text, 14, 0, 10, &formatted);
+++Tests_Total;
+if ((passed = (formatted == 2 &&
+			   length == 11 &&
+			   string (text, length) == "-1000\n-999\n")))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "only whole lines are formatted" << endl;
+
+cout << endl << "--- Threads" << endl;
+formatter.clear ()
+	.field<int> (ORBIT)
+	.field<double> (TIME, Record_Formatter::SCIENTIFIC)
+	.field<short> (GAIN)
+	.field<unsigned char> (FLAGS);
+string
+	single = formatter.text ();
+formatter.threads (4);
+++Tests_Total;
+if ((passed = (formatter.text () == single)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "4 thread text matches single thread text" << endl;
+
+ostringstream
+	stream;
+formatter.write (stream);
+++Tests_Total;
+if ((passed = (stream.str () == single)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "written text matches" << endl;
+
+cout << endl << "--- Invalid fields" << endl;
+++Tests_Total;
+try
+	{
+	formatter.field<int> (4);
+	passed = false;
+	}
+catch (out_of_range&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "field (4) throws out_of_range" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,235 @@
+/*	Record_Scan_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Record_Scan.hh"
+using namespace PIRL;
+
+enum
+	{
+	NUMBER,
+	VALUE,
+	VAX,
+	OFFSET
+	};
+
+static const Data_Block::Index
+	sizes[] = {4, 4, 4, 2, 0};
+
+const int
+	RECORD_SIZE	= 16,
+	RECORDS		= 300007;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Record_Scan test" << endl
+	 << "    " << Record_Scan::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	record;
+
+//	MSB records, with VAX real and signed 2-byte integer elements.
+Data_Block
+	layout;
+layout.element_sizes (sizes);
+layout.data_order (Data_Block::MSB);
+layout.value_format (VAX, Data_Block::VAX_REAL);
+layout.value_format (OFFSET, Data_Block::SIGNED_INTEGER);
+vector<unsigned char>
+	buffer (RECORDS * RECORD_SIZE);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&buffer[record * RECORD_SIZE]);
+	int
+		number = ((record % 1000) * 7919) % 1000;
+	float
+		value = (float)(record % 500) / 10.0f;
+	layout.put (number, NUMBER);
+	layout.put (value, VALUE);
+	layout.put (value, VAX);
+	short
+		offset = (short)(record % 201 - 100);
+	layout.put (offset, OFFSET);
+	}
+
+//	The expected selections, one record at a time.
+vector<Record_Scan::Record_Index>
+	greater,
+	in_range,
+	combined;
+Record_Scan::Record_Index
+	negative = 0;
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&buffer[record * RECORD_SIZE]);
+	int
+		number = layout.get<int> (NUMBER);
+	float
+		value = layout.get<float> (VALUE);
+	if (number > 900)
+		greater.push_back (record);
+	if (value >= 10.0f && value <= 20.0f)
+		in_range.push_back (record);
+	if ((number > 900 && value >= 10.0f && value <= 20.0f) ||
+		layout.get<int> (OFFSET) == 100)
+		combined.push_back (record);
+	if (layout.get<int> (OFFSET) < 0)
+		++negative;
+	}
+
+Record_Scan
+	scan (&buffer[0], RECORDS, layout, RECORD_SIZE);
+scan.threads (1);
+
+cout << endl << "--- Comparisons" << endl;
+scan.where (NUMBER, Record_Scan::GREATER, 900);
+++Tests_Total;
+if ((passed = (scan.indices () == greater)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "NUMBER > 900 selected " << scan.indices ().size ()
+	 << " - " << greater.size () << endl;
+
+scan.clear ().where (VALUE, Record_Scan::IN_RANGE, 10.0f, 20.0f);
+++Tests_Total;
+if ((passed = (scan.indices () == in_range)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "VALUE in [10, 20] selected " << scan.indices ().size ()
+	 << " - " << in_range.size () << endl;
+
+scan.clear ().where (VAX, Record_Scan::IN_RANGE, 10.0, 20.0);
+++Tests_Total;
+if ((passed = (scan.indices () == in_range)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "VAX in [10, 20] selected " << scan.indices ().size ()
+	 << " - " << in_range.size () << endl;
+
+scan.clear ().where (OFFSET, Record_Scan::LESS, 0);
+++Tests_Total;
+if ((passed = (Record_Scan::count (scan.select ()) == negative)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "OFFSET < 0 selected " << Record_Scan::count (scan.select ())
+	 << " - " << negative << endl;
+
+cout << endl << "--- Combinations" << endl;
+scan.clear ()
+	.where (NUMBER, Record_Scan::GREATER, 900)
+	.where (VALUE, Record_Scan::IN_RANGE, 10.0f, 20.0f)
+	.or_where (OFFSET, Record_Scan::EQUAL, 100);
+++Tests_Total;
+if ((passed = (scan.indices () == combined)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "NUMBER > 900 AND VALUE in [10, 20] OR OFFSET == 100 selected "
+	 << scan.indices ().size () << " - " << combined.size () << endl;
+
+cout << endl << "--- Threads" << endl;
+Record_Scan::Selection
+	single = scan.select ();
+scan.threads (4);
+++Tests_Total;
+if ((passed = (scan.select () == single)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "4 thread selection matches 1 thread selection" << endl;
+
+cout << endl << "--- No predicates" << endl;
+scan.clear ();
+Record_Scan::Selection
+	all = scan.select ();
+++Tests_Total;
+if ((passed = (Record_Scan::count (all) == (Record_Scan::Record_Index)RECORDS &&
+			   Record_Scan::selected (all, RECORDS - 1))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "all records selected = " << Record_Scan::count (all)
+	 << " - " << RECORDS << endl;
+
+cout << endl << "--- Invalid predicates" << endl;
+++Tests_Total;
+try
+	{
+	scan.where (5, Record_Scan::EQUAL, 0);
+	passed = false;
+	}
+catch (out_of_range&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "where (5, ...) throws out_of_range" << endl;
+
+++Tests_Total;
+try
+	{
+	scan.where (VALUE, Record_Scan::EQUAL, 0.0);
+	passed = false;
+	}
+catch (invalid_argument&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "double compare of a 4 byte element throws invalid_argument" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,272 @@
+/*	Record_Sort_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+using namespace std;
+
+#include "Record_Sort.hh"
+#include "Record_File.hh"
+using namespace PIRL;
+
+enum
+	{
+	ORBIT,
+	TIME,
+	SEQUENCE
+	};
+
+static const Data_Block::Index
+	sizes[] = {4, 8, 2, 0};
+
+const int
+	RECORD_SIZE	= 14,
+	RECORDS		= 150001;
+
+Data_Block
+	layout;
+vector<unsigned char>
+	buffer (RECORDS * RECORD_SIZE);
+
+int
+orbit_of (Record_Sort::Record_Index record)
+{
+layout.data (&buffer[record * RECORD_SIZE]);
+return layout.get<int> (ORBIT);
+}
+
+double
+time_of (Record_Sort::Record_Index record)
+{
+layout.data (&buffer[record * RECORD_SIZE]);
+return layout.get<double> (TIME);
+}
+
+//	Orbit descending, then time ascending.
+bool
+orbit_time_order
+	(
+	Record_Sort::Record_Index	first,
+	Record_Sort::Record_Index	second
+	)
+{
+int
+	first_orbit = orbit_of (first),
+	second_orbit = orbit_of (second);
+if (first_orbit != second_orbit)
+	return first_orbit > second_orbit;
+return time_of (first) < time_of (second);
+}
+
+bool
+time_order
+	(
+	Record_Sort::Record_Index	first,
+	Record_Sort::Record_Index	second
+	)
+{return time_of (first) < time_of (second);}
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Record_Sort test" << endl
+	 << "    " << Record_Sort::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	record;
+
+//	MSB records with a signed orbit, a signed time and a sequence number.
+layout.element_sizes (sizes);
+layout.data_order (Data_Block::MSB);
+srand (35);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&buffer[record * RECORD_SIZE]);
+	int
+		orbit = (rand () % 200) - 100;
+	double
+		time = ((rand () % 20000) - 10000) / 8.0;
+	unsigned short
+		sequence = (unsigned short)record;
+	layout.put (orbit, ORBIT);
+	layout.put (time, TIME);
+	layout.put (sequence, SEQUENCE);
+	}
+
+vector<Record_Sort::Record_Index>
+	expected (RECORDS);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	expected[record] = record;
+
+Record_Sort
+	sorter (&buffer[0], RECORDS, layout, RECORD_SIZE);
+sorter.threads (1);
+
+cout << endl << "--- Single key" << endl;
+sorter.key<double> (TIME);
+stable_sort (expected.begin (), expected.end (), time_order);
+++Tests_Total;
+if ((passed = (sorter.permutation () == expected)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "stable ascending double permutation" << endl;
+
+cout << endl << "--- Multiple keys" << endl;
+sorter.clear ()
+	.key<int> (ORBIT, Record_Sort::DESCENDING)
+	.key<double> (TIME);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	expected[record] = record;
+stable_sort (expected.begin (), expected.end (), orbit_time_order);
+vector<Record_Sort::Record_Index>
+	order = sorter.permutation ();
+++Tests_Total;
+if ((passed = (order == expected)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "descending int, ascending double permutation" << endl;
+
+cout << endl << "--- Threads" << endl;
+sorter.threads (4);
+++Tests_Total;
+if ((passed = (sorter.permutation () == expected)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "4 thread permutation matches" << endl;
+
+cout << endl << "--- In place" << endl;
+sorter.sort ();
+passed = true;
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&buffer[record * RECORD_SIZE]);
+	if (layout.get<unsigned short> (SEQUENCE) !=
+			(unsigned short)expected[record])
+		{
+		passed = false;
+		break;
+		}
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "sorted records are in permutation order" << endl;
+
+cout << endl << "--- Invalid keys" << endl;
+++Tests_Total;
+try
+	{
+	sorter.key<int> (3);
+	passed = false;
+	}
+catch (out_of_range&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "key (3) throws out_of_range" << endl;
+
+++Tests_Total;
+try
+	{
+	sorter.key<float> (TIME);
+	passed = false;
+	}
+catch (invalid_argument&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "float key of an 8 byte element throws invalid_argument" << endl;
+
+cout << endl << "--- Read-only file" << endl;
+const char
+	*test_file = "Record_Sort.test";
+{
+ofstream
+	file (test_file, ios::binary | ios::trunc);
+file.write ((const char*)buffer.data (), 1000 * RECORD_SIZE);
+}
+{
+Record_File
+	records (test_file, layout, 0, RECORD_SIZE);
+Record_Sort
+	file_sorter (records);
+file_sorter.key<int> (ORBIT);
+++Tests_Total;
+try
+	{
+	file_sorter.sort ();
+	passed = false;
+	}
+catch (logic_error&)
+	{passed = file_sorter.permutation ().size () == 1000;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "sort of a read-only Record_File throws logic_error" << endl;
+}
+remove (test_file);
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,214 @@
+/*	Record_Statistics_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Record_Statistics.hh"
+using namespace PIRL;
+
+enum
+	{
+	NUMBER,
+	COUNT,
+	VALUE
+	};
+
+static const Data_Block::Index
+	sizes[] = {4, 2, 8, 0};
+
+const int
+	RECORD_SIZE	= 14,
+	RECORDS		= 200003;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Record_Statistics test" << endl
+	 << "    " << Record_Statistics::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	record;
+
+//	MSB records with a signed integer, an unsigned short and a double.
+Data_Block
+	layout;
+layout.element_sizes (sizes);
+layout.data_order (Data_Block::MSB);
+layout.value_format (NUMBER, Data_Block::SIGNED_INTEGER);
+vector<unsigned char>
+	buffer (RECORDS * RECORD_SIZE);
+long long
+	number_sum = 0;
+int
+	number_minimum = 0,
+	number_maximum = 0,
+	values = 0;
+vector<Record_Statistics::Record_Index>
+	bins (10, 0);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&buffer[record * RECORD_SIZE]);
+	int
+		number = (record % 2001) - 1000;
+	unsigned short
+		count = (unsigned short)(60000 + record % 5000);
+	double
+		value = (record % 7) ?
+			(double)(record % 100) : numeric_limits<double>::quiet_NaN ();
+	layout.put (number, NUMBER);
+	layout.put (count, COUNT);
+	layout.put (value, VALUE);
+	number_sum += number;
+	number_minimum = min (number_minimum, number);
+	number_maximum = max (number_maximum, number);
+	if (value == value)
+		{
+		++values;
+		++bins[(int)value / 10];
+		}
+	}
+
+Record_Statistics
+	statistics (&buffer[0], RECORDS, layout, RECORD_SIZE);
+statistics
+	.column<int> (NUMBER)
+	.column<unsigned short> (COUNT)
+	.column<double> (VALUE, 0.0, 100.0, 10);
+statistics.threads (1);
+vector<Record_Statistics::Statistics>
+	results = statistics.accumulate ();
+
+cout << endl << "--- Signed integer" << endl;
+++Tests_Total;
+if ((passed = (results[0].Count == (Record_Statistics::Record_Index)RECORDS &&
+			   results[0].Minimum == number_minimum &&
+			   results[0].Maximum == number_maximum &&
+			   results[0].Sum == (double)number_sum)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "NUMBER min, max, sum = "
+	 << results[0].Minimum << ", " << results[0].Maximum << ", "
+	 << results[0].Sum << " - "
+	 << number_minimum << ", " << number_maximum << ", " << number_sum
+	 << endl;
+
+cout << endl << "--- Unsigned short" << endl;
+++Tests_Total;
+if ((passed = (results[1].Minimum == 60000 &&
+			   results[1].Maximum == 64999)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "COUNT min, max = "
+	 << results[1].Minimum << ", " << results[1].Maximum
+	 << " - 60000, 64999" << endl;
+
+cout << endl << "--- Double with NaN values and histogram" << endl;
+++Tests_Total;
+if ((passed = (results[2].Count == (Record_Statistics::Record_Index)values &&
+			   results[2].Bins == bins &&
+			   results[2].Below == 0 &&
+			   results[2].Above == 0 &&
+			   results[2].Minimum == 0.0 &&
+			   results[2].Maximum == 99.0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "VALUE count = " << results[2].Count << " - " << values
+	 << ", bins[0] = " << results[2].Bins[0] << " - " << bins[0] << endl;
+
+cout << endl << "--- Threads" << endl;
+statistics.threads (3);
+vector<Record_Statistics::Statistics>
+	threaded = statistics.accumulate ();
+++Tests_Total;
+if ((passed = (threaded[0].Sum == results[0].Sum &&
+			   threaded[1].Minimum == results[1].Minimum &&
+			   threaded[2].Count == results[2].Count &&
+			   threaded[2].Bins == results[2].Bins &&
+			   fabs (threaded[2].mean () - results[2].mean ()) < 1e-9)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "3 thread statistics match 1 thread statistics" << endl;
+
+cout << endl << "--- Invalid columns" << endl;
+++Tests_Total;
+try
+	{
+	statistics.column<int> (3);
+	passed = false;
+	}
+catch (out_of_range&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "column (3) throws out_of_range" << endl;
+
+++Tests_Total;
+try
+	{
+	statistics.column<double> (VALUE, 1.0, 1.0, 10);
+	passed = false;
+	}
+catch (invalid_argument&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "empty histogram range throws invalid_argument" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,225 @@
+/*	Record_Stream_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <sstream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Record_Stream.hh"
+using namespace PIRL;
+
+enum
+	{
+	ORBIT,
+	TIME,
+	SEQUENCE
+	};
+
+static const Data_Block::Index
+	sizes[] = {4, 8, 2, 0};
+
+const int
+	RECORD_SIZE	= 14,
+	RECORDS		= 10007,
+	MARGIN		= 3;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+//	Checks that a record has the values of a record number.
+bool
+is_record
+	(
+	const Data_Block&	record,
+	int					number
+	)
+{
+return
+	record.get<int> (ORBIT) == number / 10 &&
+	record.get<double> (TIME) == number / 4.0 &&
+	record.get<unsigned short> (SEQUENCE) == (unsigned short)number;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Record_Stream test" << endl
+	 << "    " << Record_Stream::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	record;
+
+//	MSB records followed by a partial record.
+Data_Block
+	layout;
+layout.element_sizes (sizes);
+layout.data_order (Data_Block::MSB);
+vector<unsigned char>
+	buffer (RECORDS * RECORD_SIZE + 5);
+for (record = 0;
+	 record < RECORDS;
+   ++record)
+	{
+	layout.data (&buffer[record * RECORD_SIZE]);
+	int
+		orbit = record / 10;
+	double
+		time = record / 4.0;
+	unsigned short
+		sequence = (unsigned short)record;
+	layout.put (orbit, ORBIT);
+	layout.put (time, TIME);
+	layout.put (sequence, SEQUENCE);
+	}
+string
+	contents (buffer.begin (), buffer.end ());
+
+cout << endl << "--- Next" << endl;
+{
+istringstream
+	source (contents);
+Record_Stream
+	stream (source, layout, RECORD_SIZE, MARGIN, 7);
+bool
+	in_place = true,
+	look_back = true;
+passed = true;
+while (stream.next ())
+	{
+	const Data_Block&
+		current = stream.record ();
+	record = (int)stream.records_consumed () - 1;
+	if (! is_record (current, record))
+		passed = false;
+	if (current.data () < (unsigned char*)stream.cache ().start () ||
+		current.data () + RECORD_SIZE >
+			(unsigned char*)stream.cache ().last ())
+		in_place = false;
+	for (int
+			back = 0;
+			back <= MARGIN && back <= record;
+		  ++back)
+		if (! is_record (stream.record (back), record - back))
+			look_back = false;
+	}
+++Tests_Total;
+if ((passed = (passed &&
+			   stream.records_consumed () == RECORDS)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "all whole records are read in order" << endl;
+
+++Tests_Total;
+if ((passed = in_place))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "record views are in the cache storage" << endl;
+
+++Tests_Total;
+if ((passed = look_back))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "margin records remain valid for look-back" << endl;
+
+++Tests_Total;
+try
+	{
+	stream.record (MARGIN + 1);
+	passed = false;
+	}
+catch (out_of_range&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "record (" << (MARGIN + 1) << ") throws out_of_range" << endl;
+}
+
+cout << endl << "--- Peek" << endl;
+{
+istringstream
+	source (contents);
+Record_Stream
+	stream (source, layout, RECORD_SIZE, MARGIN, 64);
+Record_Stream::Record_Index
+	available,
+	total = 0;
+passed = true;
+while ((available = stream.peek (1000)))
+	{
+	Data_Block
+		view (layout);
+	for (Record_Stream::Record_Index
+			index = 0;
+			index < available;
+		  ++index)
+		{
+		view.data ((void*)(stream.records () + index * RECORD_SIZE));
+		if (! is_record (view, (int)(total + index)))
+			passed = false;
+		}
+	if (available < 1000 &&
+		total + available != RECORDS)
+		passed = false;
+	total += stream.advance (available);
+	}
+++Tests_Total;
+if ((passed = (passed &&
+			   total == RECORDS &&
+			   is_record (stream.record (), RECORDS - 1) &&
+			   is_record (stream.record (MARGIN), RECORDS - 1 - MARGIN))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "batches larger than the cache batch are read in place" << endl;
+}
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,325 @@
+/*	Rectangle_Index_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+using namespace std;
+
+#include "Rectangle_Index.hh"
+using namespace PIRL;
+
+typedef Rectangle_Index<int>	Index;
+
+const int
+	FOOTPRINTS	= 20000,
+	INSERTS		= 500,
+	REMOVES		= 300,
+	QUERIES		= 200,
+	EXTENT		= 10000;
+
+//	A deterministic pseudo-random sequence.
+unsigned int
+	Seed = 12345;
+
+int
+random_value
+	(
+	int		limit
+	)
+{
+Seed = Seed * 1103515245 + 12345;
+return (int)((Seed >> 8) % (unsigned int)limit);
+}
+
+
+Rectangle
+random_rectangle ()
+{
+//	Some are empty.
+return Rectangle (random_value (EXTENT) - 100, random_value (EXTENT) - 100,
+	random_value (300), random_value (300));
+}
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+/*	Tests that the index overlap queries match a linear scan using the
+	Rectangle intersection operator.
+*/
+bool
+overlaps_match
+	(
+	const Index&				index,
+	const vector<Rectangle>&	rectangles,
+	const vector<bool>&			present
+	)
+{
+for (int
+		query = 0;
+		query < QUERIES;
+	  ++query)
+	{
+	Rectangle
+		area (random_value (EXTENT), random_value (EXTENT),
+			random_value (600) + 1, random_value (600) + 1);
+	vector<Index::Identifier>
+		found = index.overlapping (area),
+		expected;
+	for (Index::Identifier
+			identifier = 0;
+			identifier < rectangles.size ();
+		  ++identifier)
+		{
+		Rectangle
+			overlap (rectangles[identifier]);
+		overlap &= area;
+		if (present[identifier] &&
+			! overlap.is_empty ())
+			expected.push_back (identifier);
+		}
+	sort (found.begin (), found.end ());
+	if (found != expected)
+		return false;
+	}
+return true;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Rectangle_Index test" << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	entry;
+
+vector<pair<Rectangle, int> >
+	footprints;
+vector<Rectangle>
+	rectangles;
+for (entry = 0;
+	 entry < FOOTPRINTS;
+   ++entry)
+	{
+	rectangles.push_back (random_rectangle ());
+	footprints.push_back (make_pair (rectangles.back (), entry));
+	}
+vector<bool>
+	present (FOOTPRINTS, true);
+
+cout << endl << "--- Bulk load" << endl;
+Index
+	index (footprints.begin (), footprints.end ());
+++Tests_Total;
+if ((passed = (index.size () == FOOTPRINTS &&
+			   overlaps_match (index, rectangles, present))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "overlapping matches a linear scan" << endl;
+
+cout << endl << "--- Insert and remove" << endl;
+for (entry = 0;
+	 entry < INSERTS;
+   ++entry)
+	{
+	rectangles.push_back (random_rectangle ());
+	present.push_back (true);
+	if (index.insert (rectangles.back (), FOOTPRINTS + entry)
+			!= rectangles.size () - 1)
+		{
+		cout << "Unexpected identifier for insert " << entry << endl;
+		exit (1);
+		}
+	}
+for (entry = 0;
+	 entry < REMOVES;
+   ++entry)
+	{
+	Index::Identifier
+		identifier = random_value ((int)rectangles.size ());
+	if (index.remove (identifier) != present[identifier])
+		{
+		cout << "Unexpected remove result for " << identifier << endl;
+		exit (1);
+		}
+	present[identifier] = false;
+	}
+size_t
+	live = count_if (present.begin (), present.end (),
+		[] (bool is_present) {return is_present;});
+++Tests_Total;
+if ((passed = (index.size () == live &&
+			   overlaps_match (index, rectangles, present))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "overlapping matches after inserts and removes" << endl;
+
+index.rebuild ();
+passed = overlaps_match (index, rectangles, present);
+for (Index::Identifier
+		identifier = 0;
+		identifier < rectangles.size ();
+	  ++identifier)
+	if (index.valid (identifier) != present[identifier] ||
+		(present[identifier] &&
+		 (index.value (identifier) != (int)identifier ||
+		  index.rectangle (identifier) != rectangles[identifier])))
+		passed = false;
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "identifiers are kept by rebuild" << endl;
+
+cout << endl << "--- Containing" << endl;
+passed = true;
+for (entry = 0;
+	 entry < QUERIES;
+   ++entry)
+	{
+	Point_2D
+		point (random_value (EXTENT), random_value (EXTENT));
+	vector<Index::Identifier>
+		found = index.containing (point),
+		expected;
+	for (Index::Identifier
+			identifier = 0;
+			identifier < rectangles.size ();
+		  ++identifier)
+		{
+		const Rectangle
+			&rectangle = rectangles[identifier];
+		if (present[identifier] &&
+			rectangle.X <= point.X &&
+			point.X < rectangle.X + (int)rectangle.Width &&
+			rectangle.Y <= point.Y &&
+			point.Y < rectangle.Y + (int)rectangle.Height)
+			expected.push_back (identifier);
+		}
+	sort (found.begin (), found.end ());
+	if (found != expected)
+		passed = false;
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "containing a point matches a linear scan" << endl;
+
+cout << endl << "--- Nearest" << endl;
+passed = true;
+for (entry = 0;
+	 entry < QUERIES;
+   ++entry)
+	{
+	Point_2D
+		point (random_value (EXTENT + 2000) - 1000,
+			random_value (EXTENT + 2000) - 1000);
+	vector<double>
+		distances;
+	for (Index::Identifier
+			identifier = 0;
+			identifier < rectangles.size ();
+		  ++identifier)
+		{
+		if (! present[identifier])
+			continue;
+		const Rectangle
+			&rectangle = rectangles[identifier];
+		double
+			x = max (max (rectangle.X - point.X,
+				point.X - (rectangle.X + (int)rectangle.Width)), 0),
+			y = max (max (rectangle.Y - point.Y,
+				point.Y - (rectangle.Y + (int)rectangle.Height)), 0);
+		distances.push_back (sqrt (x * x + y * y));
+		}
+	sort (distances.begin (), distances.end ());
+	vector<Index::Identifier>
+		nearest = index.nearest (point, 5);
+	if (nearest.size () != 5)
+		passed = false;
+	else
+		for (unsigned int
+				found = 0;
+				found < nearest.size ();
+			  ++found)
+			{
+			const Rectangle
+				&rectangle = rectangles[nearest[found]];
+			double
+				x = max (max (rectangle.X - point.X,
+					point.X - (rectangle.X + (int)rectangle.Width)), 0),
+				y = max (max (rectangle.Y - point.Y,
+					point.Y - (rectangle.Y + (int)rectangle.Height)), 0);
+			if (! present[nearest[found]] ||
+				sqrt (x * x + y * y) != distances[found])
+				passed = false;
+			}
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "nearest rectangles in order of distance" << endl;
+
+cout << endl << "--- Empty" << endl;
+index.clear ();
+++Tests_Total;
+if ((passed = (index.empty () &&
+			   index.overlapping (Rectangle (0, 0, EXTENT, EXTENT)).empty () &&
+			   index.nearest (Point_2D (0, 0)).empty () &&
+			   ! index.remove (0))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "a cleared index finds nothing" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,279 @@
+/*	Rectangle_Set_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Rectangle_Set.hh"
+using namespace PIRL;
+
+const int
+	RECTANGLES	= 10007,
+	EXTENT		= 1000;
+
+//	A deterministic pseudo-random sequence.
+unsigned int
+	Seed = 54321;
+
+int
+random_value
+	(
+	int		limit
+	)
+{
+Seed = Seed * 1103515245 + 12345;
+return (int)((Seed >> 8) % (unsigned int)limit);
+}
+
+
+Rectangle
+random_rectangle ()
+{
+//	Some are empty.
+return Rectangle (random_value (EXTENT) - EXTENT / 2,
+	random_value (EXTENT) - EXTENT / 2,
+	random_value (EXTENT / 4), random_value (EXTENT / 4));
+}
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Rectangle_Set test" << endl
+	 << "    " << Rectangle_Set::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	index;
+
+vector<Rectangle>
+	rectangles,
+	others;
+for (index = 0;
+	 index < RECTANGLES;
+   ++index)
+	{
+	rectangles.push_back (random_rectangle ());
+	others.push_back (random_rectangle ());
+	}
+Rectangle
+	viewport (-100, -50, 300, 200);
+Rectangle_Set
+	set (rectangles),
+	other_set (others),
+	result;
+Rectangle_Set::Mask
+	mask;
+
+cout << endl << "--- Intersection and union" << endl;
+result = set;
+result &= viewport;
+passed = (result.size () == RECTANGLES);
+for (index = 0;
+	 index < RECTANGLES;
+   ++index)
+	{
+	Rectangle
+		expected (rectangles[index]);
+	expected &= viewport;
+	if (result[index] != expected)
+		passed = false;
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "intersection with a rectangle matches operator&=" << endl;
+
+result = set;
+result &= other_set;
+passed = true;
+for (index = 0;
+	 index < RECTANGLES;
+   ++index)
+	{
+	Rectangle
+		expected (rectangles[index]);
+	expected &= others[index];
+	if (result[index] != expected)
+		passed = false;
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "pairwise intersection matches operator&=" << endl;
+
+result = set;
+result |= viewport;
+Rectangle_Set
+	pairwise (set);
+pairwise |= other_set;
+passed = true;
+for (index = 0;
+	 index < RECTANGLES;
+   ++index)
+	{
+	Rectangle
+		expected (rectangles[index]),
+		expected_pair (rectangles[index]);
+	expected |= viewport;
+	expected_pair |= others[index];
+	if (result[index] != expected ||
+		pairwise[index] != expected_pair)
+		passed = false;
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "union matches operator|=" << endl;
+
+cout << endl << "--- Masks" << endl;
+Rectangle_Set::Mask
+	contains_mask,
+	within_mask,
+	pair_mask;
+Point_2D
+	point (10, 20);
+Rectangle_Set::size_type
+	overlapping = set.overlaps (viewport, mask),
+	containing = set.contains (point, contains_mask),
+	inside = set.within (viewport, within_mask),
+	pairs = set.overlaps (other_set, pair_mask),
+	expected_overlapping = 0,
+	expected_containing = 0,
+	expected_inside = 0,
+	expected_pairs = 0;
+passed = (mask.size () == RECTANGLES);
+for (index = 0;
+	 index < RECTANGLES;
+   ++index)
+	{
+	Rectangle
+		overlap (rectangles[index]),
+		pair_overlap (rectangles[index]);
+	overlap &= viewport;
+	pair_overlap &= others[index];
+	const Rectangle
+		&rectangle = rectangles[index];
+	bool
+		overlaps = ! overlap.is_empty (),
+		pair_overlaps = ! pair_overlap.is_empty (),
+		contains =
+			rectangle.X <= point.X &&
+			point.X < rectangle.X + (int)rectangle.Width &&
+			rectangle.Y <= point.Y &&
+			point.Y < rectangle.Y + (int)rectangle.Height,
+		within =
+			viewport.X <= rectangle.X &&
+			rectangle.X + (int)rectangle.Width
+				<= viewport.X + (int)viewport.Width &&
+			viewport.Y <= rectangle.Y &&
+			rectangle.Y + (int)rectangle.Height
+				<= viewport.Y + (int)viewport.Height;
+	expected_overlapping += overlaps;
+	expected_pairs += pair_overlaps;
+	expected_containing += contains;
+	expected_inside += within;
+	if (mask[index] != overlaps ||
+		pair_mask[index] != pair_overlaps ||
+		contains_mask[index] != contains ||
+		within_mask[index] != within)
+		passed = false;
+	}
+++Tests_Total;
+if ((passed = (passed &&
+			   overlapping == expected_overlapping &&
+			   pairs == expected_pairs &&
+			   containing == expected_containing &&
+			   inside == expected_inside &&
+			   overlapping && containing && inside)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "overlaps, contains and within masks and counts" << endl;
+
+vector<unsigned long long>
+	areas;
+unsigned long long
+	total = set.areas (areas),
+	expected_total = 0;
+passed = (areas.size () == RECTANGLES);
+for (index = 0;
+	 index < RECTANGLES;
+   ++index)
+	{
+	expected_total += rectangles[index].area ();
+	if (areas[index] != rectangles[index].area ())
+		passed = false;
+	}
+++Tests_Total;
+if ((passed = (passed && total == expected_total)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "areas" << endl;
+
+cout << endl << "--- Invalid sets" << endl;
+++Tests_Total;
+try
+	{
+	result.resize (RECTANGLES - 1);
+	result &= set;
+	passed = false;
+	}
+catch (invalid_argument&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "sets of different sizes throw invalid_argument" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
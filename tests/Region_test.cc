@@ -0,0 +1,287 @@
+/*	Region_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Region.hh"
+using namespace PIRL;
+
+//	Rectangles are in a square area with a margin on each side.
+const int
+	RECTANGLES	= 300,
+	EXTENT		= 120,
+	MARGIN		= 10,
+	SIDE		= EXTENT + 2 * MARGIN;
+
+//	A deterministic pseudo-random sequence.
+unsigned int
+	Seed = 2468;
+
+int
+random_value
+	(
+	int		limit
+	)
+{
+Seed = Seed * 1103515245 + 12345;
+return (int)((Seed >> 8) % (unsigned int)limit);
+}
+
+
+Rectangle
+random_rectangle ()
+{
+return Rectangle (random_value (EXTENT - 20) - MARGIN / 2,
+	random_value (EXTENT - 20) - MARGIN / 2,
+	random_value (20), random_value (20));
+}
+
+
+//	A pixel map of the area.
+typedef vector<int>		Pixels;
+
+void
+paint
+	(
+	Pixels&				pixels,
+	const Rectangle&	rectangle
+	)
+{
+for (int
+		y = rectangle.Y;
+		y < rectangle.Y + (int)rectangle.Height;
+	  ++y)
+	for (int
+			x = rectangle.X;
+			x < rectangle.X + (int)rectangle.Width;
+		  ++x)
+		++pixels[(y + MARGIN) * SIDE + x + MARGIN];
+}
+
+
+//	Tests that a Region covers exactly the set pixels.
+bool
+matches
+	(
+	const Region&	region,
+	const Pixels&	pixels
+	)
+{
+Pixels
+	covered (SIDE * SIDE, 0);
+vector<Rectangle>
+	rectangles = region.rectangles ();
+for (vector<Rectangle>::const_iterator
+		rectangle = rectangles.begin ();
+		rectangle != rectangles.end ();
+	  ++rectangle)
+	paint (covered, *rectangle);
+unsigned long long
+	area = 0;
+for (int
+		pixel = 0;
+		pixel < SIDE * SIDE;
+	  ++pixel)
+	{
+	//	Each pixel is in at most one of the Region Rectangles.
+	if (covered[pixel] != (pixels[pixel] ? 1 : 0))
+		return false;
+	area += covered[pixel];
+	}
+return area == region.area ();
+}
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Region test" << endl
+	 << "    " << Region::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	index;
+
+vector<Rectangle>
+	rectangles,
+	others;
+Pixels
+	pixels (SIDE * SIDE, 0),
+	other_pixels (SIDE * SIDE, 0);
+for (index = 0;
+	 index < RECTANGLES;
+   ++index)
+	{
+	rectangles.push_back (random_rectangle ());
+	paint (pixels, rectangles.back ());
+	others.push_back (random_rectangle ());
+	paint (other_pixels, others.back ());
+	}
+
+cout << endl << "--- Construction" << endl;
+Region
+	region (rectangles),
+	other (others);
+++Tests_Total;
+if ((passed = (matches (region, pixels) &&
+			   matches (other, other_pixels))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "sweep line Region covers the union of the rectangles" << endl;
+
+Region
+	incremental;
+for (index = 0;
+	 index < RECTANGLES;
+   ++index)
+	incremental |= rectangles[index];
+++Tests_Total;
+if ((passed = (incremental == region &&
+			   incremental.size () == region.size ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "adding one rectangle at a time gives the same canonical Region"
+	 << endl;
+
+++Tests_Total;
+if ((passed = (Region::area (rectangles) == region.area () &&
+			   Region::area (vector<Rectangle> ()) == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "union area from the rectangles" << endl;
+
+cout << endl << "--- Operations" << endl;
+Pixels
+	union_pixels (SIDE * SIDE),
+	intersection_pixels (SIDE * SIDE),
+	difference_pixels (SIDE * SIDE);
+for (index = 0;
+	 index < SIDE * SIDE;
+   ++index)
+	{
+	union_pixels[index] = pixels[index] || other_pixels[index];
+	intersection_pixels[index] = pixels[index] && other_pixels[index];
+	difference_pixels[index] = pixels[index] && ! other_pixels[index];
+	}
+++Tests_Total;
+if ((passed = (matches (region | other, union_pixels) &&
+			   matches (region & other, intersection_pixels) &&
+			   matches (region - other, difference_pixels) &&
+			   ((region - other) | (region & other)) == region &&
+			   (region - region).is_empty ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "union, intersection and difference" << endl;
+
+cout << endl << "--- Tests" << endl;
+passed = true;
+for (int
+		y = -MARGIN;
+		y < EXTENT + MARGIN;
+	  ++y)
+	for (int
+			x = -MARGIN;
+			x < EXTENT + MARGIN;
+		  ++x)
+		if (region.contains (Point_2D (x, y)) !=
+				(pixels[(y + MARGIN) * SIDE + x + MARGIN] != 0))
+			passed = false;
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "contains pixels" << endl;
+
+passed = true;
+for (index = 0;
+	 index < 1000;
+   ++index)
+	{
+	Rectangle
+		area (random_value (EXTENT) - MARGIN / 2,
+			random_value (EXTENT) - MARGIN / 2,
+			random_value (8) + 1, random_value (8) + 1);
+	int
+		set = 0;
+	for (int
+			y = area.Y;
+			y < area.Y + (int)area.Height;
+		  ++y)
+		for (int
+				x = area.X;
+				x < area.X + (int)area.Width;
+			  ++x)
+			if (pixels[(y + MARGIN) * SIDE + x + MARGIN])
+				++set;
+	if (region.contains (area) != (set == (int)area.area ()) ||
+		region.overlaps (area) != (set != 0))
+		passed = false;
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "contains and overlaps rectangles" << endl;
+
+Region
+	joined (Rectangle (10, 20, 5, 5));
+joined |= Rectangle (15, 20, 5, 5);
+++Tests_Total;
+if ((passed = (joined.size () == 1 &&
+			   joined.bounds () == Rectangle (10, 20, 10, 5) &&
+			   region.bounds ().X <= rectangles[0].X &&
+			   Region ().bounds () == Rectangle ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "touching rectangles are joined; bounds" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
@@ -0,0 +1,181 @@
+/*	Static_Data_Block_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+using namespace std;
+
+#include "Static_Data_Block.hh"
+#include "endian.hh"
+using namespace PIRL;
+
+struct Flag      : Static_Field<char> {};
+struct Time_Tag  : Static_Field<unsigned int> {};
+struct Samples   : Static_Field<short, 4> {};
+struct Gain      : Static_Field<double> {};
+struct Counter   : Static_Field<int, 1, 3> {};
+
+typedef Static_Data_Block<Flag, Time_Tag, Samples, Gain, Counter>
+	Record;
+
+static_assert (Record::ELEMENTS == 5, "Record elements");
+static_assert (Record::offset_of<Time_Tag> () == 1, "Time_Tag offset");
+static_assert (Record::offset_of<Samples> () == 5, "Samples offset");
+static_assert (Record::offset_of<Gain> () == 13, "Gain offset");
+static_assert (Record::offset_of<Counter> () == 21, "Counter offset");
+static_assert (Record::size () == 24, "Record size");
+
+unsigned char
+	store[64],
+	other[64];
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+{
+cout << "*** Static_Data_Block test" << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0;
+short
+	samples[4] = {1, -2, 300, -400},
+	results[4];
+
+cout << endl << "--- Native order" << endl;
+memset (store, 0, sizeof (store));
+Record
+	record (store);
+record.put<Flag> ('F');
+record.put<Time_Tag> (0x01020304);
+record.put<Samples> (samples);
+record.put<Gain> (1.5);
+record.put<Counter> (0x123456);
+
+++Tests_Total;
+if ((passed = (record.get<Flag> () == 'F' &&
+			   record.get<Time_Tag> () == 0x01020304 &&
+			   record.get<Gain> () == 1.5)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "scalar fields round trip" << endl;
+
+++Tests_Total;
+record.get<Samples> (results);
+if ((passed = (memcmp (results, samples, sizeof (samples)) == 0 &&
+			   record.get<Samples> (2) == 300)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "array field round trip" << endl;
+
+++Tests_Total;
+if ((passed = (record.get<Counter> () == 0x123456)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "3 byte Counter = " << record.get<Counter> () << " - " << 0x123456 << endl;
+
+cout << endl << "--- Equivalent Data_Block" << endl;
+Data_Block
+	block (record.data_block ());
+++Tests_Total;
+if ((passed = (block.elements () == Record::ELEMENTS &&
+			   block.size () == Record::size () &&
+			   block.offset_of (4) == Record::offset_of<Counter> () &&
+			   block.array_counts ()[2] == 4)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "Data_Block structure" << endl;
+
+unsigned int
+	time_tag = 0;
+int
+	counter = 0;
+block.get (time_tag, 1);
+block.get (counter, 4);
+++Tests_Total;
+if ((passed = (time_tag == 0x01020304 && counter == 0x123456)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "Data_Block values" << endl;
+
+cout << endl << "--- Non-native order" << endl;
+Data_Block::Data_Order
+	order = (Data_Block::native_order () == Data_Block::MSB) ?
+		Data_Block::LSB : Data_Block::MSB;
+memset (other, 0, sizeof (other));
+Record
+	swapped (other, order);
+swapped.put<Time_Tag> (0x01020304);
+swapped.put<Samples> (samples);
+swapped.put<Gain> (1.5);
+swapped.put<Counter> (0x123456);
+
+++Tests_Total;
+if ((passed = (swapped.data_order () == order &&
+			   other[1] == store[4] && other[4] == store[1] &&
+			   other[5] == store[6] && other[6] == store[5])))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "data stored in reversed byte order" << endl;
+
+++Tests_Total;
+swapped.get<Samples> (results);
+if ((passed = (swapped.get<Time_Tag> () == 0x01020304 &&
+			   swapped.get<Gain> () == 1.5 &&
+			   swapped.get<Counter> () == 0x123456 &&
+			   memcmp (results, samples, sizeof (samples)) == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "non-native fields round trip" << endl;
+
+block.data (other).data_order (order);
+time_tag = 0;
+counter = 0;
+block.get (time_tag, 1);
+block.get (counter, 4);
+++Tests_Total;
+if ((passed = (time_tag == 0x01020304 && counter == 0x123456)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "Data_Block agrees with non-native Static_Data_Block" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
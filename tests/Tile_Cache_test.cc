@@ -0,0 +1,239 @@
+/*	Tile_Cache_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <stdexcept>
+using namespace std;
+
+#include "Tile_Cache.hh"
+using namespace PIRL;
+
+//	A decoded tile: its pixels are the number of the tile.
+typedef vector<int>				Pixels;
+typedef Tile_Cache<Pixels>		Cache;
+
+const int
+	TILE_SIDE	= 16;
+
+atomic<int>
+	Loads (0);
+
+Cache::Tile_Pointer
+decode
+	(
+	const Cube&		volume,
+	Dimensions_Type	band,
+	size_t&			bytes
+	)
+{
+++Loads;
+bytes = volume.area () * volume.Depth * sizeof (int);
+return Cache::Tile_Pointer (new Pixels (volume.area () * volume.Depth,
+	volume.X / TILE_SIDE + 1000 * (volume.Y / TILE_SIDE) + (int)band));
+}
+
+
+Cube
+tile_at
+	(
+	int		column,
+	int		row
+	)
+{return Cube (column * TILE_SIDE, row * TILE_SIDE, TILE_SIDE, TILE_SIDE, 1);}
+
+
+const size_t
+	TILE_BYTES = TILE_SIDE * TILE_SIDE * sizeof (int);
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Tile_Cache test" << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	index;
+
+cout << endl << "--- Lookup" << endl;
+Cache
+	cache (8 * TILE_BYTES, 1);
+Cache::Tile_Pointer
+	tile = cache.load (tile_at (1, 2), 0, decode),
+	again = cache.load (tile_at (1, 2), 0, decode);
+++Tests_Total;
+if ((passed = (Loads == 1 &&
+			   tile == again &&
+			   (*tile)[0] == 2001 &&
+			   ! cache.find (tile_at (1, 2), 1) &&
+			   cache.statistics ().Hits == 1 &&
+			   cache.statistics ().Misses == 2 &&
+			   cache.statistics ().Bytes == TILE_BYTES)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "load decodes a tile once; band is part of the key" << endl;
+
+cout << endl << "--- Eviction" << endl;
+for (index = 0;
+	 index < 8;
+   ++index)
+	cache.load (tile_at (index, 0), 0, decode);
+//	Use the oldest tile so the next oldest is evicted.
+cache.find (tile_at (0, 0));
+cache.load (tile_at (0, 1), 0, decode);
+Cache::Statistics
+	statistics = cache.statistics ();
+++Tests_Total;
+if ((passed = (statistics.Tiles == 8 &&
+			   statistics.Bytes == 8 * TILE_BYTES &&
+			   statistics.Evictions == 2 &&
+			   ! cache.find (tile_at (1, 2)) &&
+			   ! cache.find (tile_at (1, 0)) &&
+			   cache.find (tile_at (0, 0)) &&
+			   (*tile)[0] == 2001 &&
+			   tile.reference_count () == 2)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "least recently used tiles are evicted; handed out tiles stay alive"
+	 << endl;
+
+++Tests_Total;
+if ((passed = (! cache.insert (Cube (0, 0, 64, 64, 1), 0,
+					Cache::Tile_Pointer (new Pixels), 9 * TILE_BYTES) &&
+			   cache.insert (tile_at (0, 0), 0,
+					Cache::Tile_Pointer (new Pixels (1, -1)), TILE_BYTES) &&
+			   (*cache.find (tile_at (0, 0)))[0] == -1 &&
+			   cache.erase (tile_at (0, 0)) &&
+			   ! cache.erase (tile_at (0, 0)) &&
+			   cache.statistics ().Tiles == 7 &&
+			   cache.clear ().statistics ().Bytes == 0 &&
+			   cache.reset_statistics ().statistics ().Hits == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "oversize tiles are not cached; replace, erase and clear" << endl;
+
+cout << endl << "--- Overlap" << endl;
+Cache
+	area_cache (64 * TILE_BYTES, 4);
+for (index = 0;
+	 index < 4;
+   ++index)
+	if (index != 2)
+		area_cache.load (tile_at (index % 2, index / 2), 0, decode);
+area_cache.load (Cube (0, 0, TILE_SIDE, TILE_SIDE, 2), 1, decode);
+Region
+	uncovered;
+vector<Cache::Entry>
+	entries = area_cache.overlapping
+		(Rectangle (8, 8, TILE_SIDE, TILE_SIDE), &uncovered);
+++Tests_Total;
+if ((passed = (entries.size () == 4 &&
+			   entries[0].Volume == tile_at (0, 0) &&
+			   entries[0].Band == 0 &&
+			   entries[1].Band == 1 &&
+			   uncovered.area () == 8 * 8 &&
+			   uncovered.contains (Rectangle (8, 16, 8, 8)) &&
+			   area_cache.overlapping (Cube (8, 8, 16, 16, 1), 2, &uncovered)
+			   	.size () == 1 &&
+			   uncovered.area () == 3 * 8 * 8)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "overlapping tiles and the uncovered region" << endl;
+
+cout << endl << "--- Threads" << endl;
+Cache
+	shared (256 * TILE_BYTES);
+atomic<int>
+	wrong (0);
+vector<thread>
+	threads;
+Loads = 0;
+for (index = 0;
+	 index < 4;
+   ++index)
+	threads.push_back (thread ([&shared, &wrong, index] ()
+		{
+		unsigned int
+			seed = index + 1;
+		for (int
+				lookup = 0;
+				lookup < 20000;
+			  ++lookup)
+			{
+			seed = seed * 1103515245 + 12345;
+			int
+				column = (seed >> 8) % 24,
+				row = (seed >> 16) % 24;
+			Cache::Tile_Pointer
+				tile = shared.load (tile_at (column, row), 0, decode);
+			if ((*tile)[TILE_SIDE] != column + 1000 * row)
+				++wrong;
+			}
+		}));
+for (index = 0;
+	 index < (int)threads.size ();
+   ++index)
+	threads[index].join ();
+statistics = shared.statistics ();
+++Tests_Total;
+if ((passed = (wrong == 0 &&
+			   statistics.Hits + statistics.Misses == 4 * 20000 &&
+			   statistics.Misses == (unsigned long long)Loads &&
+			   statistics.Bytes <= shared.capacity () &&
+			   statistics.Bytes == statistics.Tiles * TILE_BYTES &&
+			   statistics.Insertions - statistics.Evictions
+			   	== statistics.Tiles)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "concurrent loads within the budget" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
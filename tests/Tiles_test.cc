@@ -0,0 +1,243 @@
+/*	Tiles_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <stdexcept>
+using namespace std;
+
+#include "Tiles.hh"
+using namespace PIRL;
+
+const int
+	X		= 3,
+	Y		= -2,
+	WIDTH	= 100,
+	HEIGHT	= 70,
+	DEPTH	= 5;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+/*	Tests that the tiles cover each voxel of the volume exactly once
+	and that no tile extends beyond the volume.
+*/
+bool
+covers
+	(
+	const Tiles&	tiles
+	)
+{
+vector<int>
+	voxels (WIDTH * HEIGHT * DEPTH, 0);
+for (Tiles::const_iterator
+		tile = tiles.begin ();
+		tile != tiles.end ();
+	  ++tile)
+	{
+	Tiles::Tile
+		piece = *tile;
+	if (piece.X < X ||
+		piece.Y < Y ||
+		piece.X + (int)piece.Width > X + WIDTH ||
+		piece.Y + (int)piece.Height > Y + HEIGHT ||
+		piece.Band + piece.Depth > (unsigned int)tiles.area ().Depth ||
+		piece.is_empty ())
+		return false;
+	for (unsigned int
+			band = piece.Band;
+			band < piece.Band + piece.Depth;
+		  ++band)
+		for (int
+				y = piece.Y;
+				y < piece.Y + (int)piece.Height;
+			  ++y)
+			for (int
+					x = piece.X;
+					x < piece.X + (int)piece.Width;
+				  ++x)
+				++voxels[(band * HEIGHT + (y - Y)) * WIDTH + (x - X)];
+	}
+for (unsigned int
+		voxel = 0;
+		voxel < (unsigned int)(WIDTH * HEIGHT * tiles.area ().Depth);
+	  ++voxel)
+	if (voxels[voxel] != 1)
+		return false;
+return true;
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Tiles test" << endl
+	 << "    " << Tiles::ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0;
+unsigned int
+	index;
+
+cout << endl << "--- Coverage" << endl;
+Rectangle
+	area (X, Y, WIDTH, HEIGHT);
+Tiles
+	row_major (area, Size_2D (16)),
+	morton (area, Size_2D (16), Tiles::MORTON),
+	hilbert (area, Size_2D (16), Tiles::HILBERT);
+++Tests_Total;
+if ((passed = (row_major.columns () == 7 &&
+			   row_major.rows () == 5 &&
+			   row_major.bands () == 1 &&
+			   row_major.size () == 35 &&
+			   covers (row_major) &&
+			   covers (morton) &&
+			   covers (hilbert))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "row major, Morton and Hilbert tiles cover the rectangle" << endl;
+
+Cube
+	volume (X, Y, WIDTH, HEIGHT, DEPTH);
+Tiles
+	bands (volume, Size_2D (32, 24), 2, Tiles::HILBERT),
+	whole (volume, Size_2D (32, 24));
+++Tests_Total;
+if ((passed = (bands.bands () == 3 &&
+			   bands.size () == 4 * 3 * 3 &&
+			   covers (bands) &&
+			   whole.bands () == 1 &&
+			   whole[0].Depth == DEPTH &&
+			   covers (whole))))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "banded tiles cover the cube" << endl;
+
+cout << endl << "--- Clipping" << endl;
+Tiles::Tile
+	corner = row_major[34],
+	last = bands.tile (3, 2, 2);
+++Tests_Total;
+if ((passed = (corner.X == X + 96 &&
+			   corner.Y == Y + 64 &&
+			   corner.Width == 4 &&
+			   corner.Height == 6 &&
+			   last.Band == 4 &&
+			   last.Depth == 1 &&
+			   last.Width == 4 &&
+			   last.Height == 22)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "edge tiles are clipped to the area" << endl;
+
+cout << endl << "--- Order" << endl;
+Tiles
+	square (Rectangle (0, 0, 128, 128), Size_2D (16), Tiles::HILBERT),
+	z_order (Rectangle (0, 0, 128, 128), Size_2D (16), Tiles::MORTON);
+passed = true;
+for (index = 1;
+	 index < square.size ();
+   ++index)
+	{
+	Tiles::Tile
+		previous = square[index - 1],
+		current = square[index];
+	if (abs (previous.X - current.X) + abs (previous.Y - current.Y) != 16)
+		passed = false;
+	}
+++Tests_Total;
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "successive Hilbert tiles are adjacent" << endl;
+
+++Tests_Total;
+if ((passed = (z_order[1].X == 16 && z_order[1].Y == 0 &&
+			   z_order[2].X == 0  && z_order[2].Y == 16 &&
+			   z_order[3].X == 16 && z_order[3].Y == 16 &&
+			   z_order[4].X == 32 && z_order[4].Y == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "Morton tiles follow the Z order" << endl;
+
+Tiles::const_iterator
+	position = hilbert.begin () + 10;
+++Tests_Total;
+if ((passed = (hilbert.end () - hilbert.begin () == 35 &&
+			   position[2].X == hilbert[12].X &&
+			   position[2].Y == hilbert[12].Y &&
+			   (position - 10) == hilbert.begin ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "random access iterator" << endl;
+
+cout << endl << "--- Tile size" << endl;
+++Tests_Total;
+if ((passed = (Tiles::suggested_size (4, 262144) == Size_2D (128) &&
+			   Tiles::suggested_size (4, 262144, 4) == Size_2D (64) &&
+			   Tiles::suggested_size (8, 16) == Size_2D (1) &&
+			   ! Tiles::suggested_size (2).is_empty ())))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "suggested tile sizes fit half the cache" << endl;
+
+++Tests_Total;
+try
+	{
+	Tiles
+		tiles (area, Size_2D (0, 16));
+	passed = false;
+	}
+catch (invalid_argument&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "an empty tile size throws invalid_argument" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}
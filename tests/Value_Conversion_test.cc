@@ -0,0 +1,333 @@
+/*	Value_Conversion_test
+
+Copyright (C) 2026  Arizona Board of Regents on behalf of the Planetary
+Image Research Laboratory, Lunar and Planetary Laboratory at the
+University of Arizona.
+
+This library is free software; you can redistribute it and/or modify it
+under the terms of the GNU Lesser General Public License, version 2.1,
+as published by the Free Software Foundation.
+
+This library is distributed in the hope that it will be useful, but
+WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser
+General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this library; if not, write to the Free Software Foundation,
+Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA.
+*/
+
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <stdexcept>
+using namespace std;
+
+#include "Value_Conversion.hh"
+#include "Data_Block.hh"
+using namespace PIRL;
+
+enum
+	{
+	VAX_VALUE,
+	IBM_VALUE,
+	IBM_ARRAY
+	};
+
+static const Data_Block::Index
+	sizes[] = {4, 8, 8, 0};
+
+const int
+	VALUES = 1000;
+
+
+void
+Done
+	(
+	int		total,
+	int		passed
+	)
+{
+cout << endl
+	 << "Checks: " << total << endl
+	 << "Passed: " << passed << endl;
+exit (total - passed);
+}
+
+
+int
+main
+	(
+	int		count,
+	char	**argument
+	)
+try
+{
+cout << "*** Value_Conversion test" << endl
+	 << "    " << Value_Conversion_ID << endl;
+
+bool
+	passed;
+int
+	Tests_Total = 0,
+	Tests_Passed = 0,
+	index;
+
+cout << endl << "--- Known encodings" << endl;
+const unsigned char
+	VAX_one[8]		= {0x80, 0x40, 0, 0, 0, 0, 0, 0},
+	VAX_half[8]		= {0x00, 0xC0, 0, 0, 0, 0, 0, 0},
+	IBM_one[8]		= {0x41, 0x10, 0, 0, 0, 0, 0, 0},
+	IBM_value[4]	= {0xC2, 0x76, 0xA0, 0x00};
+++Tests_Total;
+if ((passed = (VAX_real_to_IEEE (VAX_one) == 1.0f &&
+			   VAX_double_to_IEEE (VAX_one) == 1.0 &&
+			   VAX_real_to_IEEE (VAX_half) == -0.5f &&
+			   IBM_real_to_IEEE (IBM_one) == 1.0f &&
+			   IBM_double_to_IEEE (IBM_one) == 1.0 &&
+			   IBM_real_to_IEEE (IBM_value) == -118.625f)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "VAX 1.0, -0.5; IBM 1.0, " << IBM_real_to_IEEE (IBM_value)
+	 << " - -118.625" << endl;
+
+unsigned char
+	data[VALUES * 8];
+IEEE_to_VAX_double (1.0, data);
+IEEE_to_IBM_real (-118.625f, data + 8);
+++Tests_Total;
+if ((passed = (memcmp (data, VAX_one, 8) == 0 &&
+			   memcmp (data + 8, IBM_value, 4) == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "IEEE to VAX 1.0 and IBM -118.625" << endl;
+
+cout << endl << "--- Batch round trips" << endl;
+float
+	floats[VALUES],
+	float_results[VALUES];
+double
+	doubles[VALUES],
+	double_results[VALUES];
+for (index = 0;
+	 index < VALUES;
+   ++index)
+	{
+	doubles[index] =
+		ldexp ((index % 2 ? -1.0 : 1.0) * (1.0 + index / 997.0),
+			(index % 200) - 100);
+	floats[index] = (float)doubles[index];
+	}
+
+IEEE_to_VAX_real (floats, data, VALUES);
+VAX_real_to_IEEE (data, float_results, VALUES);
+++Tests_Total;
+if ((passed = (memcmp (floats, float_results, sizeof (floats)) == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "VAX real" << endl;
+
+IEEE_to_VAX_double (doubles, data, VALUES);
+VAX_double_to_IEEE (data, double_results, VALUES);
+++Tests_Total;
+if ((passed = (memcmp (doubles, double_results, sizeof (doubles)) == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "VAX double" << endl;
+
+IEEE_to_IBM_double (doubles, data, VALUES);
+IBM_double_to_IEEE (data, double_results, VALUES);
+++Tests_Total;
+if ((passed = (memcmp (doubles, double_results, sizeof (doubles)) == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "IBM double" << endl;
+
+//	IBM real has 21 to 24 significant bits.
+IEEE_to_IBM_real (floats, data, VALUES, 8);
+IBM_real_to_IEEE (data, float_results, VALUES, 8);
+for (index = 0;
+	 index < VALUES;
+   ++index)
+	if (fabs (float_results[index] - floats[index])
+			> fabs (floats[index]) * 1.0e-6)
+		break;
+++Tests_Total;
+if ((passed = (index == VALUES)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "IBM real, stride 8" << endl;
+
+cout << endl << "--- Limits" << endl;
+IEEE_to_VAX_real (3.0e38f, data);
+IEEE_to_VAX_real (-HUGE_VALF, data + 4);
+IEEE_to_IBM_double (1.0e-300, data + 8);
+++Tests_Total;
+if ((passed = (VAX_real_to_IEEE (data) > 1.6e38f &&
+			   VAX_real_to_IEEE (data + 4) < -1.6e38f &&
+			   IBM_double_to_IEEE (data + 8) == 0.0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "overflow clamped, underflow zero" << endl;
+
+cout << endl << "--- Data_Block value formats" << endl;
+Data_Block
+	block;
+block.element_sizes (sizes);
+block.data (data);
+block.array_counts ()[IBM_ARRAY] = 2;
+block.value_format (VAX_VALUE, Data_Block::VAX_REAL);
+block.value_format (IBM_VALUE, Data_Block::IBM_DOUBLE);
+block.value_format (IBM_ARRAY, Data_Block::IBM_REAL);
+double
+	value = -118.625;
+float
+	pair[2] = {1.0f, -118.625f};
+block.put (value, VAX_VALUE);
+block.put (value, IBM_VALUE);
+block.put (pair, IBM_ARRAY);
+++Tests_Total;
+if ((passed = (block.get<double> (VAX_VALUE) == -118.625 &&
+			   block.get<float> (IBM_VALUE) == -118.625f &&
+			   block.get<int> (IBM_VALUE) == -118 &&
+			   memcmp (data + 12, IBM_one, 4) == 0 &&
+			   memcmp (data + 16, IBM_value, 4) == 0)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "get<double> (VAX_VALUE) = " << block.get<double> (VAX_VALUE)
+	 << ", get<float> (IBM_VALUE) = " << block.get<float> (IBM_VALUE)
+	 << " - -118.625" << endl;
+
+double
+	values[2] = {0, 0};
+block.get (values, IBM_ARRAY);
+Data_Block
+	view (block);
+view.value_format (VAX_VALUE, Data_Block::UNSPECIFIED_FORMAT);
+++Tests_Total;
+if ((passed = (values[0] == 1.0 &&
+			   values[1] == -118.625 &&
+			   block.value_format (VAX_VALUE) == Data_Block::VAX_REAL &&
+			   view.value_format (VAX_VALUE) == Data_Block::UNSPECIFIED_FORMAT &&
+			   view.value_format (IBM_VALUE) == Data_Block::IBM_DOUBLE)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "array get = " << values[0] << ", " << values[1]
+	 << "; formats of a copy are independent" << endl;
+
+++Tests_Total;
+try
+	{
+	block.value_format (IBM_ARRAY, Data_Block::IBM_DOUBLE);
+	passed = false;
+	}
+catch (length_error&)
+	{passed = true;}
+if (passed)
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "value_format (IBM_ARRAY, IBM_DOUBLE) throws length_error" << endl;
+
+block.delete_element (VAX_VALUE);
+++Tests_Total;
+if ((passed = (block.value_format (0) == Data_Block::IBM_DOUBLE &&
+			   block.value_format (1) == Data_Block::IBM_REAL)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "formats follow deleted element" << endl;
+
+cout << endl << "--- Integer formats" << endl;
+const unsigned char
+	MSB_shorts[4] = {0xFF, 0xFE, 0x7F, 0xFF};
+int
+	ints[2];
+integers_to_values (MSB_shorts, 2, true, ! high_endian_host (), ints, 2);
+++Tests_Total;
+if ((passed = (ints[0] == -2 &&
+			   ints[1] == 32767)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "MSB signed shorts = " << ints[0] << ", " << ints[1]
+	 << " - -2, 32767" << endl;
+
+static const Data_Block::Index
+	integer_sizes[] = {2, 3, 1, 4, 8, 0};
+enum
+	{
+	SHORT_VALUE,
+	TRIPLE_VALUE,
+	BYTE_VALUE,
+	UNSIGNED_VALUE,
+	UNSIGNED_ARRAY
+	};
+Data_Block
+	integers;
+integers.element_sizes (integer_sizes);
+integers.data (data);
+integers.data_order (Data_Block::MSB);
+integers.array_counts ()[UNSIGNED_ARRAY] = 4;
+integers.value_format (SHORT_VALUE, Data_Block::SIGNED_INTEGER);
+integers.value_format (TRIPLE_VALUE, Data_Block::SIGNED_INTEGER);
+integers.value_format (BYTE_VALUE, Data_Block::SIGNED_INTEGER);
+integers.value_format (UNSIGNED_VALUE, Data_Block::UNSIGNED_INTEGER);
+integers.value_format (UNSIGNED_ARRAY, Data_Block::UNSIGNED_INTEGER);
+int
+	integer = -1234;
+integers.put (integer, SHORT_VALUE);
+integer = -5;
+integers.put (integer, TRIPLE_VALUE);
+integer = 300;
+integers.put (integer, BYTE_VALUE);
+++Tests_Total;
+if ((passed = (integers.get<int> (SHORT_VALUE) == -1234 &&
+			   integers.get<double> (SHORT_VALUE) == -1234.0 &&
+			   data[0] == 0xFB && data[1] == 0x2E &&
+			   integers.get<long> (TRIPLE_VALUE) == -5 &&
+			   integers.get<int> (BYTE_VALUE) == 44)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "sign extended get<int> (SHORT_VALUE) = "
+	 << integers.get<int> (SHORT_VALUE)
+	 << ", get<long> (TRIPLE_VALUE) = " << integers.get<long> (TRIPLE_VALUE)
+	 << ", truncated BYTE_VALUE = " << integers.get<int> (BYTE_VALUE) << endl;
+
+integers.saturate (true);
+integers.put (integer, BYTE_VALUE);
+value = 1.0e10;
+integers.put (value, UNSIGNED_VALUE);
+++Tests_Total;
+if ((passed = (integers.get<int> (BYTE_VALUE) == 127 &&
+			   integers.get<unsigned char> (SHORT_VALUE) == 0 &&
+			   integers.get<short> (UNSIGNED_VALUE) == 32767 &&
+			   integers.get<unsigned int> (UNSIGNED_VALUE) == 4294967295U)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "saturated BYTE_VALUE = " << integers.get<int> (BYTE_VALUE)
+	 << ", UNSIGNED_VALUE = " << integers.get<unsigned int> (UNSIGNED_VALUE)
+	 << endl;
+
+int
+	samples[4] = {1, -1, 70000, 5};
+long long
+	widened[4];
+integers.put (samples, UNSIGNED_ARRAY);
+integers.get (widened, UNSIGNED_ARRAY);
+++Tests_Total;
+if ((passed = (widened[0] == 1 &&
+			   widened[1] == 0 &&
+			   widened[2] == 65535 &&
+			   widened[3] == 5)))
+	++Tests_Passed;
+cout << (passed ? "PASS: " : "FAIL: ")
+	 << "saturated array = " << widened[0] << ", " << widened[1] << ", "
+	 << widened[2] << ", " << widened[3] << " - 1, 0, 65535, 5" << endl;
+
+Done (Tests_Total, Tests_Passed);
+}
+catch (exception& except)
+	{
+	cerr << "Exception: " << except.what () << endl;
+	exit (-1);
+	}